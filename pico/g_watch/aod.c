@@ -0,0 +1,135 @@
+#include "aod.h"
+#include <math.h>
+
+#if defined(PICO_ON_DEVICE) && PICO_ON_DEVICE
+#include "hardware/sync.h"
+#endif
+
+// 表盘中心(窗口坐标)和指针尺寸, 分针要完整落在窗口内
+#define AOD_CENTER_X    (AOD_WIDTH / 2)
+#define AOD_CENTER_Y    (120 - AOD_TOP)
+#define AOD_HOUR_LEN    40
+#define AOD_MIN_LEN     62
+#define AOD_HOUR_W      5
+#define AOD_MIN_W       3
+#define AOD_DOT_R       4
+
+static lv_obj_t *face_obj;
+static lv_point_t hour_tip;
+static lv_point_t min_tip;
+static volatile bool wake_req;
+
+// 指针末端: angle为从12点方向顺时针的角度(0.1度)
+static lv_point_t hand_tip(int32_t angle, int32_t len) {
+    float rad = angle * (float)M_PI / 1800.0f;
+    lv_point_t p = {
+        .x = AOD_CENTER_X + (int32_t)lroundf(sinf(rad) * len),
+        .y = AOD_CENTER_Y - (int32_t)lroundf(cosf(rad) * len),
+    };
+    return p;
+}
+
+// 指针覆盖的区域(含圆头)
+static void hand_area(const lv_point_t *tip, int32_t width, lv_area_t *area) {
+    area->x1 = LV_MIN(tip->x, AOD_CENTER_X);
+    area->y1 = LV_MIN(tip->y, AOD_CENTER_Y);
+    area->x2 = LV_MAX(tip->x, AOD_CENTER_X);
+    area->y2 = LV_MAX(tip->y, AOD_CENTER_Y);
+    lv_area_increase(area, width / 2 + 1, width / 2 + 1);
+}
+
+static void draw_hand(lv_layer_t *layer, const lv_point_t *tip, int32_t width) {
+    lv_draw_line_dsc_t line_dsc;
+    lv_draw_line_dsc_init(&line_dsc);
+    line_dsc.color = lv_color_white();
+    line_dsc.width = width;
+    line_dsc.round_start = 1;
+    line_dsc.round_end = 1;
+    line_dsc.p1.x = AOD_CENTER_X;
+    line_dsc.p1.y = AOD_CENTER_Y;
+    line_dsc.p2.x = tip->x;
+    line_dsc.p2.y = tip->y;
+    lv_draw_line(layer, &line_dsc);
+}
+
+// 直接画线段, 不用旋转变换: 1位目标上不需要中间图层, 每分钟的重绘只有几次线段填充
+static void draw_aod_face(lv_event_t *e) {
+    lv_layer_t *layer = lv_event_get_layer(e);
+
+    draw_hand(layer, &hour_tip, AOD_HOUR_W);
+    draw_hand(layer, &min_tip, AOD_MIN_W);
+
+    lv_draw_rect_dsc_t dot_dsc;
+    lv_draw_rect_dsc_init(&dot_dsc);
+    dot_dsc.bg_color = lv_color_white();
+    dot_dsc.radius = LV_RADIUS_CIRCLE;
+    lv_area_t dot = {
+        AOD_CENTER_X - AOD_DOT_R, AOD_CENTER_Y - AOD_DOT_R,
+        AOD_CENTER_X + AOD_DOT_R, AOD_CENTER_Y + AOD_DOT_R
+    };
+    lv_draw_rect(layer, &dot_dsc, &dot);
+}
+
+void aod_face_create(lv_obj_t *parent) {
+    lv_obj_set_style_bg_color(parent, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(parent, LV_OPA_COVER, 0);
+
+    face_obj = lv_obj_create(parent);
+    lv_obj_remove_style_all(face_obj);
+    lv_obj_set_size(face_obj, AOD_WIDTH, AOD_HEIGHT);
+    lv_obj_set_pos(face_obj, 0, 0);
+    lv_obj_remove_flag(face_obj, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+    lv_obj_add_event_cb(face_obj, draw_aod_face, LV_EVENT_DRAW_MAIN_END, NULL);
+
+    hour_tip = hand_tip(0, AOD_HOUR_LEN);
+    min_tip = hand_tip(0, AOD_MIN_LEN);
+}
+
+void aod_face_set_time(const watch_time_t *t) {
+    lv_point_t hour = hand_tip((t->hour % 12) * 300 + t->min * 5, AOD_HOUR_LEN);
+    lv_point_t min = hand_tip(t->min * 60, AOD_MIN_LEN);
+    lv_area_t area;
+
+    // 只重绘移动了的指针: 旧位置擦除, 新位置绘制
+    if (hour.x != hour_tip.x || hour.y != hour_tip.y) {
+        hand_area(&hour_tip, AOD_HOUR_W, &area);
+        lv_obj_invalidate_area(face_obj, &area);
+        hour_tip = hour;
+        hand_area(&hour_tip, AOD_HOUR_W, &area);
+        lv_obj_invalidate_area(face_obj, &area);
+    }
+    if (min.x != min_tip.x || min.y != min_tip.y) {
+        hand_area(&min_tip, AOD_MIN_W, &area);
+        lv_obj_invalidate_area(face_obj, &area);
+        min_tip = min;
+        hand_area(&min_tip, AOD_MIN_W, &area);
+        lv_obj_invalidate_area(face_obj, &area);
+    }
+}
+
+size_t aod_i1_to_rgb444(const uint8_t *src, uint16_t w, uint8_t *dst) {
+    // 每2个像素3字节: RRRRGGGG BBBBRRRR GGGGBBBB; 空闲模式下面板只用每个分量的最高位
+    uint8_t *p = dst;
+    for (uint16_t x = 0; x < w; x += 2) {
+        bool a = src[x >> 3] & (0x80 >> (x & 7));
+        bool b = src[(x + 1) >> 3] & (0x80 >> ((x + 1) & 7));
+        *p++ = a ? 0xFF : 0x00;
+        *p++ = (a ? 0xF0 : 0x00) | (b ? 0x0F : 0x00);
+        *p++ = b ? 0xFF : 0x00;
+    }
+    return (size_t)(p - dst);
+}
+
+void aod_request_wake(void) {
+    wake_req = true;
+#if defined(PICO_ON_DEVICE) && PICO_ON_DEVICE
+    // UI核心在WFE中睡眠, 发送事件唤醒它
+    __sev();
+#endif
+}
+
+bool aod_take_wake_request(void) {
+    if (!wake_req) return false;
+    wake_req = false;
+    return true;
+}
@@ -0,0 +1,41 @@
+#ifndef AOD_H
+#define AOD_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "lvgl.h"
+#include "watch_face.h"
+
+// 常亮(AOD)表盘
+// 只有时针和分针, 黑底白针, 用LVGL的1位(I1)格式渲染, 只覆盖屏幕中间的一段行
+// (面板部分显示模式的窗口, 窗口外的行不驱动)。时间每分钟更新一次, 只重绘新旧指针所在的区域。
+// 表盘和像素转换不依赖SDK: 设备端和主机端功耗基准测试共用。
+
+// 显示窗口: 屏幕的 AOD_TOP .. AOD_TOP + AOD_HEIGHT - 1 行, AOD显示设备的坐标从窗口顶部开始
+#define AOD_WIDTH       240
+#define AOD_TOP         48
+#define AOD_HEIGHT      144
+
+// I1渲染缓冲大小: 整个窗口(每字节8个像素) + LVGL保留的8字节调色板
+#define AOD_BUF_SIZE    (AOD_WIDTH / 8 * AOD_HEIGHT + 8)
+
+// 转换后一行的最大字节数(RGB444, 2个像素3字节)
+#define AOD_LINE_SIZE   (AOD_WIDTH * 3 / 2)
+
+// 在parent(AOD显示设备的屏幕)上创建表盘
+void aod_face_create(lv_obj_t *parent);
+
+// 更新指针, 只使用时和分
+void aod_face_set_time(const watch_time_t *t);
+
+// 把一行I1像素(高位在左)转换为面板的12位RGB444格式, w必须是偶数; 返回写入dst的字节数
+size_t aod_i1_to_rgb444(const uint8_t *src, uint16_t w, uint8_t *dst);
+
+// 请求退出常亮显示(任意线程/核心, 例如抬腕检测), 设备端同时唤醒正在睡眠的UI核心
+void aod_request_wake(void);
+
+// 取出唤醒请求(仅UI线程)
+bool aod_take_wake_request(void);
+
+#endif // AOD_H
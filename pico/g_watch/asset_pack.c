@@ -0,0 +1,350 @@
+#include "asset_pack.h"
+#include <string.h>
+#include "src/font/lv_font_fmt_txt.h"
+
+#if defined(PICO_ON_DEVICE) && PICO_ON_DEVICE
+#include "hardware/regs/addressmap.h"
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+// 预解析字体的布局(与 tools/asset_pack.py 保持一致), 偏移都相对字体数据起始:
+//   font_header_t
+//   font_cmap_t[cmap_num]
+//   font_kern_t (kern_type != 0 时)
+//   glyph_dsc[glyph_cnt] 与 LV_FONT_FMT_TXT_LARGE == 0 时的 lv_font_fmt_txt_glyph_dsc_t 相同(每项8字节)
+//   各cmap的unicode/glyph id列表、kern表、字形位图
+
+#define FONT_KERN_NONE      0
+#define FONT_KERN_PAIRS     1
+#define FONT_KERN_CLASSES   2
+
+typedef struct {
+    int16_t line_height;
+    int16_t base_line;
+    int8_t underline_position;
+    int8_t underline_thickness;
+    uint8_t subpx;
+    uint8_t bpp;
+    uint8_t bitmap_format;
+    uint8_t kern_type;
+    uint16_t kern_scale;
+    uint16_t cmap_num;
+    uint16_t glyph_cnt;
+    uint32_t glyph_dsc_ofs;
+    uint32_t glyph_bitmap_ofs;
+    uint32_t cmap_ofs;
+    uint32_t kern_ofs;
+} font_header_t;
+
+typedef struct {
+    uint32_t range_start;
+    uint16_t range_length;
+    uint16_t glyph_id_start;
+    uint16_t list_length;
+    uint8_t type;
+    uint8_t reserved;
+    uint32_t unicode_list_ofs;      // 0表示没有
+    uint32_t glyph_id_ofs_list_ofs; // 0表示没有
+} font_cmap_t;
+
+// pairs:   cnt=对数, ofs0=glyph id对, ofs1=kern值
+// classes: ofs0=类别对kern值, ofs1/ofs2=左/右类别映射(cnt字节)
+typedef struct {
+    uint32_t cnt;
+    uint8_t glyph_ids_size;
+    uint8_t left_class_cnt;
+    uint8_t right_class_cnt;
+    uint8_t reserved;
+    uint32_t ofs0;
+    uint32_t ofs1;
+    uint32_t ofs2;
+} font_kern_t;
+
+// 字体描述一次性分配, 释放时也只需一次 lv_free
+typedef struct {
+    lv_font_t font;
+    lv_font_fmt_txt_dsc_t dsc;
+    union {
+        lv_font_fmt_txt_kern_pair_t pairs;
+        lv_font_fmt_txt_kern_classes_t classes;
+    } kern;
+    lv_font_fmt_txt_cmap_t cmaps[];
+} pack_font_t;
+
+// 用来区分预解析字体和 lv_binfont_loader 创建的字体
+static const char pack_font_tag[] = "asset_pack";
+
+// [ofs, ofs + len) 是否在长度为size的区域内, 且满足对齐要求
+static bool range_ok(uint32_t size, uint32_t ofs, uint32_t len, uint32_t align) {
+    return ofs <= size && len <= size - ofs && (ofs & (align - 1)) == 0;
+}
+
+// 检查图片项并填写对应的 lv_image_dsc_t
+static bool image_init(lv_image_dsc_t *img, const uint8_t *data, uint32_t size) {
+    if (size < sizeof(lv_image_header_t)) return false;
+
+    lv_image_header_t header;
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != LV_IMAGE_HEADER_MAGIC) return false;
+
+    const uint8_t *pixels = data + sizeof(lv_image_header_t);
+    uint32_t data_size = size - sizeof(lv_image_header_t);
+
+    // 未压缩的图片会被渲染器直接使用, 长度必须足够, 起始地址要满足绘制缓冲对齐
+    if (!(header.flags & LV_IMAGE_FLAGS_COMPRESSED)) {
+        if (header.stride && (uint32_t)header.stride * header.h > data_size) return false;
+        if ((uintptr_t)pixels & (LV_DRAW_BUF_ALIGN - 1)) return false;
+    }
+
+    memset(img, 0, sizeof(*img));
+    img->header = header;
+    img->data = pixels;
+    img->data_size = data_size;
+    return true;
+}
+
+bool asset_pack_open_mem(asset_pack_t *pack, const void *data, uint32_t size) {
+    memset(pack, 0, sizeof(*pack));
+    if (data == NULL || ((uintptr_t)data & 3) || size < sizeof(asset_pack_header_t)) return false;
+
+    asset_pack_header_t header;
+    memcpy(&header, data, sizeof(header));
+    if (header.magic != ASSET_PACK_MAGIC || header.version != ASSET_PACK_VERSION) return false;
+    if (header.size > size) return false;
+
+    uint32_t index_size = (uint32_t)header.entry_cnt * sizeof(asset_pack_entry_t);
+    if (!range_ok(header.size, sizeof(asset_pack_header_t), index_size, 4)) return false;
+
+    pack->base = data;
+    pack->size = header.size;
+    pack->entries = (const asset_pack_entry_t *)(pack->base + sizeof(asset_pack_header_t));
+    pack->entry_cnt = header.entry_cnt;
+
+    if (pack->entry_cnt) {
+        pack->images = lv_malloc_zeroed(pack->entry_cnt * sizeof(lv_image_dsc_t));
+        if (pack->images == NULL) return false;
+    }
+
+    for (uint32_t i = 0; i < pack->entry_cnt; i++) {
+        const asset_pack_entry_t *e = &pack->entries[i];
+        bool ok = e->name[ASSET_PACK_NAME_MAX - 1] == '\0' && range_ok(pack->size, e->offset, e->size, 4);
+        // 索引必须有序, 否则二分查找会漏项
+        if (ok && i > 0) ok = strcmp(pack->entries[i - 1].name, e->name) < 0;
+        if (ok && e->type == ASSET_TYPE_IMAGE) ok = image_init(&pack->images[i], pack->base + e->offset, e->size);
+
+        if (!ok) {
+            lv_free(pack->images);
+            memset(pack, 0, sizeof(*pack));
+            return false;
+        }
+    }
+
+    return true;
+}
+
+#if defined(PICO_ON_DEVICE) && PICO_ON_DEVICE
+bool asset_pack_open_flash(asset_pack_t *pack) {
+    // 资源包通过XIP映射直接读取; 先读包头确定长度, 不能超出flash
+    const uint8_t *base = (const uint8_t *)(XIP_BASE + ASSET_PACK_FLASH_OFFSET);
+    const asset_pack_header_t *header = (const asset_pack_header_t *)base;
+    uint32_t avail = PICO_FLASH_SIZE_BYTES - ASSET_PACK_FLASH_OFFSET;
+
+    if (header->magic != ASSET_PACK_MAGIC || header->size > avail) {
+        memset(pack, 0, sizeof(*pack));
+        return false;
+    }
+    return asset_pack_open_mem(pack, base, header->size);
+}
+#else
+bool asset_pack_open_file(asset_pack_t *pack, const char *path) {
+    memset(pack, 0, sizeof(*pack));
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0 || (uint64_t)st.st_size > UINT32_MAX) {
+        close(fd);
+        return false;
+    }
+
+    size_t len = (size_t)st.st_size;
+    void *map = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED) return false;
+
+    if (!asset_pack_open_mem(pack, map, (uint32_t)len)) {
+        munmap(map, len);
+        return false;
+    }
+    pack->map_len = len;
+    return true;
+}
+#endif
+
+void asset_pack_close(asset_pack_t *pack) {
+    lv_free(pack->images);
+#if !(defined(PICO_ON_DEVICE) && PICO_ON_DEVICE)
+    if (pack->map_len) munmap((void *)pack->base, pack->map_len);
+#endif
+    memset(pack, 0, sizeof(*pack));
+}
+
+const asset_pack_entry_t *asset_pack_find(const asset_pack_t *pack, const char *name) {
+    int32_t lo = 0;
+    int32_t hi = (int32_t)pack->entry_cnt - 1;
+
+    while (lo <= hi) {
+        int32_t mid = (lo + hi) / 2;
+        int cmp = strncmp(name, pack->entries[mid].name, ASSET_PACK_NAME_MAX);
+        if (cmp == 0) return &pack->entries[mid];
+        if (cmp < 0) hi = mid - 1;
+        else lo = mid + 1;
+    }
+    return NULL;
+}
+
+const void *asset_pack_get_data(const asset_pack_t *pack, const asset_pack_entry_t *entry) {
+    return pack->base + entry->offset;
+}
+
+const lv_image_dsc_t *asset_pack_get_image(const asset_pack_t *pack, const char *name) {
+    const asset_pack_entry_t *e = asset_pack_find(pack, name);
+    if (e == NULL || e->type != ASSET_TYPE_IMAGE) return NULL;
+    return &pack->images[e - pack->entries];
+}
+
+// 检查cmap引用的列表都在字体数据内
+static bool cmap_ok(const font_cmap_t *c, uint32_t size) {
+    uint32_t n = c->list_length;
+
+    switch (c->type) {
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY:
+            return true;
+        case LV_FONT_FMT_TXT_CMAP_FORMAT0_FULL:
+            return c->glyph_id_ofs_list_ofs && range_ok(size, c->glyph_id_ofs_list_ofs, n, 1);
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_TINY:
+            return c->unicode_list_ofs && range_ok(size, c->unicode_list_ofs, n * 2, 2);
+        case LV_FONT_FMT_TXT_CMAP_SPARSE_FULL:
+            return c->unicode_list_ofs && range_ok(size, c->unicode_list_ofs, n * 2, 2) &&
+                   c->glyph_id_ofs_list_ofs && range_ok(size, c->glyph_id_ofs_list_ofs, n * 2, 2);
+        default:
+            return false;
+    }
+}
+
+// 由预解析的字体数据创建字体: 只分配描述结构, 数据都指向资源包
+static lv_font_t *font_create_fmt_txt(const uint8_t *data, uint32_t size) {
+    // 包中的字形描述按8字节布局生成
+    if (sizeof(lv_font_fmt_txt_glyph_dsc_t) != 8) return NULL;
+    if (size < sizeof(font_header_t)) return NULL;
+
+    font_header_t h;
+    memcpy(&h, data, sizeof(h));
+    if (h.cmap_num == 0 || h.cmap_num >= 512 || h.glyph_cnt == 0) return NULL;
+    if (h.bpp != 1 && h.bpp != 2 && h.bpp != 4 && h.bpp != 8) return NULL;
+    if (!range_ok(size, h.cmap_ofs, h.cmap_num * sizeof(font_cmap_t), 4)) return NULL;
+    if (!range_ok(size, h.glyph_dsc_ofs, h.glyph_cnt * 8u, 4)) return NULL;
+    if (!range_ok(size, h.glyph_bitmap_ofs, 0, 1)) return NULL;
+
+    const font_cmap_t *cmaps = (const font_cmap_t *)(data + h.cmap_ofs);
+    for (uint32_t i = 0; i < h.cmap_num; i++) {
+        if (!cmap_ok(&cmaps[i], size)) return NULL;
+    }
+
+    font_kern_t k;
+    memset(&k, 0, sizeof(k));
+    if (h.kern_type != FONT_KERN_NONE) {
+        if (!range_ok(size, h.kern_ofs, sizeof(k), 4)) return NULL;
+        memcpy(&k, data + h.kern_ofs, sizeof(k));
+        if (h.kern_type == FONT_KERN_PAIRS) {
+            if (k.glyph_ids_size > 1) return NULL;
+            if (!range_ok(size, k.ofs0, k.cnt * 2 * (k.glyph_ids_size + 1), k.glyph_ids_size + 1)) return NULL;
+            if (!range_ok(size, k.ofs1, k.cnt, 1)) return NULL;
+        } else if (h.kern_type == FONT_KERN_CLASSES) {
+            if (!range_ok(size, k.ofs0, (uint32_t)k.left_class_cnt * k.right_class_cnt, 1)) return NULL;
+            if (!range_ok(size, k.ofs1, k.cnt, 1) || !range_ok(size, k.ofs2, k.cnt, 1)) return NULL;
+        } else {
+            return NULL;
+        }
+    }
+
+    pack_font_t *pf = lv_malloc_zeroed(sizeof(pack_font_t) + h.cmap_num * sizeof(lv_font_fmt_txt_cmap_t));
+    if (pf == NULL) return NULL;
+
+    for (uint32_t i = 0; i < h.cmap_num; i++) {
+        const font_cmap_t *c = &cmaps[i];
+        lv_font_fmt_txt_cmap_t *dst = &pf->cmaps[i];
+        dst->range_start = c->range_start;
+        dst->range_length = c->range_length;
+        dst->glyph_id_start = c->glyph_id_start;
+        dst->list_length = c->list_length;
+        dst->type = c->type;
+        dst->unicode_list = c->unicode_list_ofs ? (const uint16_t *)(data + c->unicode_list_ofs) : NULL;
+        dst->glyph_id_ofs_list = c->glyph_id_ofs_list_ofs ? data + c->glyph_id_ofs_list_ofs : NULL;
+    }
+
+    lv_font_fmt_txt_dsc_t *dsc = &pf->dsc;
+    dsc->glyph_bitmap = data + h.glyph_bitmap_ofs;
+    dsc->glyph_dsc = (const lv_font_fmt_txt_glyph_dsc_t *)(data + h.glyph_dsc_ofs);
+    dsc->cmaps = pf->cmaps;
+    dsc->cmap_num = h.cmap_num;
+    dsc->bpp = h.bpp;
+    dsc->bitmap_format = h.bitmap_format;
+    dsc->kern_scale = h.kern_scale;
+
+    if (h.kern_type == FONT_KERN_PAIRS) {
+        pf->kern.pairs.glyph_ids = data + k.ofs0;
+        pf->kern.pairs.values = (const int8_t *)(data + k.ofs1);
+        pf->kern.pairs.pair_cnt = k.cnt;
+        pf->kern.pairs.glyph_ids_size = k.glyph_ids_size;
+        dsc->kern_dsc = &pf->kern.pairs;
+        dsc->kern_classes = 0;
+    } else if (h.kern_type == FONT_KERN_CLASSES) {
+        pf->kern.classes.class_pair_values = (const int8_t *)(data + k.ofs0);
+        pf->kern.classes.left_class_mapping = data + k.ofs1;
+        pf->kern.classes.right_class_mapping = data + k.ofs2;
+        pf->kern.classes.left_class_cnt = k.left_class_cnt;
+        pf->kern.classes.right_class_cnt = k.right_class_cnt;
+        dsc->kern_dsc = &pf->kern.classes;
+        dsc->kern_classes = 1;
+    }
+
+    lv_font_t *font = &pf->font;
+    font->get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt;
+    font->get_glyph_bitmap = lv_font_get_bitmap_fmt_txt;
+    font->line_height = h.line_height;
+    font->base_line = h.base_line;
+    font->subpx = h.subpx;
+    font->underline_position = h.underline_position;
+    font->underline_thickness = h.underline_thickness;
+    font->dsc = dsc;
+    font->user_data = (void *)pack_font_tag;
+    return font;
+}
+
+lv_font_t *asset_pack_font_create(const asset_pack_t *pack, const char *name) {
+    const asset_pack_entry_t *e = asset_pack_find(pack, name);
+    if (e == NULL) return NULL;
+
+    const uint8_t *data = pack->base + e->offset;
+    if (e->type == ASSET_TYPE_FONT) return font_create_fmt_txt(data, e->size);
+
+#if LV_USE_FS_MEMFS
+    // 原始.bin字体: 经内存文件系统交给LVGL的加载器, 字形数据会拷贝到堆
+    if (e->type == ASSET_TYPE_FONT_BIN) return lv_binfont_create_from_buffer((void *)data, e->size);
+#endif
+    return NULL;
+}
+
+void asset_pack_font_destroy(lv_font_t *font) {
+    if (font == NULL) return;
+
+    // pack_font_t 的第一个成员就是字体本身
+    if (font->user_data == pack_font_tag) lv_free(font);
+    else lv_binfont_destroy(font);
+}
@@ -0,0 +1,99 @@
+#ifndef ASSET_PACK_H
+#define ASSET_PACK_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "lvgl.h"
+
+// 资源包: 表盘用到的图片和字体打包成一个带索引的二进制文件, 由 tools/asset_pack.py 生成。
+// 设备端直接从XIP flash读取(原地访问, 不拷贝), 主机端用mmap映射文件。
+// 更换表盘只需重新烧录资源包所在的flash区域, 不用重新编译固件。
+//
+// 文件格式(小端):
+//   包头 asset_pack_header_t
+//   索引 asset_pack_entry_t[entry_cnt], 按名称排序(二分查找)
+//   数据 每项按 ASSET_PACK_ALIGN 对齐
+//
+// 图片项是LVGL的.bin图片(12字节头 + 像素, 可选RLE/LZ4压缩), 像素数据起始地址对齐;
+// 未压缩的图片交给LVGL的bin解码器时直接使用flash中的像素, 不占堆;
+// 调色板图片(I1/I2/I4/I8)不做变换时由软件渲染器按调色板直接混合到RGB565, 同样不展开;
+// 按行带压缩的图片绘制时只解压当前条带用到的行带, 堆上只需一个行带大小的缓冲;
+// 整图压缩的图片需要 LV_BIN_DECODER_RAM_LOAD, 打开时整图解压到堆上。
+// 字体项是打包工具从lv_font_conv的.bin字体预解析出的 lv_font_fmt_txt 布局,
+// 字形描述/位图/cmap列表都留在包里, 加载时只在堆上分配几个很小的描述结构。
+
+#define ASSET_PACK_MAGIC        0x4b504157u  // "WAPK"
+#define ASSET_PACK_VERSION      1
+#define ASSET_PACK_ALIGN        16
+#define ASSET_PACK_NAME_MAX     20
+
+// 设备端资源包在flash中的偏移(固件占用前1MB)
+#define ASSET_PACK_FLASH_OFFSET (1024u * 1024u)
+
+// 资源类型
+typedef enum {
+    ASSET_TYPE_IMAGE    = 1,    // LVGL .bin图片
+    ASSET_TYPE_FONT     = 2,    // 预解析字体(零拷贝)
+    ASSET_TYPE_FONT_BIN = 3,    // 原始.bin字体, 经 lv_binfont_loader 加载(会拷贝到堆)
+    ASSET_TYPE_RAW      = 4,    // 其他数据
+} asset_type_t;
+
+// 包头
+typedef struct {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t entry_cnt;
+    uint32_t size;          // 整个包的字节数
+    uint32_t reserved;
+} asset_pack_header_t;
+
+// 索引项
+typedef struct {
+    char name[ASSET_PACK_NAME_MAX];     // 以'\0'结尾
+    uint8_t type;                       // asset_type_t
+    uint8_t reserved[3];
+    uint32_t offset;                    // 相对包头
+    uint32_t size;
+} asset_pack_entry_t;
+
+// 已打开的资源包
+typedef struct {
+    const uint8_t *base;
+    uint32_t size;
+    const asset_pack_entry_t *entries;
+    uint16_t entry_cnt;
+    lv_image_dsc_t *images;     // 每个索引项一个, 只有图片项有效
+    size_t map_len;             // 主机端mmap映射的长度, 0表示不是mmap打开的
+} asset_pack_t;
+
+// 打开内存中的资源包(data需4字节对齐, 在关闭前保持有效), 成功返回true
+bool asset_pack_open_mem(asset_pack_t *pack, const void *data, uint32_t size);
+
+#if defined(PICO_ON_DEVICE) && PICO_ON_DEVICE
+// 打开flash中 ASSET_PACK_FLASH_OFFSET 处的资源包(XIP地址, 零拷贝)
+bool asset_pack_open_flash(asset_pack_t *pack);
+#else
+// 用mmap打开资源包文件
+bool asset_pack_open_file(asset_pack_t *pack, const char *path);
+#endif
+
+// 关闭资源包; 之前取得的图片和字体必须先不再使用
+void asset_pack_close(asset_pack_t *pack);
+
+// 按名称查找索引项, 找不到返回NULL
+const asset_pack_entry_t *asset_pack_find(const asset_pack_t *pack, const char *name);
+
+// 取数据指针, 长度为 entry->size
+const void *asset_pack_get_data(const asset_pack_t *pack, const asset_pack_entry_t *entry);
+
+// 取图片, 可直接传给 lv_image_set_src(); 找不到或不是图片返回NULL
+const lv_image_dsc_t *asset_pack_get_image(const asset_pack_t *pack, const char *name);
+
+// 创建字体, 用完后调用 asset_pack_font_destroy(); 找不到或格式不对返回NULL
+lv_font_t *asset_pack_font_create(const asset_pack_t *pack, const char *name);
+
+// 释放 asset_pack_font_create() 创建的字体
+void asset_pack_font_destroy(lv_font_t *font);
+
+#endif // ASSET_PACK_H
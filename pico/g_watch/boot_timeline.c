@@ -0,0 +1,40 @@
+#include "boot_timeline.h"
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+// 启动时间线, 见 boot_timeline.h
+
+typedef struct {
+    const char *stage;
+    uint64_t us;
+} boot_stage_t;
+
+static boot_stage_t stages[BOOT_TIMELINE_MAX];
+static uint32_t count;
+
+void boot_mark(const char *stage) {
+    // 闹钟中断里的面板初始化也会记录, 关中断保证时间和顺序一致
+    uint32_t irq = save_and_disable_interrupts();
+    if (count < BOOT_TIMELINE_MAX) {
+        stages[count].stage = stage;
+        stages[count].us = time_us_64();
+        count++;
+    }
+    restore_interrupts(irq);
+}
+
+void boot_timeline_print(void) {
+    uint32_t irq = save_and_disable_interrupts();
+    uint32_t n = count;
+    restore_interrupts(irq);
+
+    uint64_t prev = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        uint64_t us = stages[i].us;
+        printf("boot %4llu.%03llu ms (+%4llu.%03llu ms) %s\n", us / 1000, us % 1000,
+               (us - prev) / 1000, (us - prev) % 1000, stages[i].stage);
+        prev = us;
+    }
+    printf("boot end\n");
+}
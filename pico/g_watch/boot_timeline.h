@@ -0,0 +1,21 @@
+#ifndef BOOT_TIMELINE_H
+#define BOOT_TIMELINE_H
+
+#include <stdint.h>
+
+// 启动时间线: 记录启动过程中每个阶段完成的时间(time_us_64(), 从上电算起), 启动完成后通过stdio输出:
+//   boot   12.345 ms (+  3.210 ms) lvgl init
+//   ...
+//   boot end
+// 面板复位和睡眠退出由闹钟推进(lcd_init_async), 和LVGL初始化、第一帧渲染交错执行,
+// 所以阶段按记录的先后排列, 不一定是代码里的顺序。
+
+#define BOOT_TIMELINE_MAX   16
+
+// 记录一个阶段, stage要是常量字符串; 可以在中断中调用, 超过 BOOT_TIMELINE_MAX 个的记录被丢弃
+void boot_mark(const char *stage);
+
+// 输出时间线
+void boot_timeline_print(void);
+
+#endif // BOOT_TIMELINE_H
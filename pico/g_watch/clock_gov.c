@@ -0,0 +1,107 @@
+#include "clock_gov.h"
+#include <string.h>
+
+static clock_gov_cfg_t cfg;
+static uint8_t level;
+static uint16_t down_cnt;
+static uint32_t last_frame_us;
+static uint32_t level_start_us;
+static clock_gov_stats_t stats;
+
+void clock_gov_init(const clock_gov_cfg_t *c, uint32_t now_us) {
+    cfg = *c;
+    if (cfg.count > CLOCK_GOV_MAX_LEVELS) cfg.count = CLOCK_GOV_MAX_LEVELS;
+    level = cfg.start < cfg.count ? cfg.start : cfg.count - 1;
+    down_cnt = 0;
+    last_frame_us = now_us;
+    level_start_us = now_us;
+    memset(&stats, 0, sizeof(stats));
+}
+
+static uint32_t pct_of_budget(uint8_t pct) {
+    return (uint32_t)((uint64_t)cfg.budget_us * pct / 100);
+}
+
+uint32_t clock_gov_predict(const clock_gov_frame_t *f, uint8_t to) {
+    const clock_gov_level_t *cur = &cfg.levels[level];
+    const clock_gov_level_t *l = &cfg.levels[to];
+    uint32_t r = (uint32_t)((uint64_t)f->render_us * cur->sys_khz / l->sys_khz);
+    uint32_t w = (uint32_t)((uint64_t)f->write_us * cur->write_hz / l->write_hz);
+    if (cfg.overlap) return r > w ? r : w;
+    return r + w;
+}
+
+// 累计当前工作点的时间, 每次调用都结算, 两次调用之间不能超过32位微秒计数的回绕周期
+static void account(uint32_t now_us) {
+    stats.level_us[level] += now_us - level_start_us;
+    level_start_us = now_us;
+}
+
+static void set_level(uint8_t to) {
+    if (to == level) return;
+    if (to > level) stats.ups++;
+    else stats.downs++;
+    level = to;
+    down_cnt = 0;
+}
+
+uint8_t clock_gov_frame(const clock_gov_frame_t *f, uint32_t now_us) {
+    account(now_us);
+    stats.frames++;
+    last_frame_us = now_us;
+
+    uint32_t load = clock_gov_predict(f, level);
+    if (load > cfg.budget_us) stats.over++;
+
+    if (load > pct_of_budget(cfg.up_pct)) {
+        // 直接换到预测负载不超过 fit_pct 的最低工作点, 动画开始的第一帧之后就跟上。
+        // 写入速率不随系统时钟单调变化(SPI分频取整), 所以所有工作点都要比较;
+        // 都满足不了时取预测负载最小的
+        uint8_t to = level;
+        uint32_t best = load;
+        for (uint8_t l = 0; l < cfg.count; l++) {
+            uint32_t p = clock_gov_predict(f, l);
+            if (p <= pct_of_budget(cfg.fit_pct)) {
+                to = l;
+                break;
+            }
+            if (p < best) {
+                best = p;
+                to = l;
+            }
+        }
+        set_level(to);
+        down_cnt = 0;
+    } else if (level > 0 && clock_gov_predict(f, level - 1) <= pct_of_budget(cfg.down_pct)) {
+        if (++down_cnt >= cfg.down_frames) set_level(level - 1);
+    } else {
+        down_cnt = 0;
+    }
+    return level;
+}
+
+uint8_t clock_gov_idle(uint32_t now_us) {
+    account(now_us);
+    if (level > 0 && now_us - last_frame_us >= cfg.idle_us) set_level(0);
+    return level;
+}
+
+uint8_t clock_gov_get_level(void) {
+    return level;
+}
+
+void clock_gov_get_stats(clock_gov_stats_t *s, uint32_t now_us) {
+    account(now_us);
+    *s = stats;
+}
+
+uint32_t clock_gov_spi_hz(uint32_t peri_hz, uint32_t max_hz) {
+    uint32_t prescale, postdiv;
+    for (prescale = 2; prescale <= 254; prescale += 2) {
+        if (peri_hz < prescale * 256ull * max_hz) break;
+    }
+    for (postdiv = 256; postdiv > 1; --postdiv) {
+        if (peri_hz / (prescale * (postdiv - 1)) > max_hz) break;
+    }
+    return peri_hz / (prescale * postdiv);
+}
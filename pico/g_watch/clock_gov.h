@@ -0,0 +1,79 @@
+#ifndef CLOCK_GOV_H
+#define CLOCK_GOV_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// 帧预算调速器: 按每帧实测的渲染和写入时间, 选择刚好能在帧期限内完成的最低系统时钟
+// 表盘大部分时间是静止的(每秒只刷新一小块), 没有必要一直跑在125MHz; 滑动等动画时再升频。
+// 每帧把渲染时间(CPU, 随系统时钟缩放)和写入面板的时间(随SPI/PIO位速率缩放)分开, 换算到各个工作点:
+//   渲染' = 渲染 * 当前sys_khz / 目标sys_khz, 写入' = 写入 * 当前write_hz / 目标write_hz
+//   负载 = 渲染' + 写入'(阻塞写入), 或 max(渲染', 写入')(异步写入和渲染重叠)
+// 策略(带迟滞):
+//   - 当前工作点的负载超过预算的 up_pct%: 立即换到预测负载不超过 fit_pct% 的最低工作点(可以跨多级),
+//     都不满足时换到预测负载最小的工作点(硬件SPI的分频取整使72MHz比96MHz写得更快)
+//   - 低一级工作点的预测负载连续 down_frames 帧都不超过 down_pct%: 降一级
+//   - 超过 idle_us 没有帧(表盘静止): 降到最低工作点
+// 不依赖SDK: 设备端由 main.c 测量并切换时钟, 主机端 test/clock_gov_sim.c 用模型评估策略。
+// 所有时间都是微秒, 使用回绕安全的32位计数(设备端 time_us_32())。
+
+#define CLOCK_GOV_MAX_LEVELS    8
+
+// 工作点
+typedef struct {
+    uint32_t sys_khz;           // 系统时钟, 外设时钟跟随
+    uint32_t write_hz;          // 这个时钟下写面板的实际位速率(按分频取整)
+    uint16_t mv;                // 核心电压
+} clock_gov_level_t;
+
+// 配置
+typedef struct {
+    const clock_gov_level_t *levels;    // 按 sys_khz 从低到高
+    uint8_t count;
+    uint8_t start;              // 初始工作点(启动时的时钟)
+    bool overlap;               // 写入是否和渲染重叠(异步传输后端)
+    uint32_t budget_us;         // 帧期限(刷新周期)
+    uint8_t up_pct;
+    uint8_t fit_pct;
+    uint8_t down_pct;
+    uint16_t down_frames;
+    uint32_t idle_us;
+} clock_gov_cfg_t;
+
+// 一帧的测量, 都是在当前工作点下的时间
+typedef struct {
+    uint32_t render_us;         // LVGL渲染的CPU时间(不含等待写入和等待扫描线)
+    uint32_t write_us;          // 各窗口写入面板的时间之和
+} clock_gov_frame_t;
+
+// 统计
+typedef struct {
+    uint32_t frames;
+    uint32_t over;              // 负载超过预算的帧数
+    uint32_t ups;
+    uint32_t downs;
+    uint64_t level_us[CLOCK_GOV_MAX_LEVELS];   // 各工作点累计的时间
+} clock_gov_stats_t;
+
+// 初始化
+void clock_gov_init(const clock_gov_cfg_t *cfg, uint32_t now_us);
+
+// 一帧渲染并写完后调用, 返回应该运行的工作点; 和当前不同时调用者要切换时钟
+uint8_t clock_gov_frame(const clock_gov_frame_t *f, uint32_t now_us);
+
+// 主循环空闲时调用, 返回应该运行的工作点
+uint8_t clock_gov_idle(uint32_t now_us);
+
+// 当前工作点
+uint8_t clock_gov_get_level(void);
+
+// 预测一帧在某个工作点的负载
+uint32_t clock_gov_predict(const clock_gov_frame_t *f, uint8_t level);
+
+// 读取统计
+void clock_gov_get_stats(clock_gov_stats_t *stats, uint32_t now_us);
+
+// 和SDK的 spi_set_baudrate() 相同的分频选择: 外设时钟 peri_hz 下不超过 max_hz 的实际SPI速率
+uint32_t clock_gov_spi_hz(uint32_t peri_hz, uint32_t max_hz);
+
+#endif // CLOCK_GOV_H
@@ -0,0 +1,31 @@
+#include "face_table.h"
+
+// 表盘对象表, 见 face_table.h
+
+void face_table_build(const face_table_obj_t *table, uint32_t count, lv_obj_t *parent, lv_obj_t **objs) {
+    for (uint32_t i = 0; i < count; i++) {
+        const face_table_obj_t *d = &table[i];
+        lv_obj_t *p = d->parent == FACE_TABLE_ROOT ? parent : objs[d->parent];
+        lv_obj_t *obj;
+
+        switch (d->type) {
+            case FACE_TABLE_LABEL:
+                obj = lv_label_create(p);
+                if (d->text) lv_label_set_text_static(obj, d->text);
+                break;
+            case FACE_TABLE_LINE:
+                obj = lv_line_create(p);
+                if (d->points) lv_line_set_points(obj, d->points, d->point_count);
+                break;
+            case FACE_TABLE_OBJ:
+            default:
+                obj = lv_obj_create(p);
+                break;
+        }
+
+        // 后添加的样式优先级高: 布局样式在外观样式之上, 和原来的本地样式一样
+        if (d->style) lv_obj_add_style(obj, d->style, 0);
+        if (d->layout) lv_obj_add_style(obj, d->layout, 0);
+        objs[i] = obj;
+    }
+}
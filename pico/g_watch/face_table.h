@@ -0,0 +1,38 @@
+#ifndef FACE_TABLE_H
+#define FACE_TABLE_H
+
+#include <stdint.h>
+#include "lvgl.h"
+
+// 表盘对象表
+// 表盘用JSON描述(样式和控件树), tools/face_gen.py 把它编译成C代码:
+//   - 每个样式是一个 LV_STYLE_CONST_INIT 常量, 属性数组是const, 放在flash中, 运行时不占堆
+//   - 控件的大小、位置、对齐和旋转也编译成常量"布局"样式, 代替 lv_obj_set_size/lv_obj_align 等
+//     产生的本地样式(每个控件一份堆上的 lv_style_t)
+//   - 控件按创建顺序排成一张平铺的表, 父控件用下标引用
+// 运行时 face_table_build() 按表创建控件、挂上常量样式, 不调用 lv_style_init/lv_style_set_*。
+// 常量样式不能修改; 运行时要变的属性(如指针的旋转角度)仍然用 lv_obj_set_style_* 设置。
+// 不依赖SDK; 目前用于模拟器表盘(test/sim_face.json), 固件表盘也可以用同样的方式生成。
+
+#define FACE_TABLE_ROOT     0xff        // 父控件为 face_table_build() 的 parent
+
+typedef enum {
+    FACE_TABLE_OBJ,
+    FACE_TABLE_LABEL,
+    FACE_TABLE_LINE,
+} face_table_type_t;
+
+typedef struct {
+    uint8_t type;                           // face_table_type_t
+    uint8_t parent;                         // 父控件在表中的下标(在它之前), 或 FACE_TABLE_ROOT
+    uint8_t point_count;
+    const lv_style_t *style;                // 外观样式, 多个控件可以共用, 可以为NULL
+    const lv_style_t *layout;               // 布局样式, 可以为NULL
+    const char *text;                       // 标签的文本, 不复制(lv_label_set_text_static)
+    const lv_point_precise_t *points;       // 线段的端点, 不复制
+} face_table_obj_t;
+
+// 按表在parent上创建 count 个控件, objs[i] 为第i个控件
+void face_table_build(const face_table_obj_t *table, uint32_t count, lv_obj_t *parent, lv_obj_t **objs);
+
+#endif // FACE_TABLE_H
@@ -0,0 +1,222 @@
+#include "frame_pacer.h"
+#include <string.h>
+
+// 每行写入时间用1/16微秒的定点数保存, 避免小数被截断
+#define LINE_Q4_SHIFT   4
+
+static frame_pacer_cfg_t cfg;
+
+// 以下由TE中断更新; edge_seq 在更新期间为奇数, 读取方据此判断是否读到一致的快照
+static volatile uint32_t edge_seq;
+static volatile uint32_t last_edge_us;
+static volatile uint32_t period_us;
+static volatile uint32_t edge_cnt;
+
+// 以下仅UI线程访问
+static uint32_t line_write_q4;
+static bool anchored;
+static uint32_t anchor_us;          // 当前帧对齐的那次扫描的起点
+static uint32_t refr_edge_cnt;      // 上次刷新时的 edge_cnt
+static uint32_t last_refr_us;
+static frame_pacer_stats_t stats;
+
+// 读取TE状态的一致快照
+static void te_snapshot(uint32_t *edge, uint32_t *period, uint32_t *cnt) {
+    uint32_t seq;
+    do {
+        seq = edge_seq;
+        *edge = last_edge_us;
+        *period = period_us;
+        *cnt = edge_cnt;
+    } while ((seq & 1) || seq != edge_seq);
+}
+
+static bool te_synced(uint32_t edge, uint32_t period, uint32_t cnt, uint32_t now_us) {
+    // 超过4个周期没有TE沿则认为信号中断
+    return cnt >= 2 && now_us - edge < 4 * period;
+}
+
+// 扫描线从一帧开始到达第y行的时间
+static int32_t scan_time(uint16_t y, uint32_t period) {
+    return (int32_t)((uint32_t)y * period / cfg.lines);
+}
+
+// 窗口能否对齐到从 start(相对当前时间)开始的那次扫描: 每一行都要在这次扫描读过之后开始写、
+// 在下一次扫描读到之前写完。第r行在 t0 + (r - y1) * line 开始写, 一行之后写完。
+// 写入速度和扫描速度都是线性的, 只需检查首尾两行。
+static bool window_fits(int32_t start, uint32_t period, uint16_t y1, uint16_t y2, int32_t line,
+                        int32_t *delay) {
+    int32_t s1 = scan_time(y1, period);
+    int32_t s2 = scan_time(y2, period);
+    int32_t span = (int32_t)(y2 - y1) * line;
+
+    int32_t lo = start + (s1 > s2 - span ? s1 : s2 - span) + (int32_t)cfg.margin_us;
+    int32_t hi = start + (int32_t)period + (s1 < s2 - span ? s1 : s2 - span) - line - (int32_t)cfg.margin_us;
+
+    int32_t t0 = lo > 0 ? lo : 0;
+    if (t0 >= hi) return false;
+
+    *delay = t0;
+    return true;
+}
+
+void frame_pacer_init(const frame_pacer_cfg_t *c) {
+    cfg = *c;
+    if (cfg.lines == 0) cfg.lines = 1;
+    if (cfg.refr_div == 0) cfg.refr_div = 1;
+
+    edge_seq = 0;
+    last_edge_us = 0;
+    period_us = cfg.period_us;
+    edge_cnt = 0;
+
+    line_write_q4 = cfg.line_write_us << LINE_Q4_SHIFT;
+    anchored = false;
+    refr_edge_cnt = 0;
+    last_refr_us = 0;
+    memset(&stats, 0, sizeof(stats));
+}
+
+void frame_pacer_te_edge(uint32_t now_us) {
+    uint32_t delta = now_us - last_edge_us;
+    // 抖动产生的假沿
+    if (edge_cnt > 1 && delta < period_us / 2) return;
+
+    edge_seq++;
+    if (edge_cnt == 1) {
+        // 第一个间隔直接作为周期, 配置的初值可能和面板实际帧率相差较大
+        period_us = delta;
+    } else if (edge_cnt > 1) {
+        // 漏掉的沿按整数倍周期折算, 间隔太长(信号中断过)则不参与估计
+        uint32_t n = (delta + period_us / 2) / period_us;
+        if (n >= 1 && n <= 4) {
+            int32_t diff = (int32_t)(delta / n) - (int32_t)period_us;
+            period_us = (uint32_t)((int32_t)period_us + diff / 8);
+        }
+    }
+    last_edge_us = now_us;
+    edge_cnt++;
+    edge_seq++;
+}
+
+bool frame_pacer_is_synced(uint32_t now_us) {
+    uint32_t edge, period, cnt;
+    te_snapshot(&edge, &period, &cnt);
+    return te_synced(edge, period, cnt, now_us);
+}
+
+uint32_t frame_pacer_get_period_us(void) {
+    uint32_t edge, period, cnt;
+    te_snapshot(&edge, &period, &cnt);
+    return period;
+}
+
+uint16_t frame_pacer_get_scanline(uint32_t now_us) {
+    uint32_t edge, period, cnt;
+    te_snapshot(&edge, &period, &cnt);
+    if (!te_synced(edge, period, cnt, now_us)) return 0;
+
+    uint32_t t = (now_us - edge) % period;
+    return (uint16_t)(t * cfg.lines / period);
+}
+
+uint32_t frame_pacer_get_delay(uint16_t y1, uint16_t y2, uint32_t now_us) {
+    uint32_t edge, period, cnt;
+    te_snapshot(&edge, &period, &cnt);
+    if (!te_synced(edge, period, cnt, now_us)) {
+        anchored = false;
+        return 0;
+    }
+
+    if (y2 < y1) {
+        uint16_t tmp = y1;
+        y1 = y2;
+        y2 = tmp;
+    }
+
+    stats.windows++;
+    int32_t line = (int32_t)((line_write_q4 + (1 << LINE_Q4_SHIFT) - 1) >> LINE_Q4_SHIFT);
+    int32_t delay = 0;
+    bool found = false;
+
+    // 同一帧的窗口对齐到同一次扫描
+    if (anchored) {
+        found = window_fits((int32_t)(anchor_us - now_us), period, y1, y2, line, &delay);
+        if (!found) stats.slips++;
+    }
+
+    // 找到最早能容纳窗口的一次扫描作为锚点: 从正在进行的那次开始, 跟在扫描线后面写。
+    // 写入(含渲染)比扫描慢, 抢在扫描线前面写的话, 后面的窗口很快会被扫描线追上;
+    // 跟在后面写, 扫描线会一直领先, 直到下一次扫描开始。
+    int32_t base = (int32_t)(edge - now_us);
+    int32_t k;
+    for (k = 0; !found && k <= 3; k++) {
+        int32_t start = base + k * (int32_t)period;
+        if (window_fits(start, period, y1, y2, line, &delay)) {
+            anchor_us = now_us + (uint32_t)start;
+            anchored = true;
+            found = true;
+        }
+    }
+
+    // 窗口太高, 无法在两次扫描之间写完: 从下一个TE沿开始跟在扫描线后面写
+    if (!found) {
+        delay = base + (int32_t)period;
+        while (delay < 0) delay += (int32_t)period;
+        anchor_us = now_us + (uint32_t)delay;
+        anchored = true;
+    }
+
+    if (delay > 0) {
+        stats.waits++;
+        stats.wait_us += (uint32_t)delay;
+    }
+    return (uint32_t)delay;
+}
+
+void frame_pacer_flush_done(uint16_t rows, uint32_t write_us, bool last) {
+    // 太小的窗口主要是命令开销, 不参与估计
+    if (rows >= 8) {
+        uint32_t q4 = (write_us << LINE_Q4_SHIFT) / rows;
+        int32_t diff = (int32_t)q4 - (int32_t)line_write_q4;
+        line_write_q4 = (uint32_t)((int32_t)line_write_q4 + diff / 8);
+    }
+
+    if (last) anchored = false;
+}
+
+bool frame_pacer_refr_due(uint32_t now_us) {
+    uint32_t edge, period, cnt;
+    te_snapshot(&edge, &period, &cnt);
+
+    if (te_synced(edge, period, cnt, now_us)) {
+        if (cnt - refr_edge_cnt < cfg.refr_div) return false;
+    } else {
+        if (now_us - last_refr_us < cfg.fallback_us) return false;
+    }
+
+    refr_edge_cnt = cnt;
+    last_refr_us = now_us;
+    return true;
+}
+
+uint32_t frame_pacer_get_idle_us(uint32_t now_us) {
+    uint32_t edge, period, cnt;
+    te_snapshot(&edge, &period, &cnt);
+
+    int32_t idle;
+    if (te_synced(edge, period, cnt, now_us)) {
+        uint32_t passed = cnt - refr_edge_cnt;
+        uint32_t need = passed < cfg.refr_div ? cfg.refr_div - passed : 0;
+        idle = (int32_t)(edge + need * period - now_us);
+    } else {
+        idle = (int32_t)(last_refr_us + cfg.fallback_us - now_us);
+    }
+
+    return idle > 0 ? (uint32_t)idle : 0;
+}
+
+void frame_pacer_get_stats(frame_pacer_stats_t *s) {
+    *s = stats;
+    s->edges = edge_cnt;
+}
@@ -0,0 +1,64 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// 帧节拍器: 按面板的TE(撕裂效应)信号安排LVGL刷新和 disp_flush() 的写入时机
+// TE上升沿表示面板开始新一帧的扫描, 之后扫描线每隔 period/lines 微秒前进一行。
+// 一个窗口的每一行都必须在扫描线读完它之后、下一次扫描到它之前写入, 这样整个窗口
+// 要么全部显示旧内容, 要么全部显示新内容, 不会撕裂。同一次LVGL刷新的所有窗口
+// 都对齐到同一次扫描(锚点), 因此整帧的更新一起出现。
+// 不依赖SDK: 设备端由GPIO中断提供TE沿, 主机端可以用虚拟时钟模拟TE沿进行测试。
+// 所有时间都是微秒, 使用回绕安全的32位计数(设备端 time_us_32())。
+
+// 配置
+typedef struct {
+    uint16_t lines;             // 面板行数
+    uint32_t period_us;         // TE周期的初值, 收到TE沿后按实测值修正
+    uint32_t line_write_us;     // 写一行像素的时间初值(按SPI速率估算), 之后按实际flush时间修正
+    uint32_t margin_us;         // 安全余量, 吸收TE中断延迟和估算误差
+    uint8_t refr_div;           // 每 refr_div 个TE周期刷新一次LVGL
+    uint32_t fallback_us;       // 没有TE信号时的刷新周期
+} frame_pacer_cfg_t;
+
+// 统计
+typedef struct {
+    uint32_t edges;             // 收到的TE沿数
+    uint32_t windows;           // 安排过的窗口数
+    uint32_t waits;             // 需要等待的窗口数
+    uint32_t wait_us;           // 累计等待时间
+    uint32_t slips;             // 无法对齐到当前锚点而换到下一次扫描的窗口数(整帧可能在此处撕裂)
+} frame_pacer_stats_t;
+
+// 初始化(在使能TE中断之前调用)
+void frame_pacer_init(const frame_pacer_cfg_t *cfg);
+
+// TE上升沿, 可以在中断中调用
+void frame_pacer_te_edge(uint32_t now_us);
+
+// 是否与TE信号同步(至少收到2个沿且信号没有中断)
+bool frame_pacer_is_synced(uint32_t now_us);
+
+// 当前的TE周期估计值
+uint32_t frame_pacer_get_period_us(void);
+
+// 面板当前扫描的行(未同步时返回0)
+uint16_t frame_pacer_get_scanline(uint32_t now_us);
+
+// 写入 y1..y2 行的窗口前需要等待的微秒数; 同一帧的第一个窗口决定锚点
+uint32_t frame_pacer_get_delay(uint16_t y1, uint16_t y2, uint32_t now_us);
+
+// 窗口写完后调用: 用实际耗时修正每行写入时间; last为true表示一帧的最后一个窗口
+void frame_pacer_flush_done(uint16_t rows, uint32_t write_us, bool last);
+
+// 是否应该开始下一次LVGL刷新(UI线程轮询)
+bool frame_pacer_refr_due(uint32_t now_us);
+
+// 距离下一次刷新的微秒数, 用于主循环休眠
+uint32_t frame_pacer_get_idle_us(uint32_t now_us);
+
+// 读取统计
+void frame_pacer_get_stats(frame_pacer_stats_t *stats);
+
+#endif // FRAME_PACER_H
@@ -0,0 +1,23 @@
+#include "interp_emu.h"
+#include <assert.h>
+
+// RP2040插值器的主机端仿真, 见 interp_emu.h
+
+interp_hw_t interp_emu_hw[2];
+
+void interp_set_config(interp_hw_t *interp, unsigned lane, interp_config *config) {
+    assert(lane < 2);
+    // 混合和钳位模式没有仿真
+    assert(!(config->ctrl & (INTERP_EMU_BLEND_BITS | INTERP_EMU_CLAMP_BITS)));
+    interp->ctrl[lane] = config->ctrl;
+}
+
+// BASE_1AND0: 低16位写BASE0, 高16位写BASE1, 通道是有符号模式时各自符号扩展
+void interp_set_base_both(interp_hw_t *interp, uint32_t val) {
+    uint32_t b0 = val & 0xffffu;
+    uint32_t b1 = val >> 16;
+    if ((interp->ctrl[0] & INTERP_EMU_SIGNED_BITS) && (b0 & 0x8000u)) b0 |= 0xffff0000u;
+    if ((interp->ctrl[1] & INTERP_EMU_SIGNED_BITS) && (b1 & 0x8000u)) b1 |= 0xffff0000u;
+    interp->base[0] = b0;
+    interp->base[1] = b1;
+}
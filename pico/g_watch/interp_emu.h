@@ -0,0 +1,163 @@
+#ifndef INTERP_EMU_H
+#define INTERP_EMU_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// RP2040硬件插值器(SIO INTERP0/1)的主机端仿真, 接口和SDK的 hardware/interp.h 同名,
+// 同一份代码在设备上用硬件、在主机上用这里的仿真, 结果逐位一致。
+// 每个通道(lane)的计算:
+//   输入   = CROSS_INPUT ? 另一个通道的累加器 : 本通道的累加器
+//   结果   = (ADD_RAW ? 输入 : 符号扩展((输入 >> SHIFT) & MASK)) + BASE
+//   FULL   = 两个通道移位屏蔽后的值 + BASE2 (不受ADD_RAW影响)
+//   pop    读结果的同时把结果写回累加器(CROSS_RESULT时交叉写回)
+// 移位是逻辑右移; FORCE_MSB只影响读出的通道结果, 不写回累加器。
+// 没有仿真: BLEND(INTERP0)、CLAMP(INTERP1)和通道认领, 配置了这两位时断言失败。
+// 仿真的状态是全局的, 相当于只有一个核使用插值器。
+
+typedef struct {
+    uint32_t accum[2];
+    uint32_t base[3];
+    uint32_t ctrl[2];
+} interp_hw_t;
+
+typedef struct {
+    uint32_t ctrl;
+} interp_config;
+
+extern interp_hw_t interp_emu_hw[2];
+
+#define interp0 (&interp_emu_hw[0])
+#define interp1 (&interp_emu_hw[1])
+
+// CTRL_LANE寄存器的位域, 和 SIO_INTERP0_CTRL_LANE0_* 相同
+#define INTERP_EMU_SHIFT_BITS           0x0000001fu
+#define INTERP_EMU_MASK_LSB_LSB         5
+#define INTERP_EMU_MASK_LSB_BITS        0x000003e0u
+#define INTERP_EMU_MASK_MSB_LSB         10
+#define INTERP_EMU_MASK_MSB_BITS        0x00007c00u
+#define INTERP_EMU_SIGNED_BITS          0x00008000u
+#define INTERP_EMU_CROSS_INPUT_BITS     0x00010000u
+#define INTERP_EMU_CROSS_RESULT_BITS    0x00020000u
+#define INTERP_EMU_ADD_RAW_BITS         0x00040000u
+#define INTERP_EMU_FORCE_MSB_LSB        19
+#define INTERP_EMU_FORCE_MSB_BITS       0x00180000u
+#define INTERP_EMU_BLEND_BITS           0x00200000u
+#define INTERP_EMU_CLAMP_BITS           0x00400000u
+
+static inline void interp_config_set_shift(interp_config *c, unsigned shift) {
+    c->ctrl = (c->ctrl & ~INTERP_EMU_SHIFT_BITS) | (shift & INTERP_EMU_SHIFT_BITS);
+}
+
+static inline void interp_config_set_mask(interp_config *c, unsigned mask_lsb, unsigned mask_msb) {
+    c->ctrl = (c->ctrl & ~(INTERP_EMU_MASK_LSB_BITS | INTERP_EMU_MASK_MSB_BITS)) |
+              ((mask_lsb << INTERP_EMU_MASK_LSB_LSB) & INTERP_EMU_MASK_LSB_BITS) |
+              ((mask_msb << INTERP_EMU_MASK_MSB_LSB) & INTERP_EMU_MASK_MSB_BITS);
+}
+
+static inline void interp_config_set_cross_input(interp_config *c, bool cross_input) {
+    c->ctrl = (c->ctrl & ~INTERP_EMU_CROSS_INPUT_BITS) | (cross_input ? INTERP_EMU_CROSS_INPUT_BITS : 0);
+}
+
+static inline void interp_config_set_cross_result(interp_config *c, bool cross_result) {
+    c->ctrl = (c->ctrl & ~INTERP_EMU_CROSS_RESULT_BITS) | (cross_result ? INTERP_EMU_CROSS_RESULT_BITS : 0);
+}
+
+static inline void interp_config_set_signed(interp_config *c, bool _signed) {
+    c->ctrl = (c->ctrl & ~INTERP_EMU_SIGNED_BITS) | (_signed ? INTERP_EMU_SIGNED_BITS : 0);
+}
+
+static inline void interp_config_set_add_raw(interp_config *c, bool add_raw) {
+    c->ctrl = (c->ctrl & ~INTERP_EMU_ADD_RAW_BITS) | (add_raw ? INTERP_EMU_ADD_RAW_BITS : 0);
+}
+
+static inline void interp_config_set_force_bits(interp_config *c, unsigned bits) {
+    c->ctrl = (c->ctrl & ~INTERP_EMU_FORCE_MSB_BITS) | ((bits << INTERP_EMU_FORCE_MSB_LSB) & INTERP_EMU_FORCE_MSB_BITS);
+}
+
+static inline interp_config interp_default_config(void) {
+    interp_config c = {0};
+    interp_config_set_mask(&c, 0, 31);
+    return c;
+}
+
+void interp_set_config(interp_hw_t *interp, unsigned lane, interp_config *config);
+
+static inline void interp_set_base(interp_hw_t *interp, unsigned lane, uint32_t val) {
+    interp->base[lane] = val;
+}
+
+static inline uint32_t interp_get_base(interp_hw_t *interp, unsigned lane) {
+    return interp->base[lane];
+}
+
+void interp_set_base_both(interp_hw_t *interp, uint32_t val);
+
+static inline void interp_set_accumulator(interp_hw_t *interp, unsigned lane, uint32_t val) {
+    interp->accum[lane] = val;
+}
+
+static inline uint32_t interp_get_accumulator(interp_hw_t *interp, unsigned lane) {
+    return interp->accum[lane];
+}
+
+static inline void interp_add_accumulator(interp_hw_t *interp, unsigned lane, uint32_t val) {
+    interp->accum[lane] += val;
+}
+
+// 通道移位屏蔽(并符号扩展)后的值, 不加BASE
+static inline uint32_t interp_emu_shift_mask(const interp_hw_t *interp, unsigned lane) {
+    uint32_t ctrl = interp->ctrl[lane];
+    uint32_t in = interp->accum[(ctrl & INTERP_EMU_CROSS_INPUT_BITS) ? 1 - lane : lane];
+    unsigned lsb = (ctrl & INTERP_EMU_MASK_LSB_BITS) >> INTERP_EMU_MASK_LSB_LSB;
+    unsigned msb = (ctrl & INTERP_EMU_MASK_MSB_BITS) >> INTERP_EMU_MASK_MSB_LSB;
+    uint32_t mask = (0xffffffffu >> (31 - msb)) & (0xffffffffu << lsb);
+    uint32_t v = (in >> (ctrl & INTERP_EMU_SHIFT_BITS)) & mask;
+    if ((ctrl & INTERP_EMU_SIGNED_BITS) && msb < 31 && (v >> msb) & 1) v |= 0xffffffffu << (msb + 1);
+    return v;
+}
+
+// 通道结果(写回累加器的值, 不含FORCE_MSB)
+static inline uint32_t interp_emu_lane(const interp_hw_t *interp, unsigned lane) {
+    uint32_t ctrl = interp->ctrl[lane];
+    if (ctrl & INTERP_EMU_ADD_RAW_BITS) {
+        return interp->accum[(ctrl & INTERP_EMU_CROSS_INPUT_BITS) ? 1 - lane : lane] + interp->base[lane];
+    }
+    return interp_emu_shift_mask(interp, lane) + interp->base[lane];
+}
+
+static inline uint32_t interp_emu_force(const interp_hw_t *interp, unsigned lane, uint32_t v) {
+    return v | ((interp->ctrl[lane] & INTERP_EMU_FORCE_MSB_BITS) << (28 - INTERP_EMU_FORCE_MSB_LSB));
+}
+
+static inline void interp_emu_writeback(interp_hw_t *interp, uint32_t r0, uint32_t r1) {
+    interp->accum[0] = (interp->ctrl[0] & INTERP_EMU_CROSS_RESULT_BITS) ? r1 : r0;
+    interp->accum[1] = (interp->ctrl[1] & INTERP_EMU_CROSS_RESULT_BITS) ? r0 : r1;
+}
+
+static inline uint32_t interp_peek_lane_result(interp_hw_t *interp, unsigned lane) {
+    return interp_emu_force(interp, lane, interp_emu_lane(interp, lane));
+}
+
+static inline uint32_t interp_pop_lane_result(interp_hw_t *interp, unsigned lane) {
+    uint32_t r0 = interp_emu_lane(interp, 0);
+    uint32_t r1 = interp_emu_lane(interp, 1);
+    interp_emu_writeback(interp, r0, r1);
+    return interp_emu_force(interp, lane, lane ? r1 : r0);
+}
+
+static inline uint32_t interp_peek_full_result(interp_hw_t *interp) {
+    return interp_emu_shift_mask(interp, 0) + interp_emu_shift_mask(interp, 1) + interp->base[2];
+}
+
+static inline uint32_t interp_pop_full_result(interp_hw_t *interp) {
+    uint32_t full = interp_peek_full_result(interp);
+    interp_emu_writeback(interp, interp_emu_lane(interp, 0), interp_emu_lane(interp, 1));
+    return full;
+}
+
+static inline uint32_t interp_get_raw(interp_hw_t *interp, unsigned lane) {
+    return interp_emu_shift_mask(interp, lane);
+}
+
+#endif // INTERP_EMU_H
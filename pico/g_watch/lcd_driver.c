@@ -1,5 +1,7 @@
 #include "lcd_driver.h"
 #include <string.h>
+#include "hardware/sync.h"
+#include "boot_timeline.h"
 
 // GC9A01A初始化命令序列
 static const uint8_t init_cmds[] = {
@@ -20,56 +22,126 @@ static const uint8_t init_cmds[] = {
     0x8D, 1, 0x01,
     0x8E, 1, 0xFF,
     0x8F, 1, 0xFF,
-    LCD_CMD_COLMOD, 1, 0x05,  // 16-bit/pixel
+    LCD_CMD_COLMOD, 1, LCD_COLMOD_16BIT,
     0x90, 4, 0x08, 0x08, 0x08, 0x08,
     0xBD, 1, 0x06,
     0xBC, 1, 0x00,
     0xFF, 3, 0x60, 0x01, 0x04,
     LCD_CMD_MADCTL, 1, 0x48,  // MX | BGR
+    LCD_CMD_TEON, 1, 0x00,    // TE只在V-blank输出脉冲
     0x13, 0,
     0x10, 0
 };
 
+// 默认后端, 由CMake选择(LCD_USE_PIO)
+#ifndef LCD_TRANSPORT
+#define LCD_TRANSPORT lcd_transport_spi
+#endif
+
+// 上电初始化的各步骤, 每步之后面板需要的等待时间(us)
+typedef enum {
+    BOOT_RST_LOW,       // 复位拉低
+    BOOT_RST_HIGH,      // 复位释放
+    BOOT_SLPOUT,        // 初始化命令序列和退出睡眠
+    BOOT_DISPON,        // 开启显示
+    BOOT_READY,         // 可以写入像素
+} lcd_boot_step_t;
+
 // 静态函数声明
-static void lcd_write_byte(uint8_t data);
-static void lcd_write_bytes(const uint8_t* data, size_t len);
-static void lcd_reset(void);
 static void lcd_init_pins(void);
+static void lcd_te_irq(uint gpio, uint32_t events);
+static int64_t lcd_boot_alarm(alarm_id_t id, void *user_data);
+
+static const lcd_transport_t *tr = &LCD_TRANSPORT;
+static volatile lcd_te_cb_t te_cb;
+static uint32_t spi_bytes;
+static lcd_boot_step_t boot_step;
+static volatile bool boot_ready;
 
-// 初始化LCD
+// 初始化LCD, 阻塞到面板可以使用, 再开启背光
 void lcd_init(void) {
-    // 初始化引脚
+    lcd_init_async();
+    lcd_wait_ready();
+    lcd_set_backlight(true);
+}
+
+// 异步初始化LCD: 复位和睡眠退出的等待由闹钟推进, 期间CPU可以做别的事
+void lcd_init_async(void) {
+    // 初始化引脚和传输后端, 复位先保持高电平
     lcd_init_pins();
-    
-    // 初始化SPI
-    spi_init(LCD_SPI_PORT, 40000000);  // 40MHz
-    gpio_set_function(LCD_CLK_PIN, GPIO_FUNC_SPI);
-    gpio_set_function(LCD_DIN_PIN, GPIO_FUNC_SPI);
-    
-    // 复位LCD
-    lcd_reset();
-    
-    // 发送初始化命令序列
-    const uint8_t *cmd = init_cmds;
-    while (cmd < init_cmds + sizeof(init_cmds)) {
-        lcd_write_cmd(*cmd++);
-        uint8_t num_args = *cmd++;
-        if (num_args > 0) {
-            lcd_write_bytes(cmd, num_args);
-            cmd += num_args;
+    tr->init();
+
+    boot_step = BOOT_RST_LOW;
+    boot_ready = false;
+    add_alarm_in_ms(5, lcd_boot_alarm, NULL, true);
+}
+
+// 闹钟回调(定时器中断): 执行一步, 返回到下一步的等待时间。
+// 初始化完成之前其他代码不能访问面板(见 lcd_wait_ready), 这里独占传输后端
+static int64_t lcd_boot_alarm(alarm_id_t id, void *user_data) {
+    (void)id;
+    (void)user_data;
+
+    switch (boot_step) {
+        case BOOT_RST_LOW:
+            gpio_put(LCD_RST_PIN, 0);
+            boot_step = BOOT_RST_HIGH;
+            return 15000;
+
+        case BOOT_RST_HIGH:
+            gpio_put(LCD_RST_PIN, 1);
+            boot_mark("lcd reset");
+            boot_step = BOOT_SLPOUT;
+            return 15000;
+
+        case BOOT_SLPOUT: {
+            // 发送初始化命令序列, 然后退出睡眠模式
+            const uint8_t *cmd = init_cmds;
+            while (cmd < init_cmds + sizeof(init_cmds)) {
+                uint8_t c = *cmd++;
+                uint8_t num_args = *cmd++;
+                lcd_write_cmd_params(c, cmd, num_args);
+                cmd += num_args;
+            }
+            lcd_write_cmd(LCD_CMD_SLPOUT);
+            boot_mark("lcd sleep out");
+            boot_step = BOOT_DISPON;
+            return 120000;
         }
+
+        case BOOT_DISPON:
+            lcd_write_cmd(LCD_CMD_DISPON);
+            boot_step = BOOT_READY;
+            return 20000;
+
+        case BOOT_READY:
+        default:
+            boot_mark("lcd ready");
+            boot_ready = true;
+            __sev();
+            return 0;
     }
-    
-    // 退出睡眠模式
-    lcd_write_cmd(LCD_CMD_SLPOUT);
-    sleep_ms(120);
-    
-    // 开启显示
-    lcd_write_cmd(LCD_CMD_DISPON);
-    sleep_ms(20);
-    
-    // 开启背光
-    lcd_set_backlight(true);
+}
+
+// 面板是否已经初始化完成
+bool lcd_is_ready(void) {
+    return boot_ready;
+}
+
+// 等待初始化完成, 闹钟回调之间在WFE中睡眠
+void lcd_wait_ready(void) {
+    while (!boot_ready) __wfe();
+}
+
+// 切换传输后端: 等之前的传输完成后把总线交给新后端
+void lcd_set_transport(const lcd_transport_t *t) {
+    tr->wait_idle();
+    tr = t;
+    tr->init();
+}
+
+const lcd_transport_t *lcd_get_transport(void) {
+    return tr;
 }
 
 // 初始化引脚
@@ -83,6 +155,11 @@ static void lcd_init_pins(void) {
     gpio_set_dir(LCD_CS_PIN, GPIO_OUT);
     gpio_set_dir(LCD_RST_PIN, GPIO_OUT);
     gpio_set_dir(LCD_BL_PIN, GPIO_OUT);
+
+    // TE是面板的输出, 没有连线时下拉保持低电平, 不会产生中断
+    gpio_init(LCD_TE_PIN);
+    gpio_set_dir(LCD_TE_PIN, GPIO_IN);
+    gpio_pull_down(LCD_TE_PIN);
     
     gpio_put(LCD_CS_PIN, 1);
     gpio_put(LCD_DC_PIN, 1);
@@ -90,79 +167,89 @@ static void lcd_init_pins(void) {
     gpio_put(LCD_BL_PIN, 0);
 }
 
-// 复位LCD
-static void lcd_reset(void) {
-    gpio_put(LCD_RST_PIN, 1);
-    sleep_ms(5);
-    gpio_put(LCD_RST_PIN, 0);
-    sleep_ms(15);
-    gpio_put(LCD_RST_PIN, 1);
-    sleep_ms(15);
-}
-
 // 写命令
 void lcd_write_cmd(uint8_t cmd) {
-    gpio_put(LCD_DC_PIN, 0);  // 命令模式
-    gpio_put(LCD_CS_PIN, 0);  // 片选使能
-    lcd_write_byte(cmd);
-    gpio_put(LCD_CS_PIN, 1);  // 片选禁用
+    tr->cmd(cmd, NULL, 0);
+    spi_bytes++;
+}
+
+// 写命令和参数
+void lcd_write_cmd_params(uint8_t cmd, const uint8_t* params, size_t len) {
+    tr->cmd(cmd, params, len);
+    spi_bytes += 1 + len;
 }
 
 // 写数据
 void lcd_write_data(uint8_t data) {
-    gpio_put(LCD_DC_PIN, 1);  // 数据模式
-    gpio_put(LCD_CS_PIN, 0);  // 片选使能
-    lcd_write_byte(data);
-    gpio_put(LCD_CS_PIN, 1);  // 片选禁用
+    tr->data(&data, 1);
+    spi_bytes++;
 }
 
 // 写颜色数据
 void lcd_write_color(uint16_t color) {
-    gpio_put(LCD_DC_PIN, 1);  // 数据模式
-    gpio_put(LCD_CS_PIN, 0);  // 片选使能
-    lcd_write_byte(color >> 8);
-    lcd_write_byte(color & 0xFF);
-    gpio_put(LCD_CS_PIN, 1);  // 片选禁用
+    uint8_t b[2] = { color >> 8, color & 0xFF };
+    tr->data(b, 2);
+    spi_bytes += 2;
 }
 
 // 写入缓冲区数据
 void lcd_write_buffer(const uint8_t* buffer, size_t size) {
-    gpio_put(LCD_DC_PIN, 1);  // 数据模式
-    gpio_put(LCD_CS_PIN, 0);  // 片选使能
-    lcd_write_bytes(buffer, size);
-    gpio_put(LCD_CS_PIN, 1);  // 片选禁用
+    tr->data(buffer, size);
+    spi_bytes += size;
+}
+
+// 写入RGB565像素
+void lcd_write_pixels(const uint16_t* pixels, size_t count) {
+    tr->pixels(pixels, count, NULL, NULL);
+    tr->wait_idle();
+    spi_bytes += count * 2;
+}
+
+// 异步写入RGB565像素
+void lcd_write_pixels_async(const uint16_t* pixels, size_t count, lcd_done_cb_t done, void* user_data) {
+    spi_bytes += count * 2;
+    tr->pixels(pixels, count, done, user_data);
+}
+
+// 等待传输完成
+void lcd_wait_idle(void) {
+    tr->wait_idle();
+}
+
+// 开启/关闭TE中断
+void lcd_set_te_callback(lcd_te_cb_t cb) {
+    te_cb = cb;
+    gpio_set_irq_enabled_with_callback(LCD_TE_PIN, GPIO_IRQ_EDGE_RISE, cb != NULL, lcd_te_irq);
+}
+
+static void lcd_te_irq(uint gpio, uint32_t events) {
+    lcd_te_cb_t cb = te_cb;
+    if (gpio == LCD_TE_PIN && (events & GPIO_IRQ_EDGE_RISE) && cb) {
+        cb(time_us_32());
+    }
 }
 
 // 设置显示窗口
 void lcd_set_window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
-    lcd_write_cmd(LCD_CMD_CASET);
-    lcd_write_data(x1 >> 8);
-    lcd_write_data(x1 & 0xFF);
-    lcd_write_data(x2 >> 8);
-    lcd_write_data(x2 & 0xFF);
-    
-    lcd_write_cmd(LCD_CMD_RASET);
-    lcd_write_data(y1 >> 8);
-    lcd_write_data(y1 & 0xFF);
-    lcd_write_data(y2 >> 8);
-    lcd_write_data(y2 & 0xFF);
-    
+    uint8_t col[4] = { x1 >> 8, x1 & 0xFF, x2 >> 8, x2 & 0xFF };
+    uint8_t row[4] = { y1 >> 8, y1 & 0xFF, y2 >> 8, y2 & 0xFF };
+    lcd_write_cmd_params(LCD_CMD_CASET, col, 4);
+    lcd_write_cmd_params(LCD_CMD_RASET, row, 4);
     lcd_write_cmd(LCD_CMD_RAMWR);
 }
 
 // 清屏
 void lcd_clear(uint16_t color) {
+    static uint16_t line[LCD_WIDTH];
+
+    // 上一次清屏的像素可能还在传输
+    tr->wait_idle();
+    for (int i = 0; i < LCD_WIDTH; i++) line[i] = color;
+
     lcd_set_window(0, 0, LCD_WIDTH-1, LCD_HEIGHT-1);
-    
-    gpio_put(LCD_DC_PIN, 1);  // 数据模式
-    gpio_put(LCD_CS_PIN, 0);  // 片选使能
-    
-    for(uint32_t i = 0; i < LCD_WIDTH * LCD_HEIGHT; i++) {
-        lcd_write_byte(color >> 8);
-        lcd_write_byte(color & 0xFF);
+    for (int y = 0; y < LCD_HEIGHT; y++) {
+        lcd_write_pixels(line, LCD_WIDTH);
     }
-    
-    gpio_put(LCD_CS_PIN, 1);  // 片选禁用
 }
 
 // 开启显示
@@ -180,11 +267,47 @@ void lcd_set_backlight(bool on) {
     gpio_put(LCD_BL_PIN, on);
 }
 
-// 底层SPI写入函数
-static void lcd_write_byte(uint8_t data) {
-    spi_write_blocking(LCD_SPI_PORT, &data, 1);
+// 进入常亮低功耗显示
+void lcd_enter_aod(uint16_t y1, uint16_t y2) {
+    uint8_t rows[4] = { y1 >> 8, y1 & 0xFF, y2 >> 8, y2 & 0xFF };
+    uint8_t colmod = LCD_COLMOD_12BIT;
+    lcd_write_cmd_params(LCD_CMD_PTLAR, rows, 4);
+    lcd_write_cmd(LCD_CMD_PTLON);
+
+    lcd_write_cmd(LCD_CMD_IDMON);
+
+    lcd_write_cmd_params(LCD_CMD_COLMOD, &colmod, 1);
+}
+
+// 回到正常显示
+void lcd_exit_aod(void) {
+    uint8_t colmod = LCD_COLMOD_16BIT;
+    lcd_write_cmd_params(LCD_CMD_COLMOD, &colmod, 1);
+
+    lcd_write_cmd(LCD_CMD_IDMOFF);
+    lcd_write_cmd(LCD_CMD_NORON);
+}
+
+uint32_t lcd_get_spi_bytes(void) {
+    return spi_bytes;
+}
+
+// LVGL通用MIPI驱动的回调: 命令和像素同样经过当前的传输后端
+void lcd_mipi_send_cmd(lv_display_t *disp, const uint8_t *cmd, size_t cmd_size, const uint8_t *param,
+                       size_t param_size) {
+    (void)disp;
+    (void)cmd_size;  // GC9A01只有8位命令
+    lcd_write_cmd_params(cmd[0], param, param_size);
+}
+
+static void lcd_mipi_color_done(void *user_data) {
+    lv_display_flush_ready((lv_display_t *)user_data);
 }
 
-static void lcd_write_bytes(const uint8_t* data, size_t len) {
-    spi_write_blocking(LCD_SPI_PORT, data, len);
-} 
\ No newline at end of file
+void lcd_mipi_send_color(lv_display_t *disp, const uint8_t *cmd, size_t cmd_size, uint8_t *param,
+                         size_t param_size) {
+    (void)cmd_size;
+    lcd_write_cmd(cmd[0]);
+    // 像素按16位发送, 高字节在前, LVGL缓冲区里的RGB565不需要交换字节
+    lcd_write_pixels_async((const uint16_t *)param, param_size / 2, lcd_mipi_color_done, disp);
+}
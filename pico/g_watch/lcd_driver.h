@@ -4,6 +4,8 @@
 #include <stdint.h>
 #include "pico/stdlib.h"
 #include "hardware/spi.h"
+#include "lvgl.h"
+#include "lcd_transport.h"
 
 // LCD分辨率定义
 #define LCD_WIDTH   240
@@ -17,6 +19,7 @@
 #define LCD_DIN_PIN     11  // SPI数据输入引脚
 #define LCD_RST_PIN     12  // 复位引脚
 #define LCD_BL_PIN      13  // 背光控制引脚
+#define LCD_TE_PIN      14  // 撕裂效应(TE)输出, 面板每开始扫描一帧输出一个脉冲
 
 // GC9A01A LCD控制器命令
 #define LCD_CMD_NOP        0x00
@@ -33,19 +36,47 @@
 #define LCD_CMD_RASET      0x2B  // 行地址设置
 #define LCD_CMD_RAMWR      0x2C  // 内存写入
 #define LCD_CMD_RAMRD      0x2E  // 内存读取
+#define LCD_CMD_PTLAR      0x30  // 部分显示区域(起止行)
+#define LCD_CMD_TEOFF      0x34  // 关闭TE输出
+#define LCD_CMD_TEON       0x35  // 开启TE输出
 #define LCD_CMD_MADCTL     0x36  // 内存数据访问控制
+#define LCD_CMD_IDMOFF     0x38  // 退出空闲(8色)模式
+#define LCD_CMD_IDMON      0x39  // 空闲(8色)模式
 #define LCD_CMD_COLMOD     0x3A  // 接口像素格式
 
+// COLMOD参数
+#define LCD_COLMOD_12BIT   0x03  // RGB444, 2个像素3字节
+#define LCD_COLMOD_16BIT   0x05  // RGB565
+
 // 函数声明
-// 初始化LCD
+// 初始化LCD, 阻塞约175ms(复位35ms, 退出睡眠120ms, 开启显示20ms), 完成后开启背光
 void lcd_init(void);
 
+// 异步初始化LCD: 立即返回, 复位和退出睡眠的等待由pico_time闹钟推进, 命令在定时器中断中发送。
+// lcd_is_ready() 之前不能调用其他写面板的函数; 背光保持关闭, 由调用者在写入第一帧后开启
+void lcd_init_async(void);
+
+// 面板是否已经可以写入
+bool lcd_is_ready(void);
+
+// 等待异步初始化完成
+void lcd_wait_ready(void);
+
+// 切换传输后端(lcd_transport.h), 默认后端由CMake选项LCD_USE_PIO决定
+void lcd_set_transport(const lcd_transport_t *t);
+
+// 当前的传输后端
+const lcd_transport_t *lcd_get_transport(void);
+
 // 设置显示窗口
 void lcd_set_window(uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2);
 
 // 写命令
 void lcd_write_cmd(uint8_t cmd);
 
+// 写命令和参数
+void lcd_write_cmd_params(uint8_t cmd, const uint8_t* params, size_t len);
+
 // 写数据
 void lcd_write_data(uint8_t data);
 
@@ -55,6 +86,21 @@ void lcd_write_color(uint16_t color);
 // 写入缓冲区数据
 void lcd_write_buffer(const uint8_t* buffer, size_t size);
 
+// 写入RGB565像素(按16位发送, 高字节在前)
+void lcd_write_pixels(const uint16_t* pixels, size_t count);
+
+// 异步写入RGB565像素: 返回后pixels要保持有效, 直到done被调用(PIO后端在DMA中断中调用)
+void lcd_write_pixels_async(const uint16_t* pixels, size_t count, lcd_done_cb_t done, void* user_data);
+
+// 等待之前的写入全部送到面板
+void lcd_wait_idle(void);
+
+// TE回调, 参数为TE上升沿的时间(time_us_32()), 在GPIO中断中调用
+typedef void (*lcd_te_cb_t)(uint32_t now_us);
+
+// 开启TE引脚的上升沿中断, cb为NULL时关闭
+void lcd_set_te_callback(lcd_te_cb_t cb);
+
 // 清屏
 void lcd_clear(uint16_t color);
 
@@ -67,4 +113,21 @@ void lcd_display_off(void);
 // 设置背光
 void lcd_set_backlight(bool on);
 
+// 进入常亮(AOD)低功耗显示: 只显示 y1..y2 行(部分显示模式, 其余行不驱动),
+// 8色空闲模式, 接口切换为12位像素(之后用 lcd_write_buffer() 写入打包的RGB444)
+void lcd_enter_aod(uint16_t y1, uint16_t y2);
+
+// 回到正常显示: 全屏, 全彩, 16位像素
+void lcd_exit_aod(void);
+
+// 写入的字节数(命令和数据), 用于估算功耗
+uint32_t lcd_get_spi_bytes(void);
+
+// LVGL通用MIPI驱动(lv_lcd_generic_mipi_create)的send_cmd/send_color回调, 经当前的传输后端发送,
+// send_color异步完成后调用 lv_display_flush_ready()
+void lcd_mipi_send_cmd(lv_display_t *disp, const uint8_t *cmd, size_t cmd_size, const uint8_t *param,
+                       size_t param_size);
+void lcd_mipi_send_color(lv_display_t *disp, const uint8_t *cmd, size_t cmd_size, uint8_t *param,
+                         size_t param_size);
+
 #endif // LCD_DRIVER_H 
\ No newline at end of file
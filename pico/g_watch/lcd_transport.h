@@ -0,0 +1,98 @@
+#ifndef LCD_TRANSPORT_H
+#define LCD_TRANSPORT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+
+// LCD传输层: 命令、参数和像素流怎样送到面板
+// lcd_driver.c 和 LVGL通用MIPI驱动的回调都只通过这里的接口写面板, 后端可以替换:
+//   lcd_transport_spi - 硬件SPI(spi1, 40MHz), CS和DC由GPIO切换, 阻塞写入
+//   lcd_transport_pio - PIO程序输出SCK/DIN/DC, DC随数据流切换, 62.5MHz, 像素由DMA链发送
+//   lcd_transport_rec - 主机端记录器, 模拟面板的显存和命令, 用于测试和基准(不依赖SDK)
+
+// 位速率上限: 硬件SPI按外设时钟分频取整(不超过), PIO每位2个系统时钟周期
+#define LCD_SPI_HZ      40000000
+#define LCD_PIO_HZ      62500000
+
+// 像素写完的回调, 异步后端在DMA中断中调用
+typedef void (*lcd_done_cb_t)(void *user_data);
+
+typedef struct {
+    const char *name;
+
+    // 初始化总线和引脚(CS/DC/CLK/DIN), 可以在后端之间切换时重复调用
+    void (*init)(void);
+
+    // 发送命令(DC=0), 再发送len个参数字节(DC=1)
+    void (*cmd)(uint8_t cmd, const uint8_t *params, size_t len);
+
+    // 发送数据字节(DC=1), 同步
+    void (*data)(const uint8_t *data, size_t len);
+
+    // 发送RGB565像素流(DC=1, 每个像素高字节在前), 在RAMWR之后调用。
+    // 可以异步: 返回后px要保持有效, 直到done被调用(done可以为NULL)
+    void (*pixels)(const uint16_t *px, size_t count, lcd_done_cb_t done, void *user_data);
+
+    // 等待之前的传输全部送到面板
+    void (*wait_idle)(void);
+} lcd_transport_t;
+
+extern const lcd_transport_t lcd_transport_spi;
+extern const lcd_transport_t lcd_transport_pio;
+extern const lcd_transport_t lcd_transport_rec;
+
+// PIO后端的FIFO字格式(lcd_transport.pio), 主机端测试用它检查编码
+//   头:   bit31 = DC电平, bit30..0 = 位数 - 1
+//   数据: 每个FIFO字只用高16位, 高位先发
+static inline uint32_t lcd_pio_header(bool dc, uint32_t bits) {
+    return ((uint32_t)dc << 31) | ((bits - 1) & 0x7FFFFFFFu);
+}
+
+// 把字节打包为FIFO数据字(每字2字节, 第一个字节在最高位), 返回字数
+static inline size_t lcd_pio_pack_bytes(const uint8_t *src, size_t len, uint32_t *dst) {
+    size_t n = 0;
+    for (size_t i = 0; i < len; i += 2) {
+        uint32_t hw = (uint32_t)src[i] << 8;
+        if (i + 1 < len) hw |= src[i + 1];
+        dst[n++] = hw << 16;
+    }
+    return n;
+}
+
+// ---- 主机端记录器 ----
+
+// 记录器模拟的总线: 用来比较不同后端的传输时间
+typedef struct {
+    uint32_t bit_hz;            // 总线时钟, 0表示不计传输时间
+    uint32_t xfer_ns;           // 每次传输的固定开销(片选/DC切换、函数调用、DMA启动)
+    bool async_pixels;          // 像素流由DMA发送, CPU不等待
+    bool pio_stream;            // 按PIO后端的FIFO字格式编码, 再按PIO程序的行为解码
+} lcd_rec_cfg_t;
+
+typedef struct {
+    uint32_t cmds;
+    uint32_t xfers;             // 传输次数(命令、参数、数据块、像素块)
+    uint64_t bytes;
+    uint64_t fifo_words;        // pio_stream时写入FIFO的字数
+    uint64_t bus_ns;            // 总线占用时间
+    uint64_t cpu_ns;            // CPU等待传输的时间
+    uint64_t elapsed_ns;        // 从lcd_rec_reset()开始的虚拟时间
+    uint32_t errors;            // 面板不认识的数据(RAMWR之外的像素, 参数个数不对等)
+} lcd_rec_stats_t;
+
+// 重置面板模型(显存清零, 全屏窗口, 16位像素)和统计
+void lcd_rec_reset(const lcd_rec_cfg_t *cfg);
+
+// CPU做了ns纳秒其他工作(渲染), 期间异步传输继续占用总线
+void lcd_rec_advance(uint32_t ns);
+
+void lcd_rec_get_stats(lcd_rec_stats_t *s);
+
+// 面板显存, LCD_WIDTH * LCD_HEIGHT 个RGB565像素(12位写入会扩展为RGB565)
+const uint16_t *lcd_rec_get_gram(void);
+
+// 最近一次面板命令及其参数(最多8个), 用于检查PTLAR、COLMOD等设置
+uint8_t lcd_rec_get_param(uint8_t cmd, uint8_t idx);
+
+#endif // LCD_TRANSPORT_H
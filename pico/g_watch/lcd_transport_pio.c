@@ -0,0 +1,165 @@
+#include "lcd_transport.h"
+#include "lcd_driver.h"
+#include "hardware/pio.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/clocks.h"
+#include "lcd_transport.pio.h"
+
+// PIO后端: lcd_transport.pio 输出SCK/DIN/DC, DC由每次传输的头决定, CS一直保持有效。
+// 命令和参数由CPU写入FIFO; 像素流由两个DMA通道发送: 控制通道按控制块依次装载数据通道
+// (像素头 -> 像素 -> 空触发), 数据通道在空触发时产生中断, 中断里调用完成回调。
+
+#define LCD_PIO         pio0
+
+// 控制块: 依次写入数据通道的 CTRL, WRITE_ADDR, TRANS_COUNT, READ_ADDR_TRIG
+typedef struct {
+    uint32_t ctrl;
+    volatile void *write_addr;
+    uint32_t count;
+    const void *read_addr;
+} dma_block_t;
+
+static bool claimed;
+static uint sm;
+static uint data_chan;
+static uint ctrl_chan;
+static uint32_t ctrl_quiet;         // 数据通道的基本配置(DREQ、IRQ_QUIET、链接到控制通道)
+
+static uint32_t pix_header;
+static dma_block_t blocks[3] __attribute__((aligned(16)));
+
+static volatile bool busy;
+static lcd_done_cb_t done_cb;
+static void *done_user;
+
+static void pio_dma_irq(void) {
+    if (!dma_channel_get_irq0_status(data_chan)) return;
+    dma_channel_acknowledge_irq0(data_chan);
+
+    busy = false;
+    if (done_cb) done_cb(done_user);
+}
+
+// 每位2个PIO周期, 系统时钟低于125MHz时不分频, 位速率随之降低
+static float pio_clkdiv(void) {
+    float div = (float)clock_get_hz(clk_sys) / (2.0f * LCD_PIO_HZ);
+    return div < 1.0f ? 1.0f : div;
+}
+
+static void pio_tr_init(void) {
+    if (!claimed) {
+        sm = (uint)pio_claim_unused_sm(LCD_PIO, true);
+        uint offset = (uint)pio_add_program(LCD_PIO, &lcd_dc_program);
+        lcd_dc_program_init(LCD_PIO, sm, offset, LCD_DIN_PIN, LCD_CLK_PIN, LCD_DC_PIN, pio_clkdiv());
+
+        data_chan = (uint)dma_claim_unused_channel(true);
+        ctrl_chan = (uint)dma_claim_unused_channel(true);
+
+        dma_channel_config c = dma_channel_get_default_config(data_chan);
+        channel_config_set_dreq(&c, pio_get_dreq(LCD_PIO, sm, true));
+        channel_config_set_write_increment(&c, false);
+        channel_config_set_chain_to(&c, ctrl_chan);
+        channel_config_set_irq_quiet(&c, true);
+        ctrl_quiet = channel_config_get_ctrl_value(&c);
+        dma_channel_configure(data_chan, &c, &LCD_PIO->txf[sm], NULL, 0, false);
+
+        // 控制通道每次搬运一个控制块(4个字), 写地址在数据通道的alias 3寄存器组内循环
+        c = dma_channel_get_default_config(ctrl_chan);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+        channel_config_set_read_increment(&c, true);
+        channel_config_set_write_increment(&c, true);
+        channel_config_set_ring(&c, true, 4);
+        dma_channel_configure(ctrl_chan, &c, &dma_hw->ch[data_chan].al3_ctrl, blocks, 4, false);
+
+        dma_channel_set_irq0_enabled(data_chan, true);
+        irq_add_shared_handler(DMA_IRQ_0, pio_dma_irq, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+        irq_set_enabled(DMA_IRQ_0, true);
+        claimed = true;
+    } else {
+        // 从SPI后端切换回来: 引脚重新交给PIO; 系统时钟可能改变过(clock_gov.h), 重新计算分频
+        pio_gpio_init(LCD_PIO, LCD_DIN_PIN);
+        pio_gpio_init(LCD_PIO, LCD_CLK_PIN);
+        pio_gpio_init(LCD_PIO, LCD_DC_PIN);
+        pio_sm_set_clkdiv(LCD_PIO, sm, pio_clkdiv());
+    }
+
+    // 面板上只有这一个设备, 片选一直有效
+    gpio_put(LCD_CS_PIN, 0);
+}
+
+// 写入之前的像素DMA必须已经完成, 否则CPU写入的字会插到像素流中间
+static void wait_dma(void) {
+    while (busy) tight_loop_contents();
+}
+
+static void put_bytes(bool dc, const uint8_t *b, size_t len) {
+    uint32_t words[8];
+    pio_sm_put_blocking(LCD_PIO, sm, lcd_pio_header(dc, (uint32_t)len * 8));
+    while (len) {
+        size_t n = len > 16 ? 16 : len;
+        size_t cnt = lcd_pio_pack_bytes(b, n, words);
+        for (size_t i = 0; i < cnt; i++) pio_sm_put_blocking(LCD_PIO, sm, words[i]);
+        b += n;
+        len -= n;
+    }
+}
+
+static void pio_tr_cmd(uint8_t cmd, const uint8_t *params, size_t len) {
+    wait_dma();
+    put_bytes(false, &cmd, 1);
+    if (len) put_bytes(true, params, len);
+}
+
+static void pio_tr_data(const uint8_t *data, size_t len) {
+    if (len == 0) return;
+    wait_dma();
+    put_bytes(true, data, len);
+}
+
+static void pio_tr_pixels(const uint16_t *px, size_t count, lcd_done_cb_t done, void *user_data) {
+    wait_dma();
+    if (count == 0) {
+        if (done) done(user_data);
+        return;
+    }
+
+    pix_header = lcd_pio_header(true, (uint32_t)count * 16);
+
+    dma_channel_config c;
+    c.ctrl = ctrl_quiet;
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, false);
+    blocks[0] = (dma_block_t){ channel_config_get_ctrl_value(&c), &LCD_PIO->txf[sm], 1, &pix_header };
+
+    c.ctrl = ctrl_quiet;
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, true);
+    blocks[1] = (dma_block_t){ channel_config_get_ctrl_value(&c), &LCD_PIO->txf[sm], (uint32_t)count, px };
+
+    // 空触发: 链条结束, IRQ_QUIET模式下产生中断
+    blocks[2] = (dma_block_t){ ctrl_quiet, &LCD_PIO->txf[sm], 0, NULL };
+
+    done_cb = done;
+    done_user = user_data;
+    busy = true;
+    dma_channel_set_read_addr(ctrl_chan, blocks, true);
+}
+
+static void pio_tr_wait_idle(void) {
+    wait_dma();
+
+    // 等FIFO排空, 状态机停在下一个头的pull上
+    uint32_t stall = 1u << (PIO_FDEBUG_TXSTALL_LSB + sm);
+    LCD_PIO->fdebug = stall;
+    while (!(LCD_PIO->fdebug & stall)) tight_loop_contents();
+}
+
+const lcd_transport_t lcd_transport_pio = {
+    .name = "pio",
+    .init = pio_tr_init,
+    .cmd = pio_tr_cmd,
+    .data = pio_tr_data,
+    .pixels = pio_tr_pixels,
+    .wait_idle = pio_tr_wait_idle,
+};
@@ -0,0 +1,268 @@
+#include "lcd_transport.h"
+#include <string.h>
+
+// 主机端记录器后端: 按字节模拟GC9A01的命令解析和显存(CASET/RASET/RAMWR/COLMOD),
+// 并按配置的总线时钟累计传输时间。不依赖SDK, 设备端不会用到。
+
+#define REC_WIDTH       240
+#define REC_HEIGHT      240
+
+#define CMD_CASET       0x2A
+#define CMD_RASET       0x2B
+#define CMD_RAMWR       0x2C
+#define CMD_RAMWRC      0x3C
+#define CMD_COLMOD      0x3A
+#define COLMOD_12BIT    0x03
+
+#define REC_MAX_PARAMS  8
+
+static lcd_rec_cfg_t cfg;
+static lcd_rec_stats_t stats;
+static uint16_t gram[REC_WIDTH * REC_HEIGHT];
+static uint8_t params[256][REC_MAX_PARAMS];
+
+// 命令解析状态
+static bool has_cmd;
+static uint8_t cur_cmd;
+static uint32_t param_idx;
+static uint16_t xs, xe, ys, ye;
+static uint16_t cx, cy;
+static bool px12;
+static uint8_t px_bytes[3];
+static uint8_t px_cnt;
+
+// 总线模型: CPU的虚拟时间和总线忙到的时间
+static uint64_t cpu_now_ns;
+static uint64_t bus_free_ns;
+
+// PIO程序模型: 等待头/发送数据位
+static bool pio_in_data;
+static bool pio_dc;
+static uint32_t pio_bits_left;
+static uint8_t pio_byte;
+static uint8_t pio_byte_bits;
+
+static void put_pixel(uint16_t px) {
+    if (cx >= REC_WIDTH || cy >= REC_HEIGHT) {
+        stats.errors++;
+    } else {
+        gram[cy * REC_WIDTH + cx] = px;
+    }
+    // 写满一行回到窗口左边, 写满窗口回到左上角
+    if (cx >= xe) {
+        cx = xs;
+        cy = cy >= ye ? ys : cy + 1;
+    } else {
+        cx++;
+    }
+}
+
+// 12位像素扩展为RGB565(和面板一样, 每个分量高位对齐)
+static uint16_t rgb444_to_565(uint8_t r, uint8_t g, uint8_t b) {
+    return (uint16_t)(((r << 1 | r >> 3) << 11) | ((g << 2 | g >> 2) << 5) | (b << 1 | b >> 3));
+}
+
+static void panel_cmd(uint8_t c) {
+    stats.cmds++;
+    has_cmd = true;
+    cur_cmd = c;
+    param_idx = 0;
+    px_cnt = 0;
+    if (c == CMD_RAMWR) {
+        cx = xs;
+        cy = ys;
+    }
+}
+
+static void panel_data(uint8_t b) {
+    if (!has_cmd) {
+        stats.errors++;
+        return;
+    }
+
+    if (cur_cmd == CMD_RAMWR || cur_cmd == CMD_RAMWRC) {
+        px_bytes[px_cnt++] = b;
+        if (!px12 && px_cnt == 2) {
+            put_pixel((uint16_t)(px_bytes[0] << 8 | px_bytes[1]));
+            px_cnt = 0;
+        } else if (px12 && px_cnt == 3) {
+            // RRRRGGGG BBBBRRRR GGGGBBBB
+            put_pixel(rgb444_to_565(px_bytes[0] >> 4, px_bytes[0] & 0xF, px_bytes[1] >> 4));
+            put_pixel(rgb444_to_565(px_bytes[1] & 0xF, px_bytes[2] >> 4, px_bytes[2] & 0xF));
+            px_cnt = 0;
+        }
+        return;
+    }
+
+    if (param_idx < REC_MAX_PARAMS) params[cur_cmd][param_idx] = b;
+    param_idx++;
+
+    uint8_t *p = params[cur_cmd];
+    if (cur_cmd == CMD_CASET && param_idx == 4) {
+        xs = (uint16_t)(p[0] << 8 | p[1]);
+        xe = (uint16_t)(p[2] << 8 | p[3]);
+        if (xs > xe || xe >= REC_WIDTH) stats.errors++;
+    } else if (cur_cmd == CMD_RASET && param_idx == 4) {
+        ys = (uint16_t)(p[0] << 8 | p[1]);
+        ye = (uint16_t)(p[2] << 8 | p[3]);
+        if (ys > ye || ye >= REC_HEIGHT) stats.errors++;
+    } else if (cur_cmd == CMD_COLMOD && param_idx == 1) {
+        px12 = (b & 0x7) == COLMOD_12BIT;
+    }
+}
+
+// 按PIO程序的行为解码一个FIFO字
+static void pio_fifo_word(uint32_t w) {
+    stats.fifo_words++;
+    if (!pio_in_data) {
+        // pull; out x, 1; out y, 31
+        pio_dc = w >> 31;
+        pio_bits_left = (w & 0x7FFFFFFFu) + 1;
+        pio_in_data = true;
+        pio_byte_bits = 0;
+        return;
+    }
+
+    // 自动pull阈值16: 每个字只移出高16位, 传输结束时剩下的位被下一个头覆盖
+    for (int i = 0; i < 16 && pio_bits_left; i++, pio_bits_left--) {
+        pio_byte = (uint8_t)(pio_byte << 1 | ((w >> (31 - i)) & 1));
+        if (++pio_byte_bits == 8) {
+            if (pio_dc) panel_data(pio_byte);
+            else panel_cmd(pio_byte);
+            pio_byte_bits = 0;
+        }
+    }
+    if (pio_bits_left == 0) {
+        // 面板按字节接收, 不足一个字节的位被丢弃
+        if (pio_byte_bits) stats.errors++;
+        pio_in_data = false;
+    }
+}
+
+static void pio_send_bytes(bool dc, const uint8_t *b, size_t len) {
+    uint32_t words[8];
+    pio_fifo_word(lcd_pio_header(dc, (uint32_t)len * 8));
+    while (len) {
+        size_t n = len > 16 ? 16 : len;
+        size_t cnt = lcd_pio_pack_bytes(b, n, words);
+        for (size_t i = 0; i < cnt; i++) pio_fifo_word(words[i]);
+        b += n;
+        len -= n;
+    }
+}
+
+// 一次传输: 同步传输CPU要等到总线空闲并发送完, 异步传输CPU只付出启动开销
+static void bus_xfer(uint64_t bits, bool async) {
+    uint64_t wire = cfg.bit_hz ? bits * 1000000000ull / cfg.bit_hz : 0;
+    stats.xfers++;
+    stats.bytes += bits / 8;
+    stats.bus_ns += wire;
+
+    uint64_t t0 = cpu_now_ns;
+    cpu_now_ns += cfg.xfer_ns;
+    uint64_t start = cpu_now_ns > bus_free_ns ? cpu_now_ns : bus_free_ns;
+    bus_free_ns = start + wire;
+    if (!async) cpu_now_ns = bus_free_ns;
+    stats.cpu_ns += cpu_now_ns - t0;
+}
+
+static void rec_init(void) {
+}
+
+static void rec_cmd(uint8_t c, const uint8_t *p, size_t len) {
+    bus_xfer(8, false);
+    if (len) bus_xfer((uint64_t)len * 8, false);
+
+    if (cfg.pio_stream) {
+        pio_send_bytes(false, &c, 1);
+        if (len) pio_send_bytes(true, p, len);
+        return;
+    }
+    panel_cmd(c);
+    for (size_t i = 0; i < len; i++) panel_data(p[i]);
+}
+
+static void rec_data(const uint8_t *d, size_t len) {
+    if (len == 0) return;
+    bus_xfer((uint64_t)len * 8, false);
+
+    if (cfg.pio_stream) {
+        pio_send_bytes(true, d, len);
+        return;
+    }
+    for (size_t i = 0; i < len; i++) panel_data(d[i]);
+}
+
+static void rec_pixels(const uint16_t *px, size_t count, lcd_done_cb_t done, void *user_data) {
+    if (count) {
+        bus_xfer((uint64_t)count * 16, cfg.async_pixels);
+
+        if (cfg.pio_stream) {
+            // 16位DMA写FIFO时半字被复制到总线的高低两半
+            pio_fifo_word(lcd_pio_header(true, (uint32_t)count * 16));
+            for (size_t i = 0; i < count; i++) pio_fifo_word((uint32_t)px[i] << 16 | px[i]);
+        } else {
+            for (size_t i = 0; i < count; i++) {
+                panel_data((uint8_t)(px[i] >> 8));
+                panel_data((uint8_t)px[i]);
+            }
+        }
+    }
+    if (done) done(user_data);
+}
+
+static void rec_wait_idle(void) {
+    if (bus_free_ns > cpu_now_ns) {
+        stats.cpu_ns += bus_free_ns - cpu_now_ns;
+        cpu_now_ns = bus_free_ns;
+    }
+}
+
+const lcd_transport_t lcd_transport_rec = {
+    .name = "rec",
+    .init = rec_init,
+    .cmd = rec_cmd,
+    .data = rec_data,
+    .pixels = rec_pixels,
+    .wait_idle = rec_wait_idle,
+};
+
+void lcd_rec_reset(const lcd_rec_cfg_t *c) {
+    cfg = *c;
+    memset(&stats, 0, sizeof(stats));
+    memset(gram, 0, sizeof(gram));
+    memset(params, 0, sizeof(params));
+    has_cmd = false;
+    cur_cmd = 0;
+    param_idx = 0;
+    xs = 0;
+    xe = REC_WIDTH - 1;
+    ys = 0;
+    ye = REC_HEIGHT - 1;
+    cx = 0;
+    cy = 0;
+    px12 = false;
+    px_cnt = 0;
+    cpu_now_ns = 0;
+    bus_free_ns = 0;
+    pio_in_data = false;
+    pio_bits_left = 0;
+    pio_byte_bits = 0;
+}
+
+void lcd_rec_advance(uint32_t ns) {
+    cpu_now_ns += ns;
+}
+
+void lcd_rec_get_stats(lcd_rec_stats_t *s) {
+    *s = stats;
+    s->elapsed_ns = cpu_now_ns;
+}
+
+const uint16_t *lcd_rec_get_gram(void) {
+    return gram;
+}
+
+uint8_t lcd_rec_get_param(uint8_t cmd, uint8_t idx) {
+    return idx < REC_MAX_PARAMS ? params[cmd][idx] : 0;
+}
@@ -0,0 +1,60 @@
+#include "lcd_transport.h"
+#include "lcd_driver.h"
+
+// 硬件SPI后端: spi1, CS和DC由GPIO切换, 全部阻塞写入
+// (spi_init按不超过40MHz取整, 125MHz的外设时钟下实际为31.25MHz)
+
+static void spi_tr_init(void) {
+    spi_init(LCD_SPI_PORT, LCD_SPI_HZ);
+    gpio_set_function(LCD_CLK_PIN, GPIO_FUNC_SPI);
+    gpio_set_function(LCD_DIN_PIN, GPIO_FUNC_SPI);
+
+    // PIO后端用过DC时交还给GPIO
+    gpio_init(LCD_DC_PIN);
+    gpio_set_dir(LCD_DC_PIN, GPIO_OUT);
+    gpio_put(LCD_DC_PIN, 1);
+    gpio_put(LCD_CS_PIN, 1);
+}
+
+static void spi_tr_cmd(uint8_t cmd, const uint8_t *params, size_t len) {
+    gpio_put(LCD_DC_PIN, 0);  // 命令模式
+    gpio_put(LCD_CS_PIN, 0);  // 片选使能
+    spi_write_blocking(LCD_SPI_PORT, &cmd, 1);
+    if (len) {
+        gpio_put(LCD_DC_PIN, 1);  // 数据模式
+        spi_write_blocking(LCD_SPI_PORT, params, len);
+    }
+    gpio_put(LCD_CS_PIN, 1);  // 片选禁用
+}
+
+static void spi_tr_data(const uint8_t *data, size_t len) {
+    gpio_put(LCD_DC_PIN, 1);  // 数据模式
+    gpio_put(LCD_CS_PIN, 0);  // 片选使能
+    spi_write_blocking(LCD_SPI_PORT, data, len);
+    gpio_put(LCD_CS_PIN, 1);  // 片选禁用
+}
+
+static void spi_tr_pixels(const uint16_t *px, size_t count, lcd_done_cb_t done, void *user_data) {
+    gpio_put(LCD_DC_PIN, 1);  // 数据模式
+    gpio_put(LCD_CS_PIN, 0);  // 片选使能
+    // 16位帧格式下SPI先发送高字节, 正好是面板要求的字节序, 不需要逐个交换
+    spi_set_format(LCD_SPI_PORT, 16, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+    spi_write16_blocking(LCD_SPI_PORT, px, count);
+    spi_set_format(LCD_SPI_PORT, 8, SPI_CPOL_0, SPI_CPHA_0, SPI_MSB_FIRST);
+    gpio_put(LCD_CS_PIN, 1);  // 片选禁用
+
+    if (done) done(user_data);
+}
+
+static void spi_tr_wait_idle(void) {
+    // 写入都是阻塞的
+}
+
+const lcd_transport_t lcd_transport_spi = {
+    .name = "spi",
+    .init = spi_tr_init,
+    .cmd = spi_tr_cmd,
+    .data = spi_tr_data,
+    .pixels = spi_tr_pixels,
+    .wait_idle = spi_tr_wait_idle,
+};
@@ -9,9 +9,38 @@
 #define LV_COLOR_DEPTH          16
 #define LV_COLOR_16_SWAP        0
 
+// 软件渲染颜色格式裁剪
+// 目标缓冲固定为RGB565; ARGB8888用于中间图层(指针旋转等), RGB565A8用于旋转后的RGB565图片,
+// A8用于字体和遮罩, I1只在打开常亮显示(CMake选项 ALWAYS_ON_DISPLAY)时用于aod.c的1位渲染。
+// 其余格式的混合内核不参与编译, 以减小flash和XIP缓存占用。
+#define LV_DRAW_SW_SUPPORT_RGB565       1
+#define LV_DRAW_SW_SUPPORT_RGB565A8     1
+#define LV_DRAW_SW_SUPPORT_ARGB8888     1
+#define LV_DRAW_SW_SUPPORT_A8           1
+#define LV_DRAW_SW_SUPPORT_RGB888       0
+#define LV_DRAW_SW_SUPPORT_XRGB8888     0
+#define LV_DRAW_SW_SUPPORT_L8           0
+#define LV_DRAW_SW_SUPPORT_AL88         0
+#if defined(ALWAYS_ON_DISPLAY)
+#define LV_DRAW_SW_SUPPORT_I1           1
+#else
+#define LV_DRAW_SW_SUPPORT_I1           0
+#endif
+
+// 显示缓冲固定为RGB565: 混合分派先判断RGB565图层并直接调用RGB565内核, 不经过格式switch;
+// 中间图层(ARGB8888)和I1(仅常亮显示)仍走switch
+#define LV_DRAW_SW_BLEND_SPECIALIZE_RGB565  1
+
+// 软件渲染的平台加速: 图片旋转/缩放的源坐标由RP2040硬件插值器计算(主机上为仿真), 见 lv_draw_sw_rp2040.h
+#define LV_USE_DRAW_SW_ASM              LV_DRAW_SW_ASM_CUSTOM
+#define LV_DRAW_SW_ASM_CUSTOM_INCLUDE   "lv_draw_sw_rp2040.h"
+
 // 内存设置
 #define LV_MEM_CUSTOM           0
+// 主机基准(face_bench等)渲染模拟器表盘时需要更大的堆, 由编译选项 -DLV_MEM_SIZE=... 覆盖
+#ifndef LV_MEM_SIZE
 #define LV_MEM_SIZE            (32U * 1024U)
+#endif
 #define LV_MEM_ATTR
 #define LV_MEM_ADR             0
 
@@ -30,6 +59,10 @@
 #define LV_USE_ASSERT_OBJ      1
 #define LV_USE_ASSERT_STYLE    1
 
+// 图片解码
+// 资源包中的大图(表盘背景等)按行带RLE压缩, 绘制时只解压当前条带覆盖的行带, 不需要整图大小的缓冲
+#define LV_USE_RLE             1
+
 // 字体设置
 #define LV_FONT_MONTSERRAT_12  1
 #define LV_FONT_MONTSERRAT_14  1
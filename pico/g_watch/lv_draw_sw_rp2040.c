@@ -0,0 +1,34 @@
+#include "lv_draw_sw_rp2040.h"
+
+// LVGL软件渲染的RP2040加速, 见 lv_draw_sw_rp2040.h
+
+#if !(defined(PICO_ON_DEVICE) && PICO_ON_DEVICE)
+bool lv_draw_sw_rp2040_interp = true;
+#endif
+
+uint32_t lv_draw_sw_rp2040_rows;
+
+// 一个插值器按 start + ((step * x) >> 8) 逐个产生坐标, x从0开始
+static void walk_setup(interp_hw_t *interp, int32_t start, int32_t step) {
+    interp_config c = interp_default_config();
+    interp_config_set_add_raw(&c, true);
+    interp_set_config(interp, 0, &c);
+
+    c = interp_default_config();
+    interp_config_set_cross_input(&c, true);
+    interp_config_set_shift(&c, 8);
+    interp_config_set_mask(&c, 0, 23);
+    interp_config_set_signed(&c, true);
+    interp_set_config(interp, 1, &c);
+
+    interp_set_base(interp, 0, (uint32_t)step);
+    interp_set_base(interp, 1, (uint32_t)start);
+    interp_set_accumulator(interp, 0, 0);
+    interp_set_accumulator(interp, 1, 0);
+}
+
+void lv_draw_sw_rp2040_walk_start(int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step) {
+    walk_setup(interp0, xs_ups, xs_step);
+    walk_setup(interp1, ys_ups, ys_step);
+    lv_draw_sw_rp2040_rows++;
+}
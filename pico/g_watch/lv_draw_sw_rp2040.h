@@ -0,0 +1,55 @@
+#ifndef LV_DRAW_SW_RP2040_H
+#define LV_DRAW_SW_RP2040_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// LVGL软件渲染的RP2040加速(lv_conf.h: LV_DRAW_SW_ASM_CUSTOM_INCLUDE)
+// 旋转/缩放图片时, lv_draw_sw_transform.c 逐个目标像素计算源坐标(1/256像素精度):
+//   xs = xs_start + ((xs_step * x) >> 8), ys同理
+// 这里用两个硬件插值器代替乘法和移位: INTERP0算x, INTERP1算y, 每行开始时配置一次:
+//   lane0: ADD_RAW, BASE0 = step         每次pop累加器0加上step, 即 step * x
+//   lane1: 交叉输入累加器0, 右移8位, 屏蔽0..23位并符号扩展, BASE1 = start
+// 屏蔽后的24位在第23位符号扩展, 等于对32位的 step * x 做算术右移8位, 结果和软件公式逐位一致。
+// 每个像素只需要从SIO读两次(pop lane1)。
+// 主机上用 interp_emu.h 仿真插值器, lv_draw_sw_rp2040_interp 可以关掉插值器路径做对比。
+// 插值器的状态属于渲染所在的核(LVGL只在核0上运行), 中断处理里不能使用INTERP0/1。
+
+#if defined(PICO_ON_DEVICE) && PICO_ON_DEVICE
+#include "hardware/interp.h"
+#else
+#include "interp_emu.h"
+extern bool lv_draw_sw_rp2040_interp;
+#endif
+
+// 经过插值器的行数, 用于确认渲染确实走了这条路径
+extern uint32_t lv_draw_sw_rp2040_rows;
+
+void lv_draw_sw_rp2040_walk_start(int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step);
+
+#define LV_DRAW_SW_TRANSFORM_WALK_START(xs_ups, ys_ups, xs_step, ys_step) \
+    lv_draw_sw_rp2040_walk_start(xs_ups, ys_ups, xs_step, ys_step)
+
+#if defined(PICO_ON_DEVICE) && PICO_ON_DEVICE
+#define LV_DRAW_SW_TRANSFORM_WALK_NEXT(x, xs_ups, ys_ups, xs_ups_start, ys_ups_start, xs_step, ys_step) \
+    do { \
+        (void)(xs_ups_start); \
+        (void)(ys_ups_start); \
+        xs_ups = (int32_t)interp_pop_lane_result(interp0, 1); \
+        ys_ups = (int32_t)interp_pop_lane_result(interp1, 1); \
+    } while(0)
+#else
+#define LV_DRAW_SW_TRANSFORM_WALK_NEXT(x, xs_ups, ys_ups, xs_ups_start, ys_ups_start, xs_step, ys_step) \
+    do { \
+        if(lv_draw_sw_rp2040_interp) { \
+            xs_ups = (int32_t)interp_pop_lane_result(interp0, 1); \
+            ys_ups = (int32_t)interp_pop_lane_result(interp1, 1); \
+        } \
+        else { \
+            xs_ups = xs_ups_start + ((xs_step * x) >> 8); \
+            ys_ups = ys_ups_start + ((ys_step * x) >> 8); \
+        } \
+    } while(0)
+#endif
+
+#endif // LV_DRAW_SW_RP2040_H
@@ -47,6 +47,9 @@
 #define FALL_HEIGHT     80
 #define PAD_BASIC       8
 
+#define HEADLESS_UNIT_MAX       8   /*Max. number of draw units measured separately*/
+#define HEADLESS_IDLE_MAX       100 /*Stop a scene after this many refresh periods without rendering*/
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -62,6 +65,26 @@ typedef struct {
     uint32_t measurement_cnt;
 } scene_dsc_t;
 
+typedef struct {
+    lv_draw_unit_t * unit;
+    int32_t (*dispatch_cb)(lv_draw_unit_t * draw_unit, lv_layer_t * layer);
+    uint32_t time_sum;          /*Time spent in `dispatch_cb` in the current frame*/
+} headless_unit_t;
+
+typedef struct {
+    const lv_demo_benchmark_headless_cfg_t * cfg;
+    headless_unit_t units[HEADLESS_UNIT_MAX];
+    uint32_t unit_cnt;
+    uint32_t col_cnt;           /*render, flush and one column per draw unit*/
+    uint32_t * samples;         /*`frame_cnt` rows of `col_cnt` columns*/
+    uint32_t tick;              /*The virtual tick*/
+    uint32_t refr_start;
+    uint32_t refr_time;
+    uint32_t flush_start;
+    uint32_t flush_time;
+    bool rendered;
+} headless_ctx_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -74,6 +97,15 @@ static void next_scene_timer_cb(lv_timer_t * timer);
 #endif
 
 static void summary_create(void);
+static void screen_init(void);
+
+static uint32_t headless_tick_cb(void);
+static int32_t headless_dispatch_cb(lv_draw_unit_t * draw_unit, lv_layer_t * layer);
+static void headless_display_event_cb(lv_event_t * e);
+static uint32_t headless_run_scene(uint32_t scene, uint32_t period);
+static void headless_write(const char * fmt, ...);
+static void headless_write_column(const char * name, uint32_t col, uint32_t frame_cnt);
+static void headless_write_scene(uint32_t scene, uint32_t frame_cnt);
 
 static void rnd_reset(void);
 static int32_t rnd_next(int32_t min, int32_t max);
@@ -481,6 +513,7 @@ static scene_dsc_t scenes[] = {
 
 static uint32_t scene_act;
 static uint32_t rnd_act;
+static headless_ctx_t headless;
 
 /**********************
  *      MACROS
@@ -494,14 +527,7 @@ void lv_demo_benchmark(void)
 {
     scene_act = 0;
 
-    lv_obj_t * scr = lv_screen_active();
-    lv_obj_remove_style_all(scr);
-    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
-    lv_obj_set_style_text_color(scr, lv_color_black(), 0);
-    lv_obj_set_style_bg_color(scr, lv_palette_lighten(LV_PALETTE_GREY, 4), 0);
-    lv_obj_set_style_pad_all(lv_screen_active(), 8, 0);
-    lv_obj_set_style_pad_top(lv_screen_active(), HEADER_HEIGHT, 0);
-    lv_obj_set_style_pad_gap(lv_screen_active(), 8, 0);
+    screen_init();
 
     lv_obj_t * title = lv_label_create(lv_layer_top());
     lv_obj_set_style_bg_opa(title, LV_OPA_COVER, 0);
@@ -521,10 +547,280 @@ void lv_demo_benchmark(void)
 #endif
 }
 
+void lv_demo_benchmark_headless_cfg_init(lv_demo_benchmark_headless_cfg_t * cfg)
+{
+    lv_memzero(cfg, sizeof(*cfg));
+    cfg->frame_cnt = 300;
+    cfg->warmup_frame_cnt = 10;
+    cfg->format = LV_DEMO_BENCHMARK_OUTPUT_JSON;
+}
+
+lv_result_t lv_demo_benchmark_run_headless(const lv_demo_benchmark_headless_cfg_t * cfg)
+{
+    LV_ASSERT_NULL(cfg);
+
+    if(cfg->frame_cnt == 0 || cfg->time_us_cb == NULL || cfg->write_cb == NULL) {
+        LV_LOG_WARN("frame_cnt, time_us_cb and write_cb must be set");
+        return LV_RESULT_INVALID;
+    }
+
+    lv_display_t * disp = lv_display_get_default();
+    lv_timer_t * refr_timer = disp ? lv_display_get_refr_timer(disp) : NULL;
+    if(refr_timer == NULL) {
+        LV_LOG_WARN("A default display with a refresh timer is required");
+        return LV_RESULT_INVALID;
+    }
+
+    lv_memzero(&headless, sizeof(headless));
+    headless.cfg = cfg;
+
+    lv_draw_unit_t * unit;
+    for(unit = LV_GLOBAL_DEFAULT()->draw_info.unit_head; unit; unit = unit->next) {
+        if(headless.unit_cnt < HEADLESS_UNIT_MAX) headless.units[headless.unit_cnt++].unit = unit;
+    }
+
+    headless.col_cnt = 2 + headless.unit_cnt;
+    headless.samples = lv_malloc(cfg->frame_cnt * headless.col_cnt * sizeof(uint32_t));
+    if(headless.samples == NULL) {
+        LV_LOG_WARN("Out of memory");
+        return LV_RESULT_INVALID;
+    }
+
+    /*Measure the draw units by wrapping their dispatchers*/
+    uint32_t i;
+    for(i = 0; i < headless.unit_cnt; i++) {
+        headless.units[i].dispatch_cb = headless.units[i].unit->dispatch_cb;
+        headless.units[i].unit->dispatch_cb = headless_dispatch_cb;
+    }
+
+    lv_tick_get_cb_t tick_cb_prev = LV_GLOBAL_DEFAULT()->tick_state.tick_get_cb;
+    uint32_t tick_start = lv_tick_get();
+    headless.tick = tick_start;
+    lv_tick_set_cb(headless_tick_cb);
+    lv_display_add_event_cb(disp, headless_display_event_cb, LV_EVENT_ALL, &headless);
+
+    uint32_t period = refr_timer->period ? refr_timer->period : 1;
+    if(cfg->format == LV_DEMO_BENCHMARK_OUTPUT_JSON) {
+        headless_write("{\n  \"hor_res\": %"LV_PRId32", \"ver_res\": %"LV_PRId32", \"refr_period_ms\": %"LV_PRIu32",\n",
+                       lv_display_get_horizontal_resolution(disp), lv_display_get_vertical_resolution(disp), period);
+        headless_write("  \"frame_cnt\": %"LV_PRIu32", \"warmup_frame_cnt\": %"LV_PRIu32",\n",
+                       cfg->frame_cnt, cfg->warmup_frame_cnt);
+        headless_write("  \"draw_units\": [");
+        for(i = 0; i < headless.unit_cnt; i++) {
+            const char * name = headless.units[i].unit->name;
+            headless_write("%s\"%s\"", i ? ", " : "", name ? name : "unknown");
+        }
+        headless_write("],\n  \"scenes\": [\n");
+    }
+    else {
+        headless_write("scene,frame,render_us,flush_us");
+        for(i = 0; i < headless.unit_cnt; i++) {
+            const char * name = headless.units[i].unit->name;
+            headless_write(",%s_us", name ? name : "unknown");
+        }
+        headless_write("\n");
+    }
+
+    screen_init();
+    for(i = 0; scenes[i].create_cb; i++) {
+        uint32_t frame_cnt = headless_run_scene(i, period);
+        headless_write_scene(i, frame_cnt);
+    }
+    lv_obj_clean(lv_screen_active());
+    lv_anim_delete(lv_screen_active(), NULL);
+    lv_anim_delete(lv_layer_top(), NULL);
+
+    if(cfg->format == LV_DEMO_BENCHMARK_OUTPUT_JSON) headless_write("\n  ]\n}\n");
+
+    lv_display_remove_event_cb_with_user_data(disp, headless_display_event_cb, &headless);
+    lv_tick_set_cb(tick_cb_prev);
+    /*Keep the tick monotonic if it's driven by `lv_tick_inc()`*/
+    if(tick_cb_prev == NULL) lv_tick_inc(headless.tick - tick_start);
+
+    for(i = 0; i < headless.unit_cnt; i++) {
+        headless.units[i].unit->dispatch_cb = headless.units[i].dispatch_cb;
+    }
+
+    lv_free(headless.samples);
+    headless.samples = NULL;
+
+    return LV_RESULT_OK;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
 
+static void screen_init(void)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_remove_style_all(scr);
+    lv_obj_set_style_bg_opa(scr, LV_OPA_COVER, 0);
+    lv_obj_set_style_text_color(scr, lv_color_black(), 0);
+    lv_obj_set_style_bg_color(scr, lv_palette_lighten(LV_PALETTE_GREY, 4), 0);
+    lv_obj_set_style_pad_all(scr, 8, 0);
+    lv_obj_set_style_pad_top(scr, HEADER_HEIGHT, 0);
+    lv_obj_set_style_pad_gap(scr, 8, 0);
+}
+
+static uint32_t headless_tick_cb(void)
+{
+    return headless.tick;
+}
+
+static int32_t headless_dispatch_cb(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
+{
+    headless_unit_t * u = NULL;
+    uint32_t i;
+    for(i = 0; i < headless.unit_cnt; i++) {
+        if(headless.units[i].unit == draw_unit) {
+            u = &headless.units[i];
+            break;
+        }
+    }
+
+    /*Shouldn't happen as only the wrapped units point here*/
+    if(u == NULL) return 0;
+
+    uint32_t t = headless.cfg->time_us_cb();
+    int32_t res = u->dispatch_cb(draw_unit, layer);
+    u->time_sum += headless.cfg->time_us_cb() - t;
+    return res;
+}
+
+static void headless_display_event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    uint32_t t = headless.cfg->time_us_cb();
+    uint32_t i;
+
+    switch(code) {
+        case LV_EVENT_REFR_START:
+            headless.refr_start = t;
+            headless.flush_time = 0;
+            headless.rendered = false;
+            for(i = 0; i < headless.unit_cnt; i++) headless.units[i].time_sum = 0;
+            break;
+        case LV_EVENT_RENDER_START:
+            headless.rendered = true;
+            break;
+        case LV_EVENT_FLUSH_START:
+        case LV_EVENT_FLUSH_WAIT_START:
+            headless.flush_start = t;
+            break;
+        case LV_EVENT_FLUSH_FINISH:
+        case LV_EVENT_FLUSH_WAIT_FINISH:
+            headless.flush_time += t - headless.flush_start;
+            break;
+        case LV_EVENT_REFR_READY:
+            headless.refr_time = t - headless.refr_start;
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * Load a scene and measure `frame_cnt` rendered frames after the warm-up.
+ * @param scene     index of the scene
+ * @param period    refresh period of the display in ms
+ * @return          number of measured frames (less than `frame_cnt` if the scene stopped rendering)
+ */
+static uint32_t headless_run_scene(uint32_t scene, uint32_t period)
+{
+    const lv_demo_benchmark_headless_cfg_t * cfg = headless.cfg;
+    uint32_t rendered_cnt = 0;
+    uint32_t frame_cnt = 0;
+    uint32_t idle_cnt = 0;
+
+    load_scene(scene);
+
+    while(frame_cnt < cfg->frame_cnt && idle_cnt < HEADLESS_IDLE_MAX) {
+        headless.tick += period;
+        headless.rendered = false;
+        lv_timer_handler();
+
+        if(!headless.rendered) {
+            idle_cnt++;
+            continue;
+        }
+
+        idle_cnt = 0;
+        rendered_cnt++;
+        if(rendered_cnt <= cfg->warmup_frame_cnt) continue;
+
+        uint32_t * row = &headless.samples[frame_cnt * headless.col_cnt];
+        row[0] = headless.refr_time - headless.flush_time;
+        row[1] = headless.flush_time;
+        uint32_t i;
+        for(i = 0; i < headless.unit_cnt; i++) row[2 + i] = headless.units[i].time_sum;
+        frame_cnt++;
+    }
+
+    return frame_cnt;
+}
+
+static void headless_write(const char * fmt, ...)
+{
+    char buf[128];
+    va_list args;
+    va_start(args, fmt);
+    lv_vsnprintf(buf, sizeof(buf), fmt, args);
+    va_end(args);
+
+    headless.cfg->write_cb(buf, headless.cfg->user_data);
+}
+
+static void headless_write_column(const char * name, uint32_t col, uint32_t frame_cnt)
+{
+    uint32_t min = UINT32_MAX;
+    uint32_t max = 0;
+    uint64_t sum = 0;
+    uint32_t i;
+    for(i = 0; i < frame_cnt; i++) {
+        uint32_t v = headless.samples[i * headless.col_cnt + col];
+        if(v < min) min = v;
+        if(v > max) max = v;
+        sum += v;
+    }
+    if(frame_cnt == 0) min = 0;
+
+    headless_write("\"%s\": {\"avg\": %"LV_PRIu32", \"min\": %"LV_PRIu32", \"max\": %"LV_PRIu32", \"samples\": [",
+                   name, frame_cnt ? (uint32_t)(sum / frame_cnt) : 0, min, max);
+    for(i = 0; i < frame_cnt; i++) {
+        headless_write("%s%"LV_PRIu32, i ? "," : "", headless.samples[i * headless.col_cnt + col]);
+    }
+    headless_write("]}");
+}
+
+static void headless_write_scene(uint32_t scene, uint32_t frame_cnt)
+{
+    uint32_t i;
+    if(headless.cfg->format == LV_DEMO_BENCHMARK_OUTPUT_CSV) {
+        for(i = 0; i < frame_cnt; i++) {
+            const uint32_t * row = &headless.samples[i * headless.col_cnt];
+            headless_write("\"%s\",%"LV_PRIu32, scenes[scene].name, i);
+            uint32_t c;
+            for(c = 0; c < headless.col_cnt; c++) headless_write(",%"LV_PRIu32, row[c]);
+            headless_write("\n");
+        }
+        return;
+    }
+
+    headless_write("%s    {\"name\": \"%s\", \"frame_cnt\": %"LV_PRIu32",\n     ",
+                   scene ? ",\n" : "", scenes[scene].name, frame_cnt);
+    headless_write_column("render_us", 0, frame_cnt);
+    headless_write(",\n     ");
+    headless_write_column("flush_us", 1, frame_cnt);
+    headless_write(",\n     \"draw_units_us\": {");
+    for(i = 0; i < headless.unit_cnt; i++) {
+        const char * name = headless.units[i].unit->name;
+        headless_write("%s\n       ", i ? "," : "");
+        headless_write_column(name ? name : "unknown", 2 + i, frame_cnt);
+    }
+    headless_write("}}");
+}
+
 static void load_scene(uint32_t scene)
 {
     lv_obj_t * scr = lv_screen_active();
@@ -25,6 +25,26 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+/** Output format of the headless benchmark */
+typedef enum {
+    LV_DEMO_BENCHMARK_OUTPUT_JSON,  /**< One object per scene with a summary and the per-frame samples */
+    LV_DEMO_BENCHMARK_OUTPUT_CSV,   /**< One row per measured frame */
+} lv_demo_benchmark_output_t;
+
+/** Configuration of `lv_demo_benchmark_run_headless()` */
+typedef struct {
+    uint32_t frame_cnt;                 /**< Rendered frames to measure in each scene */
+    uint32_t warmup_frame_cnt;          /**< Rendered frames to drop after loading a scene */
+    lv_demo_benchmark_output_t format;  /**< Format of the report */
+
+    /** Return a timestamp in microseconds, e.g. from `clock_gettime()`. Used only for measuring. */
+    uint32_t (*time_us_cb)(void);
+
+    /** Called with consecutive pieces of the report */
+    void (*write_cb)(const char * str, void * user_data);
+    void * user_data;                   /**< Passed to `write_cb` */
+} lv_demo_benchmark_headless_cfg_t;
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -50,6 +70,35 @@ extern "C" {
  */
 void lv_demo_benchmark(void);
 
+/**
+ * Initialize a headless benchmark configuration with default values:
+ * 300 measured and 10 warm-up frames per scene, JSON output.
+ * @param cfg   pointer to a configuration to initialize
+ */
+void lv_demo_benchmark_headless_cfg_init(lv_demo_benchmark_headless_cfg_t * cfg);
+
+/**
+ * Run all benchmark scenes synchronously on the default display and write a report instead of
+ * drawing the summary table.
+ *
+ * The time is virtual: before every `lv_timer_handler()` call the tick is advanced by one display
+ * refresh period, so every scene is measured on the same frames regardless of the host speed.
+ * The tick callback is restored when the function returns.
+ *
+ * For every measured frame it records
+ * - render time: from `LV_EVENT_REFR_START` to `LV_EVENT_REFR_READY`, minus the flush time
+ * - flush time: the time spent in `flush_cb` and with waiting for flush ready
+ * - the time spent in the `dispatch_cb` of each draw unit. Units which render in their own thread
+ *   only report the time of handing over the tasks.
+ *
+ * Frames in which nothing was rendered are not counted. A scene stops early if nothing was
+ * rendered for 100 consecutive refresh periods.
+ * @param cfg   the configuration. `time_us_cb` and `write_cb` are mandatory.
+ * @return      LV_RESULT_OK: the report was written; LV_RESULT_INVALID: invalid configuration,
+ *              no default display or out of memory
+ */
+lv_result_t lv_demo_benchmark_run_headless(const lv_demo_benchmark_headless_cfg_t * cfg);
+
 /**********************
  *      MACROS
  **********************/
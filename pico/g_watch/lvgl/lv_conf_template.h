@@ -167,6 +167,13 @@
     #define LV_DRAW_SW_SUPPORT_A8           1
     #define LV_DRAW_SW_SUPPORT_I1           1
 
+    /** Specialize the blend dispatch for RGB565 target layers.
+     *  RGB565 (and RGB565A8) layers are checked before the color format switch and call the RGB565
+     *  kernels directly; the switch has no RGB565 cases then.
+     *  Other layer formats (e.g. ARGB8888 intermediate layers) are still dispatched by the switch.
+     *  Useful on MCUs with a fixed 16-bit display. Requires `LV_DRAW_SW_SUPPORT_RGB565`. */
+    #define LV_DRAW_SW_BLEND_SPECIALIZE_RGB565  0
+
     /** Set number of draw units.
      *  - > 1 requires operating system to be enabled in `LV_USE_OS`.
      *  - > 1 means multiple threads will render the screen in parallel. */
@@ -416,6 +423,16 @@
  *  The main logic is like `LV_CACHE_DEF_SIZE` but for image headers. */
 #define LV_IMAGE_HEADER_CACHE_DEF_CNT 0
 
+/** Decode images which are slow to open (files, PNG/JPG etc. `RAW` images) in the background
+ *  and draw a placeholder until they are in the image cache. Requires `LV_CACHE_DEF_SIZE > 0`.
+ *  With `LV_USE_OS` a separate thread decodes the images, else one image is decoded
+ *  per timer period outside of rendering. Start it with `lv_image_decoder_async_set_enabled(true)`. */
+#define LV_USE_IMAGE_DECODER_ASYNC 0
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /** Stack size of the decoder thread */
+    #define LV_IMAGE_DECODER_ASYNC_STACK_SIZE (16 * 1024)
+#endif
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #define LV_GRADIENT_MAX_STOPS   2
@@ -680,6 +697,12 @@
 #define LV_USE_CANVAS     1
 
 #define LV_USE_CHART      1
+#if LV_USE_CHART
+    /** Max size of the buffer of a chart in `LV_CHART_UPDATE_MODE_STREAM` in bytes.
+     *  The buffer has the display's color format and covers the content area of the chart.
+     *  If a larger buffer would be needed the series are drawn as in `LV_CHART_UPDATE_MODE_SHIFT`. */
+    #define LV_CHART_STREAM_BUF_MAX_SIZE (32 * 1024)
+#endif
 
 #define LV_USE_CHECKBOX   1
 
@@ -739,6 +762,8 @@
 
 #define LV_USE_TILEVIEW   1
 
+#define LV_USE_VLIST      1
+
 #define LV_USE_WIN        1
 
 /*==================
@@ -786,6 +811,15 @@
 /** Setting a default driver letter allows skipping the driver prefix in filepaths. */
 #define LV_FS_DEFAULT_DRIVE_LETTER '\0'
 
+/** Size of a block cache in bytes shared by all files of the drivers without `cache_size`.
+ *  Reads are served from fixed size blocks evicted in LRU order, sequential reads are read ahead
+ *  and `lv_fs_prefetch()` can load blocks in advance. 0: disable */
+#define LV_FS_BLOCK_CACHE_SIZE 0
+#if LV_FS_BLOCK_CACHE_SIZE
+    #define LV_FS_BLOCK_CACHE_BLOCK_SIZE 512    /**< Size of a block in bytes */
+    #define LV_FS_BLOCK_CACHE_READ_AHEAD 4      /**< Max. number of blocks to read at once on sequential reads */
+#endif
+
 /** API for fopen, fread, etc. */
 #define LV_USE_FS_STDIO 0
 #if LV_USE_FS_STDIO
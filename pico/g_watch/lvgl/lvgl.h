@@ -37,6 +37,7 @@ extern "C" {
 #include "src/misc/lv_circle_buf.h"
 #include "src/misc/lv_tree.h"
 #include "src/misc/cache/lv_image_cache.h"
+#include "src/draw/lv_image_decoder_async.h"
 
 #include "src/tick/lv_tick.h"
 
@@ -82,6 +83,7 @@ extern "C" {
 #include "src/widgets/tabview/lv_tabview.h"
 #include "src/widgets/textarea/lv_textarea.h"
 #include "src/widgets/tileview/lv_tileview.h"
+#include "src/widgets/vlist/lv_vlist.h"
 #include "src/widgets/win/lv_win.h"
 
 #include "src/others/snapshot/lv_snapshot.h"
@@ -456,32 +456,61 @@ class LVGLCompressData:
     def __init__(self,
                  cf: ColorFormat,
                  method: CompressMethod,
-                 raw_data: bytes = b''):
+                 raw_data: bytes = b'',
+                 band_stride: int = 0,
+                 band_height: int = 0):
+        """
+        If band_height is not 0, every band_height rows (of band_stride bytes)
+        are compressed independently, so the decoder can decompress only the
+        rows it draws. A table of band offsets precedes the bands.
+        """
         self.blk_size = (cf.bpp + 7) // 8
         self.compress = method
         self.raw_data = raw_data
         self.raw_data_len = len(raw_data)
+        self.band_stride = band_stride
+        self.band_height = band_height if band_stride else 0
+        if self.band_height > 0xfff:
+            raise ParameterError(f"Band height too large: {band_height}")
         self.compressed = self._compress(raw_data)
 
-    def _compress(self, raw_data: bytes) -> bytearray:
-        if self.compress == CompressMethod.NONE:
-            return raw_data
-
+    def _compress_block(self, raw_data: bytes) -> bytes:
         if self.compress == CompressMethod.RLE:
             # RLE compression performs on pixel unit, pad data to pixel unit
             pad = b'\x00' * 0
-            if self.raw_data_len % self.blk_size:
-                pad = b'\x00' * (self.blk_size - self.raw_data_len % self.blk_size)
+            if len(raw_data) % self.blk_size:
+                pad = b'\x00' * (self.blk_size - len(raw_data) % self.blk_size)
             compressed = RLEImage().rle_compress(raw_data + pad, self.blk_size)
         elif self.compress == CompressMethod.LZ4:
             compressed = lz4.block.compress(raw_data, store_size=False)
         else:
             raise ParameterError(f"Invalid compress method: {self.compress}")
+        return compressed
+
+    def _compress(self, raw_data: bytes) -> bytearray:
+        if self.compress == CompressMethod.NONE:
+            return raw_data
+
+        if self.band_height:
+            band_size = self.band_stride * self.band_height
+            bands = [
+                self._compress_block(raw_data[i:i + band_size])
+                for i in range(0, len(raw_data), band_size)
+            ]
+            table = bytearray()
+            offset = (len(bands) + 1) * 4
+            for band in bands:
+                table += uint32_t(offset)
+                offset += len(band)
+            table += uint32_t(offset)
+            compressed = bytes(table) + b"".join(bands)
+        else:
+            compressed = self._compress_block(raw_data)
 
         self.compressed_len = len(compressed)
 
         bin = bytearray()
-        bin += uint32_t(self.compress.value)
+        bin += uint32_t(self.compress.value | self.band_height << 4)
         bin += uint32_t(self.compressed_len)
         bin += uint32_t(self.raw_data_len)
         bin += compressed
@@ -741,9 +770,17 @@ class LVGLImage:
             logging.info(f"mkdir of {dir} for {filename}")
             os.makedirs(dir)
 
+    def _band_args(self, band_height: int):
+        # Only formats storing the rows one after the other can be split to bands
+        if band_height and self.cf in (ColorFormat.RGB565, ColorFormat.ARGB8565, ColorFormat.RGB888,
+                                       ColorFormat.XRGB8888, ColorFormat.ARGB8888):
+            return self.stride, band_height
+        return 0, 0
+
     def to_bin(self,
                filename: str,
-               compress: CompressMethod = CompressMethod.NONE):
+               compress: CompressMethod = CompressMethod.NONE,
+               band_height: int = 0):
         """
         Write this image to file, filename should be ended with '.bin'
         """
@@ -762,7 +799,8 @@ class LVGLImage:
                                      self.stride,
                                      flags=flags)
             bin += header.binary
-            compressed = LVGLCompressData(self.cf, compress, self.data)
+            compressed = LVGLCompressData(self.cf, compress, self.data,
+                                          *self._band_args(band_height))
             bin += compressed.compressed
 
             f.write(bin)
@@ -771,12 +809,14 @@ class LVGLImage:
 
     def to_c_array(self,
                    filename: str,
-                   compress: CompressMethod = CompressMethod.NONE):
+                   compress: CompressMethod = CompressMethod.NONE,
+                   band_height: int = 0):
         self._check_ext(filename, ".c")
         self._check_dir(filename)
 
         if compress != CompressMethod.NONE:
-            data = LVGLCompressData(self.cf, compress, self.data).compressed
+            data = LVGLCompressData(self.cf, compress, self.data,
+                                    *self._band_args(band_height)).compressed
         else:
             data = self.data
         write_c_array_file(self.w, self.h, self.stride, self.cf, filename,
@@ -1212,6 +1252,7 @@ class PNGConverter:
                  align: int = 1,
                  premultiply: bool = False,
                  compress: CompressMethod = CompressMethod.NONE,
+                 band_height: int = 0,
                  keep_folder=True) -> None:
         self.files = files
         self.cf = cf
@@ -1222,6 +1263,7 @@ class PNGConverter:
         self.align = align
         self.premultiply = premultiply
         self.compress = compress
+        self.band_height = band_height
         self.background = background
 
     def _replace_ext(self, input, ext):
@@ -1248,10 +1290,12 @@ class PNGConverter:
                 output.append((f, img))
                 if self.ofmt == OutputFormat.BIN_FILE:
                     img.to_bin(self._replace_ext(f, ".bin"),
-                               compress=self.compress)
+                               compress=self.compress,
+                               band_height=self.band_height)
                 elif self.ofmt == OutputFormat.C_ARRAY:
                     img.to_c_array(self._replace_ext(f, ".c"),
-                                   compress=self.compress)
+                                   compress=self.compress,
+                                   band_height=self.band_height)
                 elif self.ofmt == OutputFormat.PNG_FILE:
                     img.to_png(self._replace_ext(f, ".png"))
 
@@ -1283,6 +1327,14 @@ def main():
                         default="NONE",
                         choices=["NONE", "RLE", "LZ4"])
 
+    parser.add_argument('--band-height',
+                        help=("compress every N rows independently so that "
+                              "only the drawn rows are decompressed, 0 to "
+                              "compress the whole image at once"),
+                        default=0,
+                        type=int,
+                        metavar='rows')
+
     parser.add_argument('--align',
                         help="stride alignment in bytes for bin image",
                         default=1,
@@ -1334,6 +1386,7 @@ def main():
                              align=args.align,
                              premultiply=args.premultiply,
                              compress=compress,
+                             band_height=args.band_height,
                              keep_folder=False)
     output = converter.convert()
     for f, img in output:
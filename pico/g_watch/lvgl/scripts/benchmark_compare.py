@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+
+"""
+Compare two reports of `lv_demo_benchmark_run_headless()` (JSON or CSV) scene by scene.
+
+For every scene and metric it prints the mean of both runs, the relative change and the p-value
+of Welch's t-test on the per-frame samples. A change is reported as significant if the p-value
+is below `--alpha` and the relative change is above `--threshold`.
+
+Exit code: 0 no significant slowdown, 1 at least one scene got significantly slower, 2 bad input.
+"""
+
+import argparse
+import csv
+import json
+import math
+import sys
+
+METRICS = ['render_us', 'flush_us']
+
+
+def get_arg():
+    parser = argparse.ArgumentParser(description='Compare two headless benchmark reports.')
+    parser.add_argument('base', metavar='base', type=str,
+                        help='Report of the reference run.')
+    parser.add_argument('new', metavar='new', type=str,
+                        help='Report of the run to check.')
+    parser.add_argument('--alpha', type=float, default=0.01,
+                        help='Significance level of the t-test. Default: 0.01')
+    parser.add_argument('--threshold', type=float, default=5.0,
+                        help='Ignore changes smaller than this many percent. Default: 5')
+    parser.add_argument('--metric', action='append', choices=METRICS + ['draw_units'],
+                        help='Metric to compare, can be repeated. Default: render_us')
+
+    args = parser.parse_args()
+    if not args.metric:
+        args.metric = ['render_us']
+    return args
+
+
+def load(path):
+    '''Return {scene: {metric: [samples]}}. Draw unit metrics are named `<unit>_us`.'''
+    with open(path, newline='') as f:
+        text = f.read()
+
+    scenes = {}
+    if text.lstrip().startswith('{'):
+        report = json.loads(text)
+        for scene in report['scenes']:
+            metrics = {m: scene[m]['samples'] for m in METRICS}
+            for unit, data in scene.get('draw_units_us', {}).items():
+                metrics[unit + '_us'] = data['samples']
+            scenes[scene['name']] = metrics
+    else:
+        for row in csv.DictReader(text.splitlines()):
+            metrics = scenes.setdefault(row.pop('scene'), {})
+            row.pop('frame')
+            for key, value in row.items():
+                metrics.setdefault(key, []).append(int(value))
+
+    return scenes
+
+
+def betacf(a, b, x):
+    '''Continued fraction of the incomplete beta function (modified Lentz's method).'''
+    tiny = 1e-300
+    qab = a + b
+    qap = a + 1.0
+    qam = a - 1.0
+    c = 1.0
+    d = 1.0 - qab * x / qap
+    d = 1.0 / (d if abs(d) > tiny else tiny)
+    h = d
+    for m in range(1, 300):
+        m2 = 2 * m
+        aa = m * (b - m) * x / ((qam + m2) * (a + m2))
+        d = 1.0 + aa * d
+        d = 1.0 / (d if abs(d) > tiny else tiny)
+        c = 1.0 + aa / c
+        c = c if abs(c) > tiny else tiny
+        h *= d * c
+        aa = -(a + m) * (qab + m) * x / ((a + m2) * (qap + m2))
+        d = 1.0 + aa * d
+        d = 1.0 / (d if abs(d) > tiny else tiny)
+        c = 1.0 + aa / c
+        c = c if abs(c) > tiny else tiny
+        de = d * c
+        h *= de
+        if abs(de - 1.0) < 1e-12:
+            break
+    return h
+
+
+def betai(a, b, x):
+    '''Regularized incomplete beta function I_x(a, b).'''
+    if x <= 0.0:
+        return 0.0
+    if x >= 1.0:
+        return 1.0
+    lbeta = math.lgamma(a + b) - math.lgamma(a) - math.lgamma(b)
+    front = math.exp(lbeta + a * math.log(x) + b * math.log(1.0 - x))
+    if x < (a + 1.0) / (a + b + 2.0):
+        return front * betacf(a, b, x) / a
+    return 1.0 - front * betacf(b, a, 1.0 - x) / b
+
+
+def mean_var(samples):
+    n = len(samples)
+    mean = sum(samples) / n
+    var = sum((s - mean) ** 2 for s in samples) / (n - 1) if n > 1 else 0.0
+    return mean, var
+
+
+def welch(a, b):
+    '''Return the two sided p-value of Welch's t-test.'''
+    if len(a) < 2 or len(b) < 2:
+        return 1.0
+    ma, va = mean_var(a)
+    mb, vb = mean_var(b)
+    sa = va / len(a)
+    sb = vb / len(b)
+    if sa + sb == 0.0:
+        return 1.0 if ma == mb else 0.0
+    t = (mb - ma) / math.sqrt(sa + sb)
+    df = (sa + sb) ** 2 / (sa ** 2 / (len(a) - 1) + sb ** 2 / (len(b) - 1))
+    return betai(df / 2.0, 0.5, df / (df + t * t))
+
+
+def compare(base, new, metrics, alpha, threshold):
+    '''Print a table and return the number of significant slowdowns.'''
+    slower = 0
+    print('%-28s %-12s %10s %10s %8s %9s' % ('scene', 'metric', 'base', 'new', 'change', 'p-value'))
+    for scene, base_metrics in base.items():
+        new_metrics = new.get(scene)
+        if new_metrics is None:
+            print('%-28s missing from the new run' % scene)
+            continue
+
+        keys = [k for k in base_metrics if k not in METRICS] if 'draw_units' in metrics else []
+        keys = [m for m in metrics if m != 'draw_units'] + keys
+        for key in keys:
+            a = base_metrics.get(key, [])
+            b = new_metrics.get(key, [])
+            if not a or not b:
+                continue
+            ma = sum(a) / len(a)
+            mb = sum(b) / len(b)
+            change = (mb - ma) * 100.0 / ma if ma else 0.0
+            p = welch(a, b)
+            mark = ''
+            if p < alpha and abs(change) >= threshold:
+                mark = 'slower' if change > 0 else 'faster'
+                if change > 0:
+                    slower += 1
+            print('%-28s %-12s %10.1f %10.1f %+7.1f%% %9.2g %s' % (scene, key, ma, mb, change, p, mark))
+
+    return slower
+
+
+if __name__ == '__main__':
+    args = get_arg()
+
+    try:
+        base = load(args.base)
+        new = load(args.new)
+    except (OSError, ValueError, KeyError) as e:
+        print('error:', e, file=sys.stderr)
+        sys.exit(2)
+
+    slower = compare(base, new, args.metric, args.alpha, args.threshold)
+    print('significantly slower:', slower)
+    sys.exit(1 if slower else 0)
@@ -0,0 +1,130 @@
+#!/usr/bin/env python3
+
+"""
+Convert the binary output of the built-in profiler (`flush_bin_cb`) to a Chrome trace JSON file.
+The result can be opened with https://ui.perfetto.dev or chrome://tracing.
+
+Besides the per-thread tracks it adds
+ - a "Draw tasks" process with one track per draw task type (`draw_task_*` tags)
+ - a "Refresh areas" process where every `refr_area` call of a frame is a separate slice
+"""
+
+import argparse
+import json
+import struct
+from pathlib import Path
+
+HEADER_FMT = '<4sBBHII'
+HEADER_SIZE = struct.calcsize(HEADER_FMT)
+MAGIC = b'LVPF'
+VERSION = 1
+
+PID_THREADS = 1
+PID_DRAW_TASKS = 2
+PID_REFR_AREAS = 3
+
+FRAME_TAG = 'lv_display_refr_timer'
+REFR_AREA_TAG = 'refr_area'
+DRAW_TASK_PREFIX = 'draw_task_'
+
+
+def get_arg():
+    parser = argparse.ArgumentParser(description='Convert a binary profiler capture to a Chrome trace JSON file.')
+    parser.add_argument('bin_file', metavar='bin_file', type=str,
+                        help='The binary capture written by flush_bin_cb.')
+    parser.add_argument('json_file', metavar='json_file', type=str, nargs='?',
+                        help='The output trace file. If not provided, defaults to \'<bin_file>.json\'.')
+
+    args = parser.parse_args()
+    return args
+
+
+def parse(data):
+    '''Return (tick_per_sec, [(tick, name, tag, cpu, tid), ...]) from a binary capture.'''
+    magic, version, item_size, _, tick_per_sec, _ = struct.unpack_from(HEADER_FMT, data, 0)
+    if magic != MAGIC:
+        raise ValueError('not a profiler capture (bad magic)')
+    if version != VERSION:
+        raise ValueError('unsupported version %d' % version)
+    if item_size not in (8, 12):
+        raise ValueError('unsupported item size %d' % item_size)
+
+    names = {}
+    items = []
+    pos = HEADER_SIZE
+    while pos < len(data):
+        chunk = data[pos:pos + 1]
+        if chunk == b'S':
+            _, tag_id, length = struct.unpack_from('<BHH', data, pos + 1)
+            pos += 6
+            names[tag_id] = data[pos:pos + length].decode('utf-8', errors='replace')
+            pos += length
+        elif chunk == b'I':
+            _, _, count = struct.unpack_from('<BHI', data, pos + 1)
+            pos += 8
+            for _ in range(count):
+                tick, tag_id, tag, cpu = struct.unpack_from('<IHcB', data, pos)
+                tid = struct.unpack_from('<i', data, pos + 8)[0] if item_size == 12 else 1
+                items.append((tick, names.get(tag_id, 'unknown'), tag.decode(), cpu, tid))
+                pos += item_size
+        else:
+            raise ValueError('unknown chunk %r at offset %d' % (chunk, pos))
+
+    return tick_per_sec, items
+
+
+def to_chrome_trace(tick_per_sec, items):
+    events = []
+    draw_task_tids = {}
+    frame = 0
+    area_idx = 0
+
+    def meta(pid, tid, key, name):
+        events.append({'ph': 'M', 'pid': pid, 'tid': tid, 'name': key, 'args': {'name': name}})
+
+    meta(PID_THREADS, 0, 'process_name', 'LVGL')
+    meta(PID_DRAW_TASKS, 0, 'process_name', 'Draw tasks')
+    meta(PID_REFR_AREAS, 0, 'process_name', 'Refresh areas')
+
+    for tick, name, tag, cpu, tid in items:
+        ts = tick * 1000000.0 / tick_per_sec
+        events.append({'ph': tag, 'ts': ts, 'pid': PID_THREADS, 'tid': tid, 'name': name,
+                       'args': {'cpu': cpu}})
+
+        if name.startswith(DRAW_TASK_PREFIX):
+            track = draw_task_tids.get(name)
+            if track is None:
+                track = len(draw_task_tids) + 1
+                draw_task_tids[name] = track
+                meta(PID_DRAW_TASKS, track, 'thread_name', name[len(DRAW_TASK_PREFIX):])
+            events.append({'ph': tag, 'ts': ts, 'pid': PID_DRAW_TASKS, 'tid': track, 'name': name})
+
+        elif name == FRAME_TAG and tag == 'B':
+            frame += 1
+            area_idx = 0
+
+        elif name == REFR_AREA_TAG:
+            if tag == 'B':
+                area_idx += 1
+            events.append({'ph': tag, 'ts': ts, 'pid': PID_REFR_AREAS, 'tid': 1,
+                           'name': 'frame %d area %d' % (frame, area_idx)})
+
+    return {'traceEvents': events, 'displayTimeUnit': 'ms'}
+
+
+if __name__ == '__main__':
+    args = get_arg()
+
+    if not args.json_file:
+        args.json_file = Path(args.bin_file).with_suffix('.json').as_posix()
+
+    print('bin_file :', args.bin_file)
+    print('json_file:', args.json_file)
+
+    with open(args.bin_file, 'rb') as f:
+        tick_per_sec, items = parse(f.read())
+
+    with open(args.json_file, 'w') as f:
+        json.dump(to_chrome_trace(tick_per_sec, items), f)
+
+    print('events   :', len(items))
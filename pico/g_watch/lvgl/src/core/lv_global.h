@@ -68,6 +68,14 @@ struct _snippet_stack;
 struct _lv_freetype_context_t;
 #endif
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+struct _lv_image_decoder_async_t;
+#endif
+
+#if LV_FS_BLOCK_CACHE_SIZE
+struct _lv_fs_block_cache_t;
+#endif
+
 #if LV_USE_PROFILER && LV_USE_PROFILER_BUILTIN
 struct _lv_profiler_builtin_ctx_t;
 #endif
@@ -120,6 +128,9 @@ typedef struct _lv_global_t {
 
     lv_cache_t * img_cache;
     lv_cache_t * img_header_cache;
+#if LV_USE_IMAGE_DECODER_ASYNC
+    struct _lv_image_decoder_async_t * image_decoder_async;
+#endif
 
     lv_draw_global_info_t draw_info;
 #if defined(LV_DRAW_SW_SHADOW_CACHE_SIZE) && LV_DRAW_SW_SHADOW_CACHE_SIZE > 0
@@ -154,6 +165,9 @@ typedef struct _lv_global_t {
 #endif
 
     lv_ll_t fsdrv_ll;
+#if LV_FS_BLOCK_CACHE_SIZE
+    struct _lv_fs_block_cache_t * fs_block_cache;
+#endif
 #if LV_USE_FS_STDIO != '\0'
     lv_fs_drv_t stdio_fs_drv;
 #endif
@@ -51,6 +51,15 @@ static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
 static void draw_buf_flush(lv_display_t * disp);
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 static void wait_for_flushing(lv_display_t * disp);
+static bool scroll_copy_check(lv_display_t * disp, lv_obj_t * obj);
+static bool scroll_copy_area(lv_display_t * disp, lv_obj_t * obj, const lv_area_t * area, int32_t dx, int32_t dy,
+                             bool scrolled);
+static void scroll_copy_inv_overlay(lv_display_t * disp, const lv_area_t * area, const lv_area_t * region,
+                                    int32_t dx, int32_t dy);
+static void scroll_copy_inv_obj(lv_display_t * disp, lv_obj_t * obj, const lv_area_t * region, int32_t dx, int32_t dy);
+static void scroll_copy_inv_layer(lv_display_t * disp, lv_obj_t * layer, const lv_area_t * region, int32_t dx,
+                                  int32_t dy);
+static void refr_scroll_copy(void);
 
 /**********************
  *  STATIC VARIABLES
@@ -327,6 +336,33 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 }
 
+bool lv_refr_scroll_copy(lv_obj_t * obj, int32_t dx, int32_t dy)
+{
+    lv_display_t * disp = lv_obj_get_display(obj);
+    if(!scroll_copy_check(disp, obj)) return false;
+
+    /*The pixels inside the border and the rounded corners move together with the children*/
+    lv_area_t region = obj->coords;
+    int32_t border_w = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    int32_t radius = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    int32_t short_side = LV_MIN(lv_area_get_width(&obj->coords), lv_area_get_height(&obj->coords));
+    radius = LV_MIN(radius, short_side / 2);
+    region.x1 += border_w;
+    region.x2 -= border_w;
+    region.y1 += LV_MAX(border_w, radius);
+    region.y2 -= LV_MAX(border_w, radius);
+
+    return scroll_copy_area(disp, obj, &region, dx, dy, true);
+}
+
+bool lv_refr_move_area(lv_obj_t * obj, const lv_area_t * area, int32_t dx, int32_t dy)
+{
+    lv_display_t * disp = lv_obj_get_display(obj);
+    if(!scroll_copy_check(disp, obj)) return false;
+
+    return scroll_copy_area(disp, obj, area, dx, dy, false);
+}
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
@@ -397,6 +433,7 @@ void lv_display_refr_timer(lv_timer_t * tmr)
 
     lv_refr_join_area();
     refr_sync_areas();
+    refr_scroll_copy();
     refr_invalid_areas();
 
     if(disp_refr->inv_p == 0) goto refr_finish;
@@ -550,6 +587,81 @@ static void refr_sync_areas(void)
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Move the pixels of the scrolled area in the draw buffer and/or on the display
+ */
+static void refr_scroll_copy(void)
+{
+    if(!disp_refr->scroll_copy_pending) return;
+    disp_refr->scroll_copy_pending = 0;
+
+    int32_t dx = disp_refr->scroll_copy_ofs.x;
+    int32_t dy = disp_refr->scroll_copy_ofs.y;
+    if(dx == 0 && dy == 0) return;
+
+    LV_PROFILER_REFR_BEGIN;
+
+    const lv_area_t * area = &disp_refr->scroll_copy_area;
+
+    /*The panel can't be modified while the previous frame is being sent*/
+    wait_for_flushing(disp_refr);
+
+    if(disp_refr->render_mode != LV_DISPLAY_RENDER_MODE_DIRECT) {
+        if(!disp_refr->scroll_cb(disp_refr, area, dx, dy)) {
+            /*Redraw the area and don't let it be skipped as joined*/
+            uint32_t inv_p = disp_refr->inv_p;
+            lv_inv_area(disp_refr, area);
+            if(disp_refr->inv_p != inv_p) disp_refr->inv_area_joined[disp_refr->inv_p - 1] = 0;
+        }
+        LV_PROFILER_REFR_END;
+        return;
+    }
+
+    /*Where the pixels go and where they come from*/
+    lv_area_t dest = *area;
+    lv_area_move(&dest, dx, dy);
+    lv_area_intersect(&dest, &dest, area);
+    lv_area_t src = dest;
+    lv_area_move(&src, -dx, -dy);
+
+    lv_draw_buf_t * buf = disp_refr->buf_act;
+    if(lv_display_is_double_buffered(disp_refr)) {
+        /*The other buffer has the last frame*/
+        lv_draw_buf_t * on_screen = buf == disp_refr->buf_1 ? disp_refr->buf_2 : disp_refr->buf_1;
+        lv_draw_buf_copy(buf, &dest, on_screen, &src);
+
+        /*Sync the moved pixels to the other buffer after this frame*/
+        lv_area_t * sync_area = lv_ll_ins_tail(&disp_refr->sync_areas);
+        if(sync_area) *sync_area = dest;
+    }
+    else {
+        /*Move the lines in place. Go against the direction of the move to not overwrite the source*/
+        uint32_t line_bytes = (lv_area_get_width(&dest) * lv_color_format_get_bpp(buf->header.cf) + 7) >> 3;
+        int32_t h = lv_area_get_height(&dest);
+        int32_t y;
+        for(y = 0; y < h; y++) {
+            int32_t dest_y = dy > 0 ? dest.y2 - y : dest.y1 + y;
+            lv_memmove(lv_draw_buf_goto_xy(buf, dest.x1, dest_y),
+                       lv_draw_buf_goto_xy(buf, src.x1, dest_y - dy), line_bytes);
+        }
+    }
+
+    /*Let the panel move the pixels if it can, else send them*/
+    if(disp_refr->scroll_cb == NULL || !disp_refr->scroll_cb(disp_refr, area, dx, dy)) {
+        /*The driver might need to adjust the area (e.g. round it)*/
+        lv_display_send_event(disp_refr, LV_EVENT_INVALIDATE_AREA, &dest);
+
+        lv_layer_t * layer = disp_refr->layer_head;
+        layer->draw_buf = buf;
+        disp_refr->refreshed_area = dest;
+        disp_refr->last_area = disp_refr->inv_p == 0;
+        disp_refr->last_part = disp_refr->last_area;
+        draw_buf_flush(disp_refr);
+    }
+
+    LV_PROFILER_REFR_END;
+}
+
 /**
  * Refresh the joined areas
  */
@@ -1297,6 +1409,230 @@ static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t *
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Move the pixels of an area of an object and invalidate what doesn't move with them
+ * @param disp      display of the object
+ * @param obj       the object
+ * @param area      the area to move
+ * @param dx        move by this many pixels horizontally...
+ * @param dy        ...and vertically
+ * @param scrolled  true: the object is scrolled, its children and the pixels in `area` move together;
+ *                  false: only the object's own pixels in `area` move, all the children are drawn over them
+ * @return          true: the pixels will be moved; false: the area needs to be invalidated
+ */
+static bool scroll_copy_area(lv_display_t * disp, lv_obj_t * obj, const lv_area_t * area, int32_t dx, int32_t dy,
+                             bool scrolled)
+{
+    lv_area_t region = *area;
+    lv_area_t scr_area;
+    lv_area_set(&scr_area, 0, 0, lv_display_get_horizontal_resolution(disp) - 1,
+                lv_display_get_vertical_resolution(disp) - 1);
+    if(!lv_area_intersect(&region, &region, &scr_area)) return false;
+    if(!lv_obj_area_is_visible(obj, &region)) return false;
+
+    /*Add the new offset to the pending move of the same area*/
+    lv_point_t ofs = {dx, dy};
+    if(disp->scroll_copy_pending) {
+        if(!lv_area_is_equal(&disp->scroll_copy_area, &region)) {
+            disp->scroll_copy_pending = 0;
+            lv_inv_area(disp, &disp->scroll_copy_area);
+            return false;
+        }
+        ofs.x += disp->scroll_copy_ofs.x;
+        ofs.y += disp->scroll_copy_ofs.y;
+    }
+
+    if(LV_ABS(ofs.x) >= lv_area_get_width(&region) || LV_ABS(ofs.y) >= lv_area_get_height(&region)) {
+        disp->scroll_copy_pending = 0;
+        return false;
+    }
+
+    /*The already invalidated parts will be moved too so invalidate them on their new place as well.
+     *If the invalidated areas overflow and the whole screen is invalidated there is nothing to do*/
+    uint32_t inv_cnt = disp->inv_p;
+    uint32_t i;
+    for(i = 0; i < inv_cnt && i < disp->inv_p; i++) {
+        lv_area_t a;
+        if(!lv_area_intersect(&a, &disp->inv_areas[i], &region)) continue;
+        lv_area_move(&a, dx, dy);
+        if(lv_area_intersect(&a, &a, &region)) lv_inv_area(disp, &a);
+    }
+
+    /*The newly exposed strips*/
+    lv_area_t moved = region;
+    lv_area_move(&moved, dx, dy);
+    lv_area_t diff[4];
+    int8_t diff_cnt = lv_area_diff(diff, &region, &moved);
+    int8_t j;
+    for(j = 0; j < diff_cnt; j++) lv_inv_area(disp, &diff[j]);
+
+    /*The border and the corners where the children are also visible*/
+    lv_area_t obj_area = obj->coords;
+    if(scrolled && lv_obj_area_is_visible(obj, &obj_area)) {
+        diff_cnt = lv_area_diff(diff, &obj_area, &region);
+        for(j = 0; j < diff_cnt; j++) lv_inv_area(disp, &diff[j]);
+    }
+
+    /*The scrollbars of the object. Invalidate the whole track as the thumb is moving on it*/
+    lv_area_t hor_area;
+    lv_area_t ver_area;
+    lv_obj_get_scrollbar_area(obj, &hor_area, &ver_area);
+    if(lv_area_get_size(&hor_area) > 0) {
+        hor_area.x1 = obj->coords.x1;
+        hor_area.x2 = obj->coords.x2;
+        scroll_copy_inv_overlay(disp, &hor_area, &region, dx, dy);
+    }
+    if(lv_area_get_size(&ver_area) > 0) {
+        ver_area.y1 = obj->coords.y1;
+        ver_area.y2 = obj->coords.y2;
+        scroll_copy_inv_overlay(disp, &ver_area, &region, dx, dy);
+    }
+
+    /*The children which are not moving with the scroll*/
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        lv_obj_t * child = obj->spec_attr->children[i];
+        if(!scrolled || lv_obj_has_flag(child, LV_OBJ_FLAG_FLOATING)) {
+            scroll_copy_inv_obj(disp, child, &region, dx, dy);
+        }
+    }
+
+    /*Everything drawn on the object: the next siblings and the scrollbars of the parents*/
+    lv_obj_t * o = obj;
+    lv_obj_t * parent = lv_obj_get_parent(o);
+    while(parent) {
+        child_cnt = lv_obj_get_child_count(parent);
+        for(i = lv_obj_get_index(o) + 1; i < child_cnt; i++) {
+            scroll_copy_inv_obj(disp, parent->spec_attr->children[i], &region, dx, dy);
+        }
+
+        lv_obj_get_scrollbar_area(parent, &hor_area, &ver_area);
+        scroll_copy_inv_overlay(disp, &hor_area, &region, dx, dy);
+        scroll_copy_inv_overlay(disp, &ver_area, &region, dx, dy);
+
+        o = parent;
+        parent = lv_obj_get_parent(o);
+    }
+
+    if(o == disp->act_scr) scroll_copy_inv_layer(disp, disp->top_layer, &region, dx, dy);
+    if(o != disp->sys_layer) scroll_copy_inv_layer(disp, disp->sys_layer, &region, dx, dy);
+
+    disp->scroll_copy_area = region;
+    disp->scroll_copy_ofs = ofs;
+    disp->scroll_copy_pending = 1;
+
+    return true;
+}
+
+/**
+ * Check if the rendered pixels of a scrolled object can be moved
+ * @param disp  display of the object
+ * @param obj   the scrolled object
+ * @return      true: the pixels can be moved
+ */
+static bool scroll_copy_check(lv_display_t * disp, lv_obj_t * obj)
+{
+    if(disp == NULL || !disp->scroll_copy_en) return false;
+    if(!lv_display_is_invalidation_enabled(disp) || disp->rendering_in_progress) return false;
+    if(disp->rotation != LV_DISPLAY_ROTATION_0 || disp->prev_scr) return false;
+
+    if(disp->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) {
+        /*Whole bytes are needed to move the pixels in the buffer*/
+        if(lv_color_format_get_bpp(disp->color_format) < 8) return false;
+    }
+    else if(disp->render_mode != LV_DISPLAY_RENDER_MODE_PARTIAL || disp->scroll_cb == NULL) {
+        return false;
+    }
+
+    /*The background must cover everything behind the children and mustn't move with them*/
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_OVERFLOW_VISIBLE)) return false;
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) < LV_OPA_COVER) return false;
+    if(lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN) < LV_OPA_COVER) return false;
+    if(lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE) return false;
+    if(lv_obj_get_style_bg_grad(obj, LV_PART_MAIN) != NULL) return false;
+    if(lv_obj_get_style_bg_image_src(obj, LV_PART_MAIN) != NULL) return false;
+
+    /*The object must be drawn directly to the screen*/
+    lv_obj_t * scr = lv_obj_get_screen(obj);
+    if(scr != disp->act_scr && scr != disp->top_layer && scr != disp->sys_layer) return false;
+
+    lv_obj_t * o;
+    for(o = obj; o; o = lv_obj_get_parent(o)) {
+        if(lv_obj_get_layer_type(o) != LV_LAYER_TYPE_NONE) return false;
+        if(o == obj) continue;
+
+        /*Masks and borders of the parents drawn on the object*/
+        if(lv_obj_get_style_clip_corner(o, LV_PART_MAIN) &&
+           lv_obj_get_style_radius(o, LV_PART_MAIN) > 0) return false;
+        if(lv_obj_get_style_border_post(o, LV_PART_MAIN) &&
+           lv_obj_get_style_border_width(o, LV_PART_MAIN) > 0) return false;
+    }
+
+    /*A layer with background covers the whole screen*/
+    if(scr == disp->act_scr && lv_obj_get_style_bg_opa(disp->top_layer, LV_PART_MAIN) > LV_OPA_TRANSP) return false;
+    if(scr != disp->sys_layer && lv_obj_get_style_bg_opa(disp->sys_layer, LV_PART_MAIN) > LV_OPA_TRANSP) return false;
+
+    return true;
+}
+
+/**
+ * Invalidate an area which is drawn over the scrolled region but doesn't move with it.
+ * Its pixels are moved with the region so it's invalidated on its new place too.
+ * @param disp      pointer to the display
+ * @param area      the overlay's area
+ * @param region    the moved region
+ * @param dx        horizontal move
+ * @param dy        vertical move
+ */
+static void scroll_copy_inv_overlay(lv_display_t * disp, const lv_area_t * area, const lv_area_t * region,
+                                    int32_t dx, int32_t dy)
+{
+    lv_area_t a;
+    if(!lv_area_intersect(&a, area, region)) return;
+    lv_inv_area(disp, &a);
+
+    lv_area_move(&a, dx, dy);
+    if(lv_area_intersect(&a, &a, region)) lv_inv_area(disp, &a);
+}
+
+/**
+ * Invalidate an object drawn over the scrolled region
+ * @param disp      pointer to the display
+ * @param obj       the overlay object
+ * @param region    the moved region
+ * @param dx        horizontal move
+ * @param dy        vertical move
+ */
+static void scroll_copy_inv_obj(lv_display_t * disp, lv_obj_t * obj, const lv_area_t * region, int32_t dx, int32_t dy)
+{
+    lv_area_t a = obj->coords;
+    int32_t ext_size = lv_obj_get_ext_draw_size(obj);
+    lv_area_increase(&a, ext_size, ext_size);
+    if(!lv_obj_area_is_visible(obj, &a)) return;
+
+    scroll_copy_inv_overlay(disp, &a, region, dx, dy);
+}
+
+/**
+ * Invalidate the children of the top or system layer drawn over the scrolled region
+ * @param disp      pointer to the display
+ * @param layer     the top or system layer
+ * @param region    the moved region
+ * @param dx        horizontal move
+ * @param dy        vertical move
+ */
+static void scroll_copy_inv_layer(lv_display_t * disp, lv_obj_t * layer, const lv_area_t * region, int32_t dx,
+                                  int32_t dy)
+{
+    if(layer == NULL) return;
+
+    uint32_t child_cnt = lv_obj_get_child_count(layer);
+    uint32_t i;
+    for(i = 0; i < child_cnt; i++) {
+        scroll_copy_inv_obj(disp, layer->spec_attr->children[i], region, dx, dy);
+    }
+}
+
 static void wait_for_flushing(lv_display_t * disp)
 {
     LV_PROFILER_REFR_BEGIN;
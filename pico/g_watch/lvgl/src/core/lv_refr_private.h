@@ -46,6 +46,31 @@ void lv_refr_deinit(void);
  */
 void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p);
 
+/**
+ * Invalidate a scrolled object by moving its already rendered pixels if possible.
+ * Only the newly exposed strips and the Widgets overlapping the object are invalidated.
+ * Called after the children of the object were moved.
+ * @param obj   pointer to the scrolled object
+ * @param dx    the children were moved by this many pixels horizontally...
+ * @param dy    ...and vertically
+ * @return      true: the object is invalidated; false: the pixels can't be moved,
+ *              the whole object needs to be invalidated
+ */
+bool lv_refr_scroll_copy(lv_obj_t * obj, int32_t dx, int32_t dy);
+
+/**
+ * Invalidate an area of an object whose drawn content moved by moving its already rendered pixels if possible.
+ * Unlike scrolling, the children don't move, so they are invalidated at both places.
+ * The background of the object under `area` must look the same when moved.
+ * @param obj   pointer to an object
+ * @param area  the area to move in absolute coordinates. It should be inside the border and the rounded corners.
+ * @param dx    move the content by this many pixels horizontally...
+ * @param dy    ...and vertically
+ * @return      true: only the newly exposed strips and the overlapping Widgets are invalidated;
+ *              false: the pixels can't be moved, `area` needs to be invalidated
+ */
+bool lv_refr_move_area(lv_obj_t * obj, const lv_area_t * area, int32_t dx, int32_t dy);
+
 /**
  * Get the display which is being refreshed
  * @return the display being refreshed
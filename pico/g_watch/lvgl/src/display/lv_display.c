@@ -554,6 +554,30 @@ bool lv_display_get_antialiasing(lv_display_t * disp)
     return disp->antialiasing;
 }
 
+void lv_display_set_scroll_copy(lv_display_t * disp, bool en)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->scroll_copy_en = en;
+}
+
+bool lv_display_get_scroll_copy(lv_display_t * disp)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return false;
+
+    return disp->scroll_copy_en;
+}
+
+void lv_display_set_scroll_cb(lv_display_t * disp, lv_display_scroll_cb_t scroll_cb)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->scroll_cb = scroll_cb;
+}
+
 LV_ATTRIBUTE_FLUSH_READY void lv_display_flush_ready(lv_display_t * disp)
 {
     disp->flushing = 0;
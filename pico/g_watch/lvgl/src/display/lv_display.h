@@ -81,6 +81,16 @@ typedef enum {
 typedef void (*lv_display_flush_cb_t)(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 typedef void (*lv_display_flush_wait_cb_t)(lv_display_t * disp);
 
+/**
+ * Move an already shown area of the display, e.g. with the scroll command of the panel.
+ * @param disp      pointer to a display
+ * @param area      the area to move (in display coordinates)
+ * @param dx        move the pixels of `area` by this many pixels horizontally...
+ * @param dy        ...and vertically. The parts moved out of `area` are dropped.
+ * @return          true: the pixels were moved; false: the area needs to be redrawn
+ */
+typedef bool (*lv_display_scroll_cb_t)(lv_display_t * disp, const lv_area_t * area, int32_t dx, int32_t dy);
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -336,6 +346,35 @@ void lv_display_set_antialiasing(lv_display_t * disp, bool en);
  */
 bool lv_display_get_antialiasing(lv_display_t * disp);
 
+/**
+ * Enable reusing the already rendered pixels when a Widget is scrolled.
+ * Instead of redrawing the whole visible area of the scrolled Widget its pixels are moved
+ * in the draw buffer (`LV_DISPLAY_RENDER_MODE_DIRECT`) or by the `scroll_cb` and only
+ * the newly exposed strips and the overlapping Widgets are redrawn.
+ * The Widget is redrawn normally if the move can't be done safely, e.g. its background
+ * is not opaque or it's drawn on a layer.
+ * @param disp      pointer to a display
+ * @param en        true/false
+ */
+void lv_display_set_scroll_copy(lv_display_t * disp, bool en);
+
+/**
+ * Get if reusing the rendered pixels on scroll is enabled
+ * @param disp      pointer to a display (NULL to use the default display)
+ * @return          true/false
+ */
+bool lv_display_get_scroll_copy(lv_display_t * disp);
+
+/**
+ * Set a callback to move the already shown pixels on the display (e.g. by the scroll command
+ * of the panel) when a Widget is scrolled. Used with `lv_display_set_scroll_copy()`.
+ * If set it's used in every render mode instead of copying the pixels in the draw buffer.
+ * @param disp          pointer to a display
+ * @param scroll_cb     the callback, or NULL to copy the pixels in the draw buffer
+ *                      (`LV_DISPLAY_RENDER_MODE_DIRECT` only)
+ */
+void lv_display_set_scroll_cb(lv_display_t * disp, lv_display_scroll_cb_t scroll_cb);
+
 //! @cond Doxygen_Suppress
 
 /**
@@ -108,6 +108,13 @@ struct _lv_display_t {
     /** Double buffer sync areas (redrawn during last refresh) */
     lv_ll_t sync_areas;
 
+    /** Move the pixels of a scrolled area instead of redrawing it (see `lv_display_set_scroll_copy`)*/
+    lv_display_scroll_cb_t scroll_cb;
+    lv_area_t scroll_copy_area;     /**< The pixels of this area will be moved before the next refresh*/
+    lv_point_t scroll_copy_ofs;     /**< Move them by this offset (sum of the scrolls since the last refresh)*/
+    uint32_t scroll_copy_en : 1;
+    uint32_t scroll_copy_pending : 1;
+
     lv_draw_buf_t _static_buf1; /**< Used when user pass in a raw buffer as display draw buffer */
     lv_draw_buf_t _static_buf2;
     /*---------------------
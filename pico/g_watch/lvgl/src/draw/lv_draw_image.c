@@ -9,6 +9,7 @@
 #include "lv_draw_image_private.h"
 #include "../misc/lv_area_private.h"
 #include "lv_image_decoder_private.h"
+#include "lv_image_decoder_async_private.h"
 #include "lv_draw_private.h"
 #include "../display/lv_display.h"
 #include "../misc/lv_log.h"
@@ -118,6 +119,15 @@ void lv_draw_image(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv
         return;
     }
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /*Not decoded yet: a placeholder is drawn and the image is decoded in the background*/
+    if(lv_image_decoder_async_draw(layer, new_image_dsc, coords)) {
+        lv_free(new_image_dsc);
+        LV_PROFILER_DRAW_END;
+        return;
+    }
+#endif
+
     lv_draw_task_t * t = lv_draw_add_task(layer, coords);
     t->draw_dsc = new_image_dsc;
     t->type = LV_DRAW_TASK_TYPE_IMAGE;
@@ -148,7 +158,8 @@ lv_image_src_t lv_image_src_get_type(const void * src)
 }
 
 void lv_draw_image_normal_helper(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
-                                 const lv_area_t * coords, lv_draw_image_core_cb draw_core_cb)
+                                 const lv_area_t * coords, const lv_image_decoder_args_t * args,
+                                 lv_draw_image_core_cb draw_core_cb)
 {
     if(draw_core_cb == NULL) {
         LV_LOG_WARN("draw_core_cb is NULL");
@@ -176,7 +187,7 @@ void lv_draw_image_normal_helper(lv_draw_unit_t * draw_unit, const lv_draw_image
     }
 
     lv_image_decoder_dsc_t decoder_dsc;
-    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, NULL);
+    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, args);
     if(res != LV_RESULT_OK) {
         LV_LOG_ERROR("Failed to open image");
         return;
@@ -188,7 +199,8 @@ void lv_draw_image_normal_helper(lv_draw_unit_t * draw_unit, const lv_draw_image
 }
 
 void lv_draw_image_tiled_helper(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
-                                const lv_area_t * coords, lv_draw_image_core_cb draw_core_cb)
+                                const lv_area_t * coords, const lv_image_decoder_args_t * args,
+                                lv_draw_image_core_cb draw_core_cb)
 {
     if(draw_core_cb == NULL) {
         LV_LOG_WARN("draw_core_cb is NULL");
@@ -196,7 +208,7 @@ void lv_draw_image_tiled_helper(lv_draw_unit_t * draw_unit, const lv_draw_image_
     }
 
     lv_image_decoder_dsc_t decoder_dsc;
-    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, NULL);
+    lv_result_t res = lv_image_decoder_open(&decoder_dsc, draw_dsc->src, args);
     if(res != LV_RESULT_OK) {
         LV_LOG_ERROR("Failed to open image");
         return;
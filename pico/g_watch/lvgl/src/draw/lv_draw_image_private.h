@@ -45,10 +45,12 @@ struct _lv_draw_image_sup_t {
  * @param draw_unit     pointer to a draw unit
  * @param draw_dsc      the draw descriptor of the image
  * @param coords        the absolute coordinates of the image
+ * @param args          arguments to open the image decoder with, or NULL to use the defaults
  * @param draw_core_cb  a callback to perform the actual rendering
  */
 void lv_draw_image_normal_helper(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
-                                 const lv_area_t * coords, lv_draw_image_core_cb draw_core_cb);
+                                 const lv_area_t * coords, const lv_image_decoder_args_t * args,
+                                 lv_draw_image_core_cb draw_core_cb);
 
 /**
  * Can be used by draw units for TILED images to handle the decoding and
@@ -56,10 +58,12 @@ void lv_draw_image_normal_helper(lv_draw_unit_t * draw_unit, const lv_draw_image
  * @param draw_unit     pointer to a draw unit
  * @param draw_dsc      the draw descriptor of the image
  * @param coords        the absolute coordinates of the image
+ * @param args          arguments to open the image decoder with, or NULL to use the defaults
  * @param draw_core_cb  a callback to perform the actual rendering
  */
 void lv_draw_image_tiled_helper(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
-                                const lv_area_t * coords, lv_draw_image_core_cb draw_core_cb);
+                                const lv_area_t * coords, const lv_image_decoder_args_t * args,
+                                lv_draw_image_core_cb draw_core_cb);
 
 /**
  * Get the area of a rectangle if its rotated and scaled
@@ -0,0 +1,633 @@
+/**
+ * @file lv_image_decoder_async.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_image_decoder_async_private.h"
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+#include "lv_image_decoder_private.h"
+#include "lv_draw_image_private.h"
+#include "lv_draw_private.h"
+#include "lv_draw_rect.h"
+#include "../core/lv_global.h"
+#include "../core/lv_obj_private.h"
+#include "../core/lv_refr_private.h"
+#include "../display/lv_display_private.h"
+#include "../misc/lv_area_private.h"
+#include "../misc/lv_ll.h"
+#include "../misc/lv_timer.h"
+#include "../misc/cache/lv_cache.h"
+#include "../misc/cache/lv_image_cache.h"
+#include "../osal/lv_os.h"
+#include "../stdlib/lv_mem.h"
+#include "../stdlib/lv_string.h"
+#include "../widgets/image/lv_image.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+#define ctx_p (LV_GLOBAL_DEFAULT()->image_decoder_async)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef enum {
+    REQ_STATE_QUEUED,
+    REQ_STATE_DECODING,
+    REQ_STATE_READY,        /*In the image cache, the entry is held until the area is invalidated*/
+    REQ_STATE_FAILED,       /*Couldn't be decoded or cached, draw it synchronously from now on*/
+} req_state_t;
+
+typedef struct {
+    const void * src;       /*Copy of the file name for file sources*/
+    lv_image_src_t src_type;
+    lv_image_decoder_async_prio_t prio;
+    req_state_t state;
+    lv_image_decoder_dsc_t decoder_dsc;
+    lv_display_t * disp;    /*Display where the placeholder was drawn*/
+    lv_area_t inv_area;     /*Area of the placeholder on `disp`*/
+    uint32_t drawn     : 1;
+    uint32_t inv_full  : 1; /*Drawn on a child layer or on more displays: invalidate the whole screen*/
+} request_t;
+
+typedef struct {
+    const void * src;
+    lv_image_src_t src_type;
+    const void * preview;   /*Only in the preview list*/
+} src_entry_t;
+
+typedef struct _lv_image_decoder_async_t {
+    lv_ll_t req_ll;         /*request_t, protected by `lock`*/
+    lv_ll_t sync_ll;        /*src_entry_t: sources which are always decoded while drawing*/
+    lv_ll_t preview_ll;     /*src_entry_t*/
+    lv_timer_t * timer;
+    lv_mutex_t lock;
+    lv_color_t placeholder_color;
+    lv_opa_t placeholder_opa;
+    bool enabled;
+    bool drawing_preview;
+#if LV_USE_OS
+    lv_thread_t thread;
+    lv_thread_sync_t sync;
+    bool exit;
+#endif
+} lv_image_decoder_async_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static bool is_slow(const void * src, const lv_image_header_t * header);
+static bool is_cached(const void * src, lv_image_src_t src_type);
+static bool src_equal(const void * src1, lv_image_src_t src_type1, const void * src2, lv_image_src_t src_type2);
+static src_entry_t * src_list_find(lv_ll_t * ll, const void * src, lv_image_src_t src_type);
+static src_entry_t * src_list_add(lv_ll_t * ll, const void * src, lv_image_src_t src_type);
+static void src_list_clear(lv_ll_t * ll);
+static request_t * request_find(const void * src, lv_image_src_t src_type);
+static request_t * request_add(const void * src, lv_image_src_t src_type, lv_image_decoder_async_prio_t prio);
+static void request_delete(request_t * req);
+static void request_record_area(request_t * req, lv_layer_t * layer, const lv_area_t * area);
+static void request_invalidate(request_t * req);
+static request_t * request_get_next(void);
+static void request_decode(request_t * req);
+static void worker_wake_up(void);
+static void timer_cb(lv_timer_t * timer);
+static void draw_placeholder(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv_area_t * coords,
+                             const lv_area_t * transformed_area);
+static void prefetch_obj_recursive(lv_obj_t * obj, lv_image_decoder_async_prio_t prio);
+#if LV_USE_OS
+    static void worker_thread_cb(void * user_data);
+#endif
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+void lv_image_decoder_async_init(void)
+{
+    lv_image_decoder_async_t * ctx = lv_malloc_zeroed(sizeof(lv_image_decoder_async_t));
+    LV_ASSERT_MALLOC(ctx);
+    if(ctx == NULL) return;
+
+    lv_ll_init(&ctx->req_ll, sizeof(request_t));
+    lv_ll_init(&ctx->sync_ll, sizeof(src_entry_t));
+    lv_ll_init(&ctx->preview_ll, sizeof(src_entry_t));
+    lv_mutex_init(&ctx->lock);
+    ctx->placeholder_color = lv_color_hex3(0x888);
+    ctx->placeholder_opa = LV_OPA_30;
+    ctx_p = ctx;
+}
+
+void lv_image_decoder_async_deinit(void)
+{
+    lv_image_decoder_async_t * ctx = ctx_p;
+    if(ctx == NULL) return;
+
+    lv_image_decoder_async_set_enabled(false);
+    src_list_clear(&ctx->sync_ll);
+    src_list_clear(&ctx->preview_ll);
+    lv_mutex_delete(&ctx->lock);
+    lv_free(ctx);
+    ctx_p = NULL;
+}
+
+void lv_image_decoder_async_set_enabled(bool en)
+{
+    lv_image_decoder_async_t * ctx = ctx_p;
+    if(ctx == NULL || ctx->enabled == en) return;
+
+    if(en) {
+#if LV_USE_OS
+        ctx->exit = false;
+        lv_thread_sync_init(&ctx->sync);
+        if(lv_thread_init(&ctx->thread, LV_THREAD_PRIO_LOW, worker_thread_cb, LV_IMAGE_DECODER_ASYNC_STACK_SIZE,
+                          ctx) != LV_RESULT_OK) {
+            LV_LOG_WARN("Couldn't create the decoder thread");
+            lv_thread_sync_delete(&ctx->sync);
+            return;
+        }
+#endif
+        ctx->timer = lv_timer_create(timer_cb, LV_DEF_REFR_PERIOD, ctx);
+        ctx->enabled = true;
+        return;
+    }
+
+    ctx->enabled = false;
+#if LV_USE_OS
+    lv_mutex_lock(&ctx->lock);
+    ctx->exit = true;
+    lv_mutex_unlock(&ctx->lock);
+    lv_thread_sync_signal(&ctx->sync);
+    lv_thread_delete(&ctx->thread);
+    lv_thread_sync_delete(&ctx->sync);
+#endif
+    lv_timer_delete(ctx->timer);
+    ctx->timer = NULL;
+
+    /*Nothing is decoding anymore. Redraw the placeholders with the images decoded while drawing.*/
+    request_t * req = lv_ll_get_head(&ctx->req_ll);
+    while(req) {
+        request_t * req_next = lv_ll_get_next(&ctx->req_ll, req);
+        request_invalidate(req);
+        request_delete(req);
+        req = req_next;
+    }
+}
+
+bool lv_image_decoder_async_is_enabled(void)
+{
+    return ctx_p && ctx_p->enabled;
+}
+
+void lv_image_decoder_async_set_placeholder(lv_color_t color, lv_opa_t opa)
+{
+    if(ctx_p == NULL) return;
+    ctx_p->placeholder_color = color;
+    ctx_p->placeholder_opa = opa;
+}
+
+void lv_image_decoder_async_set_preview(const void * src, const void * preview)
+{
+    lv_image_decoder_async_t * ctx = ctx_p;
+    if(ctx == NULL || src == NULL) return;
+
+    lv_image_src_t src_type = lv_image_src_get_type(src);
+    src_entry_t * entry = src_list_find(&ctx->preview_ll, src, src_type);
+    if(preview == NULL) {
+        if(entry) {
+            if(entry->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)entry->src);
+            lv_ll_remove(&ctx->preview_ll, entry);
+            lv_free(entry);
+        }
+        return;
+    }
+
+    if(entry == NULL) entry = src_list_add(&ctx->preview_ll, src, src_type);
+    if(entry) entry->preview = preview;
+}
+
+lv_result_t lv_image_decoder_async_prefetch(const void * src, lv_image_decoder_async_prio_t prio)
+{
+    lv_image_decoder_async_t * ctx = ctx_p;
+    if(ctx == NULL || !ctx->enabled || !lv_image_cache_is_enabled()) return LV_RESULT_INVALID;
+
+    lv_image_header_t header;
+    if(lv_image_decoder_get_info(src, &header) != LV_RESULT_OK) return LV_RESULT_INVALID;
+    if(!is_slow(src, &header)) return LV_RESULT_OK;
+
+    lv_image_src_t src_type = lv_image_src_get_type(src);
+    lv_mutex_lock(&ctx->lock);
+    if(src_list_find(&ctx->sync_ll, src, src_type)) {
+        lv_mutex_unlock(&ctx->lock);
+        return LV_RESULT_OK;
+    }
+
+    request_t * req = request_find(src, src_type);
+    if(req) {
+        if(req->prio < prio) req->prio = prio;
+        lv_mutex_unlock(&ctx->lock);
+        return LV_RESULT_OK;
+    }
+    lv_mutex_unlock(&ctx->lock);
+
+    if(is_cached(src, src_type)) return LV_RESULT_OK;
+
+    lv_mutex_lock(&ctx->lock);
+    req = request_add(src, src_type, prio);
+    lv_mutex_unlock(&ctx->lock);
+    if(req == NULL) return LV_RESULT_INVALID;
+
+    worker_wake_up();
+    return LV_RESULT_OK;
+}
+
+void lv_image_decoder_async_prefetch_obj(lv_obj_t * obj, lv_image_decoder_async_prio_t prio)
+{
+    LV_ASSERT_NULL(obj);
+    if(!lv_image_decoder_async_is_enabled()) return;
+
+    prefetch_obj_recursive(obj, prio);
+}
+
+uint32_t lv_image_decoder_async_get_pending_count(void)
+{
+    lv_image_decoder_async_t * ctx = ctx_p;
+    if(ctx == NULL) return 0;
+
+    uint32_t cnt = 0;
+    lv_mutex_lock(&ctx->lock);
+    request_t * req;
+    LV_LL_READ(&ctx->req_ll, req) {
+        if(req->state == REQ_STATE_QUEUED || req->state == REQ_STATE_DECODING) cnt++;
+    }
+    lv_mutex_unlock(&ctx->lock);
+    return cnt;
+}
+
+bool lv_image_decoder_async_draw(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv_area_t * coords)
+{
+    lv_image_decoder_async_t * ctx = ctx_p;
+    if(ctx == NULL || !ctx->enabled || ctx->drawing_preview) return false;
+    if(!is_slow(dsc->src, &dsc->header) || !lv_image_cache_is_enabled()) return false;
+
+    /*Only the layers of a display are redrawn when the image is ready, decode e.g. canvas images while drawing*/
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+    lv_layer_t * root = layer;
+    while(root->parent) root = root->parent;
+    if(disp == NULL || root != disp->layer_head) return false;
+
+    const void * src = dsc->src;
+    lv_image_src_t src_type = lv_image_src_get_type(src);
+
+    lv_mutex_lock(&ctx->lock);
+    if(src_list_find(&ctx->sync_ll, src, src_type)) {
+        lv_mutex_unlock(&ctx->lock);
+        return false;
+    }
+
+    request_t * req = request_find(src, src_type);
+    bool ready = req && req->state == REQ_STATE_READY;
+    lv_mutex_unlock(&ctx->lock);
+
+    /*The decoded image is held in the cache until the area is redrawn*/
+    if(ready) return false;
+    if(req == NULL && is_cached(src, src_type)) return false;
+
+    lv_area_t transformed_area;
+    lv_image_buf_get_transformed_area(&transformed_area, lv_area_get_width(coords), lv_area_get_height(coords),
+                                      dsc->rotation, dsc->scale_x, dsc->scale_y, &dsc->pivot);
+    lv_area_move(&transformed_area, coords->x1, coords->y1);
+
+    lv_mutex_lock(&ctx->lock);
+    if(req == NULL) {
+        req = request_add(src, src_type, LV_IMAGE_DECODER_ASYNC_PRIO_VISIBLE);
+        if(req == NULL) {
+            lv_mutex_unlock(&ctx->lock);
+            return false;
+        }
+        worker_wake_up();
+    }
+    else if(req->prio < LV_IMAGE_DECODER_ASYNC_PRIO_VISIBLE) {
+        req->prio = LV_IMAGE_DECODER_ASYNC_PRIO_VISIBLE;
+    }
+    request_record_area(req, layer, &transformed_area);
+    lv_mutex_unlock(&ctx->lock);
+
+    draw_placeholder(layer, dsc, coords, &transformed_area);
+    return true;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+/**
+ * Images which need real decoding: files and compressed formats such as PNG and JPG.
+ * C arrays in the native formats are drawn directly from their data.
+ */
+static bool is_slow(const void * src, const lv_image_header_t * header)
+{
+    lv_image_src_t src_type = lv_image_src_get_type(src);
+    if(src_type == LV_IMAGE_SRC_FILE) return true;
+    if(src_type != LV_IMAGE_SRC_VARIABLE) return false;
+
+    return header->cf == LV_COLOR_FORMAT_RAW || header->cf == LV_COLOR_FORMAT_RAW_ALPHA;
+}
+
+static bool is_cached(const void * src, lv_image_src_t src_type)
+{
+    lv_image_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.src = src;
+    search_key.src_type = src_type;
+
+    lv_cache_t * cache = LV_GLOBAL_DEFAULT()->img_cache;
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    if(entry == NULL) return false;
+
+    lv_cache_release(cache, entry, NULL);
+    return true;
+}
+
+static bool src_equal(const void * src1, lv_image_src_t src_type1, const void * src2, lv_image_src_t src_type2)
+{
+    if(src_type1 != src_type2) return false;
+    if(src_type1 == LV_IMAGE_SRC_FILE) return lv_strcmp(src1, src2) == 0;
+    return src1 == src2;
+}
+
+static src_entry_t * src_list_find(lv_ll_t * ll, const void * src, lv_image_src_t src_type)
+{
+    src_entry_t * entry;
+    LV_LL_READ(ll, entry) {
+        if(src_equal(entry->src, entry->src_type, src, src_type)) return entry;
+    }
+    return NULL;
+}
+
+static src_entry_t * src_list_add(lv_ll_t * ll, const void * src, lv_image_src_t src_type)
+{
+    src_entry_t * entry = lv_ll_ins_tail(ll);
+    LV_ASSERT_MALLOC(entry);
+    if(entry == NULL) return NULL;
+
+    lv_memzero(entry, sizeof(src_entry_t));
+    entry->src_type = src_type;
+    entry->src = src_type == LV_IMAGE_SRC_FILE ? lv_strdup(src) : src;
+    if(entry->src == NULL) {
+        lv_ll_remove(ll, entry);
+        lv_free(entry);
+        return NULL;
+    }
+    return entry;
+}
+
+static void src_list_clear(lv_ll_t * ll)
+{
+    src_entry_t * entry;
+    LV_LL_READ(ll, entry) {
+        if(entry->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)entry->src);
+    }
+    lv_ll_clear(ll);
+}
+
+static request_t * request_find(const void * src, lv_image_src_t src_type)
+{
+    request_t * req;
+    LV_LL_READ(&ctx_p->req_ll, req) {
+        if(src_equal(req->src, req->src_type, src, src_type)) return req;
+    }
+    return NULL;
+}
+
+static request_t * request_add(const void * src, lv_image_src_t src_type, lv_image_decoder_async_prio_t prio)
+{
+    request_t * req = lv_ll_ins_tail(&ctx_p->req_ll);
+    LV_ASSERT_MALLOC(req);
+    if(req == NULL) return NULL;
+
+    lv_memzero(req, sizeof(request_t));
+    req->src_type = src_type;
+    req->src = src_type == LV_IMAGE_SRC_FILE ? lv_strdup(src) : src;
+    req->prio = prio;
+    req->state = REQ_STATE_QUEUED;
+    if(req->src == NULL) {
+        lv_ll_remove(&ctx_p->req_ll, req);
+        lv_free(req);
+        return NULL;
+    }
+    return req;
+}
+
+/**
+ * Free a request which is not decoding.
+ */
+static void request_delete(request_t * req)
+{
+    if(req->state == REQ_STATE_READY) lv_image_decoder_close(&req->decoder_dsc);
+    if(req->src_type == LV_IMAGE_SRC_FILE) lv_free((void *)req->src);
+    lv_ll_remove(&ctx_p->req_ll, req);
+    lv_free(req);
+}
+
+static void request_record_area(request_t * req, lv_layer_t * layer, const lv_area_t * area)
+{
+    lv_display_t * disp = lv_refr_get_disp_refreshing();
+
+    /*Areas on child layers (opacity, transformation) don't map to the screen directly*/
+    if(layer->parent || (req->drawn && req->disp != disp)) req->inv_full = 1;
+
+    if(!req->drawn) req->inv_area = *area;
+    else lv_area_join(&req->inv_area, &req->inv_area, area);
+
+    req->disp = disp;
+    req->drawn = 1;
+}
+
+static void request_invalidate(request_t * req)
+{
+    if(!req->drawn) return;
+
+    lv_display_t * disp = lv_display_get_next(NULL);
+    while(disp) {
+        if(req->inv_full) {
+            lv_area_t scr_area = {0, 0, lv_display_get_horizontal_resolution(disp) - 1, lv_display_get_vertical_resolution(disp) - 1};
+            lv_inv_area(disp, &scr_area);
+        }
+        else if(disp == req->disp) {
+            lv_inv_area(disp, &req->inv_area);
+        }
+        disp = lv_display_get_next(disp);
+    }
+}
+
+/**
+ * Get the queued request with the highest priority and mark it as decoding. `lock` needs to be held.
+ */
+static request_t * request_get_next(void)
+{
+    request_t * next = NULL;
+    request_t * req;
+    LV_LL_READ(&ctx_p->req_ll, req) {
+        if(req->state == REQ_STATE_QUEUED && (next == NULL || req->prio > next->prio)) next = req;
+    }
+
+    if(next) next->state = REQ_STATE_DECODING;
+    return next;
+}
+
+/**
+ * Decode a request into the image cache. Called without holding `lock`,
+ * the request is not freed while it's decoding.
+ */
+static void request_decode(request_t * req)
+{
+    lv_image_decoder_dsc_t decoder_dsc;
+    lv_result_t res = lv_image_decoder_open(&decoder_dsc, req->src, NULL);
+
+    /*Decoders which don't add the image to the cache decode it while drawing anyway*/
+    bool cached = res == LV_RESULT_OK && decoder_dsc.cache_entry != NULL;
+    if(res == LV_RESULT_OK && !cached) lv_image_decoder_close(&decoder_dsc);
+
+    lv_mutex_lock(&ctx_p->lock);
+    if(cached) req->decoder_dsc = decoder_dsc;
+    req->state = cached ? REQ_STATE_READY : REQ_STATE_FAILED;
+    lv_mutex_unlock(&ctx_p->lock);
+}
+
+static void worker_wake_up(void)
+{
+#if LV_USE_OS
+    lv_thread_sync_signal(&ctx_p->sync);
+#endif
+}
+
+/**
+ * Finish the requests in the UI thread: invalidate the areas of the placeholders
+ * and release the decoded images, they stay in the cache.
+ * Without an OS, also decode the next request here, outside of rendering.
+ */
+static void timer_cb(lv_timer_t * timer)
+{
+    lv_image_decoder_async_t * ctx = lv_timer_get_user_data(timer);
+
+#if LV_USE_OS == LV_OS_NONE
+    lv_mutex_lock(&ctx->lock);
+    request_t * next = request_get_next();
+    lv_mutex_unlock(&ctx->lock);
+    if(next) request_decode(next);
+#endif
+
+    lv_mutex_lock(&ctx->lock);
+    request_t * req = lv_ll_get_head(&ctx->req_ll);
+    while(req) {
+        request_t * req_next = lv_ll_get_next(&ctx->req_ll, req);
+        if(req->state == REQ_STATE_FAILED) {
+            /*Don't request it again and again, it will be decoded while drawing*/
+            src_list_add(&ctx->sync_ll, req->src, req->src_type);
+        }
+        if(req->state == REQ_STATE_READY || req->state == REQ_STATE_FAILED) {
+            request_invalidate(req);
+            request_delete(req);
+        }
+        req = req_next;
+    }
+    lv_mutex_unlock(&ctx->lock);
+}
+
+static void draw_placeholder(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv_area_t * coords,
+                             const lv_area_t * transformed_area)
+{
+    lv_image_decoder_async_t * ctx = ctx_p;
+    /*The preview is scaled up around its top left corner, so it's used only for not transformed images*/
+    bool transformed = dsc->rotation != 0 || dsc->scale_x != LV_SCALE_NONE || dsc->scale_y != LV_SCALE_NONE;
+    src_entry_t * entry = NULL;
+    if(!dsc->tile && !transformed) entry = src_list_find(&ctx->preview_ll, dsc->src, lv_image_src_get_type(dsc->src));
+
+    lv_image_header_t header;
+    if(entry && lv_image_decoder_get_info(entry->preview, &header) == LV_RESULT_OK && header.w && header.h) {
+        lv_draw_image_dsc_t preview_dsc = *dsc;
+        preview_dsc.src = entry->preview;
+        preview_dsc.scale_x = LV_SCALE_NONE * lv_area_get_width(coords) / header.w;
+        preview_dsc.scale_y = LV_SCALE_NONE * lv_area_get_height(coords) / header.h;
+        preview_dsc.pivot.x = 0;
+        preview_dsc.pivot.y = 0;
+        preview_dsc.image_area.x2 = LV_COORD_MIN;
+
+        lv_area_t preview_coords;
+        lv_area_set(&preview_coords, coords->x1, coords->y1, coords->x1 + header.w - 1, coords->y1 + header.h - 1);
+        ctx->drawing_preview = true;
+        lv_draw_image(layer, &preview_dsc, &preview_coords);
+        ctx->drawing_preview = false;
+        return;
+    }
+
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    rect_dsc.bg_color = ctx->placeholder_color;
+    rect_dsc.bg_opa = LV_OPA_MIX2(ctx->placeholder_opa, dsc->opa);
+    rect_dsc.radius = dsc->clip_radius;
+    if(rect_dsc.bg_opa <= LV_OPA_MIN) return;
+
+    lv_draw_rect(layer, &rect_dsc, transformed_area);
+}
+
+static void prefetch_obj_recursive(lv_obj_t * obj, lv_image_decoder_async_prio_t prio)
+{
+#if LV_USE_IMAGE
+    if(lv_obj_check_type(obj, &lv_image_class)) {
+        const void * src = lv_image_get_src(obj);
+        if(src) lv_image_decoder_async_prefetch(src, prio);
+    }
+#endif
+
+    const void * bg_src = lv_obj_get_style_bg_image_src(obj, LV_PART_MAIN);
+    if(bg_src) lv_image_decoder_async_prefetch(bg_src, prio);
+
+    uint32_t i;
+    uint32_t child_cnt = lv_obj_get_child_count(obj);
+    for(i = 0; i < child_cnt; i++) {
+        prefetch_obj_recursive(lv_obj_get_child(obj, i), prio);
+    }
+}
+
+#if LV_USE_OS
+static void worker_thread_cb(void * user_data)
+{
+    lv_image_decoder_async_t * ctx = user_data;
+
+    while(1) {
+        lv_thread_sync_wait(&ctx->sync);
+
+        while(1) {
+            lv_mutex_lock(&ctx->lock);
+            if(ctx->exit) {
+                lv_mutex_unlock(&ctx->lock);
+                return;
+            }
+            request_t * req = request_get_next();
+            lv_mutex_unlock(&ctx->lock);
+
+            if(req == NULL) break;
+            request_decode(req);
+        }
+    }
+}
+#endif
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
@@ -0,0 +1,112 @@
+/**
+ * @file lv_image_decoder_async.h
+ *
+ */
+
+#ifndef LV_IMAGE_DECODER_ASYNC_H
+#define LV_IMAGE_DECODER_ASYNC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../lv_conf_internal.h"
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+#include "../misc/lv_types.h"
+#include "../misc/lv_color.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Priority of a background decode request. Requests with higher priority are decoded first,
+ * requests with the same priority in the order they were added.
+ */
+typedef enum {
+    LV_IMAGE_DECODER_ASYNC_PRIO_LOW,
+    LV_IMAGE_DECODER_ASYNC_PRIO_NORMAL,
+    LV_IMAGE_DECODER_ASYNC_PRIO_HIGH,
+    LV_IMAGE_DECODER_ASYNC_PRIO_VISIBLE,   /**< Used for images which are already drawn with a placeholder*/
+} lv_image_decoder_async_prio_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Enable or disable background decoding. When enabled, images which are slow to open
+ * (files and `LV_COLOR_FORMAT_RAW/RAW_ALPHA` images) and are not in the image cache yet
+ * are drawn as a placeholder and decoded into the image cache in the background.
+ * When the image is ready, the area where it was drawn is invalidated.
+ * The image cache should be large enough to hold the images of a screen.
+ * @param en        true: enable; false: disable and drop the pending requests
+ */
+void lv_image_decoder_async_set_enabled(bool en);
+
+/**
+ * Tell whether background decoding is enabled.
+ * @return          true: enabled
+ */
+bool lv_image_decoder_async_is_enabled(void);
+
+/**
+ * Set the color of the placeholder drawn instead of the images being decoded.
+ * @param color     color of the placeholder
+ * @param opa       opacity of the placeholder, `LV_OPA_TRANSP` to draw nothing
+ */
+void lv_image_decoder_async_set_placeholder(lv_color_t color, lv_opa_t opa);
+
+/**
+ * Set a small image to draw, scaled to the size of `src`, while `src` is being decoded.
+ * The preview should be fast to draw, e.g. a small RGB565 C array.
+ * @param src       source of the image (file name or image descriptor)
+ * @param preview   preview image or NULL to remove the preview
+ */
+void lv_image_decoder_async_set_preview(const void * src, const void * preview);
+
+/**
+ * Decode an image into the image cache in the background before it's drawn,
+ * e.g. for the screen which is going to be loaded.
+ * If the image is already requested its priority is raised to `prio`.
+ * @param src       source of the image (file name or image descriptor)
+ * @param prio      priority of the request
+ * @return          LV_RESULT_OK: the image is requested or doesn't need decoding;
+ *                  LV_RESULT_INVALID: background decoding is disabled or `src` can't be opened
+ */
+lv_result_t lv_image_decoder_async_prefetch(const void * src, lv_image_decoder_async_prio_t prio);
+
+/**
+ * Prefetch the images of a widget and its children: the source of image widgets
+ * and the background images of the main part.
+ * @param obj       pointer to a widget, e.g. a screen which is not loaded yet
+ * @param prio      priority of the requests
+ */
+void lv_image_decoder_async_prefetch_obj(lv_obj_t * obj, lv_image_decoder_async_prio_t prio);
+
+/**
+ * Get the number of images which are waiting for or being decoded.
+ * @return          number of pending requests
+ */
+uint32_t lv_image_decoder_async_get_pending_count(void);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMAGE_DECODER_ASYNC_H*/
@@ -0,0 +1,66 @@
+/**
+ * @file lv_image_decoder_async_private.h
+ *
+ */
+
+#ifndef LV_IMAGE_DECODER_ASYNC_PRIVATE_H
+#define LV_IMAGE_DECODER_ASYNC_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "lv_image_decoder_async.h"
+
+#if LV_USE_IMAGE_DECODER_ASYNC
+
+#include "lv_draw_image.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Initialize the background image decoder. Background decoding is disabled by default.
+ */
+void lv_image_decoder_async_init(void);
+
+/**
+ * Stop the decoder thread and free the pending requests.
+ */
+void lv_image_decoder_async_deinit(void);
+
+/**
+ * Called by `lv_draw_image()` before adding the draw task. If the image is slow to open
+ * and not in the image cache, request it and draw a placeholder instead.
+ * @param layer     the layer to draw to
+ * @param dsc       the image draw descriptor with the `header` already filled
+ * @param coords    the coordinates of the image
+ * @return          true: a placeholder was drawn, don't draw the image now;
+ *                  false: draw the image as usual
+ */
+bool lv_image_decoder_async_draw(lv_layer_t * layer, const lv_draw_image_dsc_t * dsc, const lv_area_t * coords);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_IMAGE_DECODER_ASYNC*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_IMAGE_DECODER_ASYNC_PRIVATE_H*/
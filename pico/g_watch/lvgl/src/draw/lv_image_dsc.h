@@ -39,6 +39,9 @@ typedef enum _lvimage_flags_t {
      * The image data is compressed, so decoder needs to decode image firstly.
      * If this flag is set, the whole image will be decompressed upon decode, and
      * `get_area_cb` won't be necessary.
+     * If the compressed data is split to independently compressed row bands
+     * (non-zero band height in the compression header), only the bands
+     * covering the drawn area are decompressed via `get_area_cb`.
      */
     LV_IMAGE_FLAGS_COMPRESSED       = 0x0008,
 
@@ -43,10 +43,10 @@ void lv_draw_dave2d_image(lv_draw_dave2d_unit_t * draw_unit, const lv_draw_image
                           const lv_area_t * coords)
 {
     if(!draw_dsc->tile) {
-        lv_draw_image_normal_helper((lv_draw_unit_t *)draw_unit, draw_dsc, coords, img_draw_core);
+        lv_draw_image_normal_helper((lv_draw_unit_t *)draw_unit, draw_dsc, coords, NULL, img_draw_core);
     }
     else {
-        lv_draw_image_tiled_helper((lv_draw_unit_t *)draw_unit, draw_dsc, coords, img_draw_core);
+        lv_draw_image_tiled_helper((lv_draw_unit_t *)draw_unit, draw_dsc, coords, NULL, img_draw_core);
     }
 }
 
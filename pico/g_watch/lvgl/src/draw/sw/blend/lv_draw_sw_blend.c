@@ -90,8 +90,16 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
                                  (blend_area.x1 - blend_dsc->mask_area->x1);
         }
 
+#if LV_DRAW_SW_SUPPORT_RGB565 && LV_DRAW_SW_BLEND_SPECIALIZE_RGB565
+        if(layer->color_format == LV_COLOR_FORMAT_RGB565) {
+            lv_draw_sw_blend_color_to_rgb565(&fill_dsc);
+            LV_PROFILER_DRAW_END;
+            return;
+        }
+#endif
+
         switch(layer->color_format) {
-#if LV_DRAW_SW_SUPPORT_RGB565
+#if LV_DRAW_SW_SUPPORT_RGB565 && !LV_DRAW_SW_BLEND_SPECIALIZE_RGB565
             case LV_COLOR_FORMAT_RGB565:
                 lv_draw_sw_blend_color_to_rgb565(&fill_dsc);
                 break;
@@ -151,11 +159,16 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
         image_dsc.src_stride = blend_dsc->src_stride;
         image_dsc.src_color_format = blend_dsc->src_color_format;
 
+        image_dsc.src_palette = blend_dsc->src_palette;
+
         const uint8_t * src_buf = blend_dsc->src_buf;
         uint32_t src_px_size = lv_color_format_get_bpp(blend_dsc->src_color_format);
+        uint32_t src_bit_ofs = (blend_area.x1 - blend_dsc->src_area->x1) * src_px_size;
         src_buf += image_dsc.src_stride * (blend_area.y1 - blend_dsc->src_area->y1);
-        src_buf += ((blend_area.x1 - blend_dsc->src_area->x1) * src_px_size) >> 3;
+        src_buf += src_bit_ofs >> 3;
         image_dsc.src_buf = src_buf;
+        /*Sub-byte sources can start in the middle of a byte*/
+        image_dsc.src_px_ofs = src_px_size < 8 ? (src_bit_ofs & 0x7) / src_px_size : 0;
         image_dsc.mask_stride = 0;
 
         if(blend_dsc->mask_buf == NULL) image_dsc.mask_buf = NULL;
@@ -179,8 +192,16 @@ void lv_draw_sw_blend(lv_draw_unit_t * draw_unit, const lv_draw_sw_blend_dsc_t *
         image_dsc.dest_buf = lv_draw_layer_go_to_xy(layer, blend_area.x1 - layer->buf_area.x1,
                                                     blend_area.y1 - layer->buf_area.y1);
 
+#if LV_DRAW_SW_SUPPORT_RGB565 && LV_DRAW_SW_BLEND_SPECIALIZE_RGB565
+        if(layer->color_format == LV_COLOR_FORMAT_RGB565 || layer->color_format == LV_COLOR_FORMAT_RGB565A8) {
+            lv_draw_sw_blend_image_to_rgb565(&image_dsc);
+            LV_PROFILER_DRAW_END;
+            return;
+        }
+#endif
+
         switch(layer->color_format) {
-#if LV_DRAW_SW_SUPPORT_RGB565
+#if LV_DRAW_SW_SUPPORT_RGB565 && !LV_DRAW_SW_BLEND_SPECIALIZE_RGB565
             case LV_COLOR_FORMAT_RGB565:
             case LV_COLOR_FORMAT_RGB565A8:
                 lv_draw_sw_blend_image_to_rgb565(&image_dsc);
@@ -37,6 +37,7 @@ struct _lv_draw_sw_blend_dsc_t {
     uint32_t src_stride;
     lv_color_format_t src_color_format;
     const lv_area_t * src_area;
+    const lv_color32_t * src_palette; /**< Palette of an indexed (I1..I8) `src_buf`, NULL otherwise*/
     lv_opa_t opa;                   /**< The overall opacity*/
     lv_color_t color;               /**< Fill color*/
     const lv_opa_t * mask_buf;      /**< NULL if ignored, or an alpha mask to apply on `blend_area`*/
@@ -68,6 +69,8 @@ struct _lv_draw_sw_blend_image_dsc_t {
     const void * src_buf;
     int32_t src_stride;
     lv_color_format_t src_color_format;
+    const lv_color32_t * src_palette;   /**< Palette of an indexed source, NULL otherwise*/
+    uint8_t src_px_ofs;                 /**< Index of the first pixel in the first byte of I1/I2/I4 sources*/
     lv_opa_t opa;
     lv_blend_mode_t blend_mode;
     lv_area_t relative_area;    /**< The blend area relative to the layer's buffer area. */
@@ -9,6 +9,8 @@
 #include "lv_draw_sw_blend_to_i1.h"
 #if LV_USE_DRAW_SW
 
+#if LV_DRAW_SW_SUPPORT_I1
+
 #include "lv_draw_sw_blend_private.h"
 #include "../../../misc/lv_math.h"
 #include "../../../display/lv_display.h"
@@ -1114,4 +1116,6 @@ static inline uint8_t LV_ATTRIBUTE_FAST_MEM get_bit(const uint8_t * buf, int32_t
     return (buf[bit_idx / 8] >> (7 - (bit_idx % 8))) & 1;
 }
 
-#endif
+#endif /*LV_DRAW_SW_SUPPORT_I1*/
+
+#endif /*LV_USE_DRAW_SW*/
@@ -54,6 +54,10 @@
 
 static void /* LV_ATTRIBUTE_FAST_MEM */ rgb565_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
 
+static void /* LV_ATTRIBUTE_FAST_MEM */ indexed_image_blend(lv_draw_sw_blend_image_dsc_t * dsc);
+
+static inline uint8_t /* LV_ATTRIBUTE_FAST_MEM */ get_index(const uint8_t * buf, int32_t px_idx, uint32_t bpp);
+
 #if LV_DRAW_SW_SUPPORT_RGB888 || LV_DRAW_SW_SUPPORT_XRGB8888
 static void /* LV_ATTRIBUTE_FAST_MEM */ rgb888_image_blend(lv_draw_sw_blend_image_dsc_t * dsc,
                                                            const uint8_t src_px_size);
@@ -175,6 +179,10 @@ static inline void * /* LV_ATTRIBUTE_FAST_MEM */ drawbuf_next_row(const void * b
     #define LV_DRAW_SW_ARGB8888_BLEND_NORMAL_TO_RGB565_MIX_MASK_OPA(...)    LV_RESULT_INVALID
 #endif
 
+#ifndef LV_DRAW_SW_INDEXED_BLEND_NORMAL_TO_RGB565
+    #define LV_DRAW_SW_INDEXED_BLEND_NORMAL_TO_RGB565(...)                  LV_RESULT_INVALID
+#endif
+
 #ifndef LV_DRAW_SW_I1_BLEND_NORMAL_TO_RGB565
     #define LV_DRAW_SW_I1_BLEND_NORMAL_TO_RGB565(...)  LV_RESULT_INVALID
 #endif
@@ -361,6 +369,12 @@ void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_color_to_rgb565(lv_draw_sw_blend_fil
 
 void LV_ATTRIBUTE_FAST_MEM lv_draw_sw_blend_image_to_rgb565(lv_draw_sw_blend_image_dsc_t * dsc)
 {
+    /*Indexed images are blended through their palette without expanding them first*/
+    if(dsc->src_palette && LV_COLOR_FORMAT_IS_INDEXED(dsc->src_color_format)) {
+        indexed_image_blend(dsc);
+        return;
+    }
+
     switch(dsc->src_color_format) {
         case LV_COLOR_FORMAT_RGB565:
             rgb565_image_blend(dsc);
@@ -522,6 +536,118 @@ static void LV_ATTRIBUTE_FAST_MEM i1_image_blend(lv_draw_sw_blend_image_dsc_t *
 }
 #endif
 
+static void LV_ATTRIBUTE_FAST_MEM indexed_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    int32_t dest_stride = dsc->dest_stride;
+    const uint8_t * src_buf_u8 = dsc->src_buf;
+    int32_t src_stride = dsc->src_stride;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+    int32_t mask_stride = dsc->mask_stride;
+    const lv_color32_t * palette = dsc->src_palette;
+    uint32_t bpp = lv_color_format_get_bpp(dsc->src_color_format);
+    uint32_t palette_size = LV_COLOR_INDEXED_PALETTE_SIZE(dsc->src_color_format);
+
+    /*Convert the palette to RGB565 once, so opaque pixels are a single lookup*/
+    uint16_t palette_u16[256];
+    bool opaque = true;
+    uint32_t i;
+    for(i = 0; i < palette_size; i++) {
+        palette_u16[i] = ((palette[i].red & 0xF8) << 8) + ((palette[i].green & 0xFC) << 3) + ((palette[i].blue & 0xF8) >> 3);
+        if(palette[i].alpha != LV_OPA_COVER) opaque = false;
+    }
+
+    int32_t dest_x;
+    int32_t src_x;
+    int32_t y;
+
+    if(dsc->blend_mode == LV_BLEND_MODE_NORMAL) {
+        if(mask_buf == NULL && opa >= LV_OPA_MAX && opaque) {
+            if(LV_RESULT_INVALID == LV_DRAW_SW_INDEXED_BLEND_NORMAL_TO_RGB565(dsc, palette_u16)) {
+                uint8_t index_mask = (1 << bpp) - 1;
+                for(y = 0; y < h; y++) {
+                    /*Walk the bits instead of computing the position of every index*/
+                    const uint8_t * src = src_buf_u8;
+                    int32_t shift = 8 - bpp - dsc->src_px_ofs * bpp;
+                    for(dest_x = 0; dest_x < w; dest_x++) {
+                        dest_buf_u16[dest_x] = palette_u16[(*src >> shift) & index_mask];
+                        shift -= bpp;
+                        if(shift < 0) {
+                            shift = 8 - bpp;
+                            src++;
+                        }
+                    }
+                    dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                    src_buf_u8 += src_stride;
+                }
+            }
+        }
+        else {
+            /*Same mixing as ARGB8888 sources, so the result doesn't depend on how the image was decoded*/
+            for(y = 0; y < h; y++) {
+                for(dest_x = 0, src_x = dsc->src_px_ofs; dest_x < w; dest_x++, src_x++) {
+                    const lv_color32_t * c = &palette[get_index(src_buf_u8, src_x, bpp)];
+                    lv_opa_t mix;
+                    if(mask_buf == NULL) mix = opa >= LV_OPA_MAX ? c->alpha : LV_OPA_MIX2(c->alpha, opa);
+                    else mix = opa >= LV_OPA_MAX ? LV_OPA_MIX2(c->alpha, mask_buf[dest_x]) : LV_OPA_MIX3(c->alpha, mask_buf[dest_x], opa);
+                    dest_buf_u16[dest_x] = lv_color_24_16_mix((const uint8_t *)c, dest_buf_u16[dest_x], mix);
+                }
+                dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+                src_buf_u8 += src_stride;
+                if(mask_buf) mask_buf += mask_stride;
+            }
+        }
+    }
+    else {
+        uint16_t res = 0;
+        for(y = 0; y < h; y++) {
+            lv_color16_t * dest_buf_c16 = (lv_color16_t *) dest_buf_u16;
+            for(dest_x = 0, src_x = dsc->src_px_ofs; dest_x < w; dest_x++, src_x++) {
+                const lv_color32_t * c = &palette[get_index(src_buf_u8, src_x, bpp)];
+                switch(dsc->blend_mode) {
+                    case LV_BLEND_MODE_ADDITIVE:
+                        res = (LV_MIN(dest_buf_c16[dest_x].red + (c->red >> 3), 31)) << 11;
+                        res += (LV_MIN(dest_buf_c16[dest_x].green + (c->green >> 2), 63)) << 5;
+                        res += LV_MIN(dest_buf_c16[dest_x].blue + (c->blue >> 3), 31);
+                        break;
+                    case LV_BLEND_MODE_SUBTRACTIVE:
+                        res = (LV_MAX(dest_buf_c16[dest_x].red - (c->red >> 3), 0)) << 11;
+                        res += (LV_MAX(dest_buf_c16[dest_x].green - (c->green >> 2), 0)) << 5;
+                        res += LV_MAX(dest_buf_c16[dest_x].blue - (c->blue >> 3), 0);
+                        break;
+                    case LV_BLEND_MODE_MULTIPLY:
+                        res = ((dest_buf_c16[dest_x].red * (c->red >> 3)) >> 5) << 11;
+                        res += ((dest_buf_c16[dest_x].green * (c->green >> 2)) >> 6) << 5;
+                        res += (dest_buf_c16[dest_x].blue * (c->blue >> 3)) >> 5;
+                        break;
+                    default:
+                        LV_LOG_WARN("Not supported blend mode: %d", dsc->blend_mode);
+                        return;
+                }
+
+                if(mask_buf == NULL && opa >= LV_OPA_MAX) {
+                    dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], c->alpha);
+                }
+                else if(mask_buf == NULL && opa < LV_OPA_MAX) {
+                    dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX2(opa, c->alpha));
+                }
+                else {
+                    if(opa >= LV_OPA_MAX) dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], mask_buf[dest_x]);
+                    else dest_buf_u16[dest_x] = lv_color_16_16_mix(res, dest_buf_u16[dest_x], LV_OPA_MIX3(mask_buf[dest_x], opa,
+                                                                                                              c->alpha));
+                }
+            }
+
+            dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dest_stride);
+            src_buf_u8 += src_stride;
+            if(mask_buf) mask_buf += mask_stride;
+        }
+    }
+}
+
 #if LV_DRAW_SW_SUPPORT_AL88
 static void LV_ATTRIBUTE_FAST_MEM al88_image_blend(lv_draw_sw_blend_image_dsc_t * dsc)
 {
@@ -1140,6 +1266,15 @@ static inline uint8_t LV_ATTRIBUTE_FAST_MEM get_bit(const uint8_t * buf, int32_t
 
 #endif
 
+static inline uint8_t LV_ATTRIBUTE_FAST_MEM get_index(const uint8_t * buf, int32_t px_idx, uint32_t bpp)
+{
+    if(bpp == 8) return buf[px_idx];
+
+    /*The first pixel is in the most significant bits*/
+    uint32_t bit_idx = px_idx * bpp;
+    return (buf[bit_idx >> 3] >> (8 - bpp - (bit_idx & 0x7))) & ((1 << bpp) - 1);
+}
+
 static inline void * LV_ATTRIBUTE_FAST_MEM drawbuf_next_row(const void * buf, uint32_t stride)
 {
     return (void *)((uint8_t *)buf + stride);
@@ -60,6 +60,25 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit);
  **********************/
 #define _draw_info LV_GLOBAL_DEFAULT()->draw_info
 
+#if LV_USE_PROFILER && LV_PROFILER_DRAW
+/*Profiler tag of each draw task type so that the time spent per type can be traced separately*/
+static const char * const task_type_tags[] = {
+    [LV_DRAW_TASK_TYPE_NONE] = "draw_task_none",
+    [LV_DRAW_TASK_TYPE_FILL] = "draw_task_fill",
+    [LV_DRAW_TASK_TYPE_BORDER] = "draw_task_border",
+    [LV_DRAW_TASK_TYPE_BOX_SHADOW] = "draw_task_box_shadow",
+    [LV_DRAW_TASK_TYPE_LABEL] = "draw_task_label",
+    [LV_DRAW_TASK_TYPE_IMAGE] = "draw_task_image",
+    [LV_DRAW_TASK_TYPE_LAYER] = "draw_task_layer",
+    [LV_DRAW_TASK_TYPE_LINE] = "draw_task_line",
+    [LV_DRAW_TASK_TYPE_ARC] = "draw_task_arc",
+    [LV_DRAW_TASK_TYPE_TRIANGLE] = "draw_task_triangle",
+    [LV_DRAW_TASK_TYPE_MASK_RECTANGLE] = "draw_task_mask_rectangle",
+    [LV_DRAW_TASK_TYPE_MASK_BITMAP] = "draw_task_mask_bitmap",
+    [LV_DRAW_TASK_TYPE_VECTOR] = "draw_task_vector",
+};
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -250,6 +269,7 @@ static void execute_drawing(lv_draw_sw_unit_t * u)
     LV_PROFILER_DRAW_BEGIN;
     /*Render the draw task*/
     lv_draw_task_t * t = u->task_act;
+    LV_PROFILER_DRAW_BEGIN_TAG(task_type_tags[t->type]);
     switch(t->type) {
         case LV_DRAW_TASK_TYPE_FILL:
             lv_draw_sw_fill((lv_draw_unit_t *)u, t->draw_dsc, &t->area);
@@ -289,6 +309,7 @@ static void execute_drawing(lv_draw_sw_unit_t * u)
         default:
             break;
     }
+    LV_PROFILER_DRAW_END_TAG(task_type_tags[t->type]);
 
 #if LV_USE_PARALLEL_DRAW_DEBUG
     /*Layers manage it for themselves*/
@@ -78,6 +78,8 @@ static void recolor(lv_area_t relative_area, uint8_t * src_buf, uint8_t * dest_b
 
 static bool apply_mask(const lv_draw_image_dsc_t * draw_dsc);
 
+static bool can_blend_indexed(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -191,11 +193,21 @@ void lv_draw_sw_layer(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * dr
 void lv_draw_sw_image(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc,
                       const lv_area_t * coords)
 {
+    /*Keep indexed images indexed if they can be blended through their palette,
+     *otherwise the decoder converts them to ARGB8888*/
+    lv_image_decoder_args_t args;
+    const lv_image_decoder_args_t * args_p = NULL;
+    if(can_blend_indexed(draw_unit, draw_dsc)) {
+        lv_memzero(&args, sizeof(args));
+        args.use_indexed = true;
+        args_p = &args;
+    }
+
     if(!draw_dsc->tile) {
-        lv_draw_image_normal_helper(draw_unit, draw_dsc, coords, img_draw_core);
+        lv_draw_image_normal_helper(draw_unit, draw_dsc, coords, args_p, img_draw_core);
     }
     else {
-        lv_draw_image_tiled_helper(draw_unit, draw_dsc, coords, img_draw_core);
+        lv_draw_image_tiled_helper(draw_unit, draw_dsc, coords, args_p, img_draw_core);
     }
 }
 
@@ -264,6 +276,15 @@ static void img_draw_core(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t
         blend_dsc.src_color_format = cf;
         lv_draw_sw_blend(draw_unit, &blend_dsc);
     }
+    /*Indexed image kept as is by the decoder (see can_blend_indexed()). The palette is in front of the indices.*/
+    else if(!transformed && !radius && LV_COLOR_FORMAT_IS_INDEXED(cf) && draw_dsc->recolor_opa <= LV_OPA_MIN) {
+        blend_dsc.src_area = img_coords;
+        blend_dsc.src_buf = src_buf + LV_COLOR_INDEXED_PALETTE_SIZE(cf) * sizeof(lv_color32_t);
+        blend_dsc.src_palette = (const lv_color32_t *)src_buf;
+        blend_dsc.blend_area = img_coords;
+        blend_dsc.src_color_format = cf;
+        lv_draw_sw_blend(draw_unit, &blend_dsc);
+    }
     /*The simplest case just copy the pixels into the draw_buf. Blending will convert the colors if needed*/
     else if(!transformed && !radius && draw_dsc->recolor_opa <= LV_OPA_MIN) {
         blend_dsc.src_area = img_coords;
@@ -685,4 +706,25 @@ static bool apply_mask(const lv_draw_image_dsc_t * draw_dsc)
     return true;
 }
 
+static bool can_blend_indexed(lv_draw_unit_t * draw_unit, const lv_draw_image_dsc_t * draw_dsc)
+{
+#if LV_DRAW_SW_SUPPORT_RGB565
+    if(!LV_COLOR_FORMAT_IS_INDEXED(draw_dsc->header.cf)) return false;
+    if(draw_unit->target_layer->color_format != LV_COLOR_FORMAT_RGB565) return false;
+
+    /*Only variables are used in place. Files and compressed images would be cached as indexed
+     *and other draw tasks (e.g. transformed ones) can't use them from the cache.*/
+    if(lv_image_src_get_type(draw_dsc->src) != LV_IMAGE_SRC_VARIABLE) return false;
+    if(draw_dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) return false;
+
+    /*Transformation, recoloring and rounded corners need ARGB8888 pixels*/
+    return draw_dsc->rotation == 0 && draw_dsc->scale_x == LV_SCALE_NONE && draw_dsc->scale_y == LV_SCALE_NONE &&
+           draw_dsc->clip_radius == 0 && draw_dsc->recolor_opa <= LV_OPA_MIN;
+#else
+    LV_UNUSED(draw_unit);
+    LV_UNUSED(draw_dsc);
+    return false;
+#endif
+}
+
 #endif /*LV_USE_DRAW_SW*/
@@ -15,10 +15,28 @@
 #include "../../misc/lv_color.h"
 #include "../../stdlib/lv_string.h"
 
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_CUSTOM
+    #include LV_DRAW_SW_ASM_CUSTOM_INCLUDE
+#endif
+
 /*********************
  *      DEFINES
  *********************/
 
+/*Called once per destination row before the pixels are walked*/
+#ifndef LV_DRAW_SW_TRANSFORM_WALK_START
+    #define LV_DRAW_SW_TRANSFORM_WALK_START(xs_ups, ys_ups, xs_step, ys_step)
+#endif
+
+/*Set the upscaled source coordinates of the `x`th pixel of the row*/
+#ifndef LV_DRAW_SW_TRANSFORM_WALK_NEXT
+    #define LV_DRAW_SW_TRANSFORM_WALK_NEXT(x, xs_ups, ys_ups, xs_ups_start, ys_ups_start, xs_step, ys_step) \
+        do { \
+            xs_ups = xs_ups_start + ((xs_step * x) >> 8); \
+            ys_ups = ys_ups_start + ((ys_step * x) >> 8); \
+        } while(0)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -294,12 +312,12 @@ static void transform_rgb888(const uint8_t * src, int32_t src_w, int32_t src_h,
 {
     int32_t xs_ups_start = xs_ups;
     int32_t ys_ups_start = ys_ups;
+    LV_DRAW_SW_TRANSFORM_WALK_START(xs_ups, ys_ups, xs_step, ys_step);
     lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
 
     int32_t x;
     for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+        LV_DRAW_SW_TRANSFORM_WALK_NEXT(x, xs_ups, ys_ups, xs_ups_start, ys_ups_start, xs_step, ys_step);
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -394,12 +412,12 @@ static void transform_argb8888(const uint8_t * src, int32_t src_w, int32_t src_h
 {
     int32_t xs_ups_start = xs_ups;
     int32_t ys_ups_start = ys_ups;
+    LV_DRAW_SW_TRANSFORM_WALK_START(xs_ups, ys_ups, xs_step, ys_step);
     lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
 
     int32_t x;
     for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+        LV_DRAW_SW_TRANSFORM_WALK_NEXT(x, xs_ups, ys_ups, xs_ups_start, ys_ups_start, xs_step, ys_step);
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -487,6 +505,7 @@ static void transform_rgb565a8(const uint8_t * src, int32_t src_w, int32_t src_h
 {
     int32_t xs_ups_start = xs_ups;
     int32_t ys_ups_start = ys_ups;
+    LV_DRAW_SW_TRANSFORM_WALK_START(xs_ups, ys_ups, xs_step, ys_step);
 
     const lv_opa_t * src_alpha = src + src_stride * src_h;
 
@@ -495,8 +514,7 @@ static void transform_rgb565a8(const uint8_t * src, int32_t src_w, int32_t src_h
 
     int32_t x;
     for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+        LV_DRAW_SW_TRANSFORM_WALK_NEXT(x, xs_ups, ys_ups, xs_ups_start, ys_ups_start, xs_step, ys_step);
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -602,11 +620,11 @@ static void transform_a8(const uint8_t * src, int32_t src_w, int32_t src_h, int3
 {
     int32_t xs_ups_start = xs_ups;
     int32_t ys_ups_start = ys_ups;
+    LV_DRAW_SW_TRANSFORM_WALK_START(xs_ups, ys_ups, xs_step, ys_step);
 
     int32_t x;
     for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+        LV_DRAW_SW_TRANSFORM_WALK_NEXT(x, xs_ups, ys_ups, xs_ups_start, ys_ups_start, xs_step, ys_step);
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
@@ -680,12 +698,12 @@ static void transform_l8_to_al88(const uint8_t * src, int32_t src_w, int32_t src
 {
     int32_t xs_ups_start = xs_ups;
     int32_t ys_ups_start = ys_ups;
+    LV_DRAW_SW_TRANSFORM_WALK_START(xs_ups, ys_ups, xs_step, ys_step);
     lv_color16a_t * dest_al88 = (lv_color16a_t *)dest_buf;
 
     int32_t x;
     for(x = 0; x < x_end; x++) {
-        xs_ups = xs_ups_start + ((xs_step * x) >> 8);
-        ys_ups = ys_ups_start + ((ys_step * x) >> 8);
+        LV_DRAW_SW_TRANSFORM_WALK_NEXT(x, xs_ups, ys_ups, xs_ups_start, ys_ups_start, xs_step, ys_step);
 
         int32_t xs_int = xs_ups >> 8;
         int32_t ys_int = ys_ups >> 8;
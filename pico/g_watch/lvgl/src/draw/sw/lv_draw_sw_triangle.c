@@ -126,6 +126,7 @@ void lv_draw_sw_triangle(lv_draw_unit_t * draw_unit, const lv_draw_triangle_dsc_
     lv_area_t blend_area = draw_area;
     blend_area.y2 = blend_area.y1;
     lv_draw_sw_blend_dsc_t blend_dsc;
+    lv_memzero(&blend_dsc, sizeof(blend_dsc));
     blend_dsc.color = dsc->bg_color;
     blend_dsc.opa = dsc->bg_opa;
     blend_dsc.mask_buf = mask_buf;
@@ -37,11 +37,16 @@
 
 /**
  * Data format for compressed image data.
+ * If `band_height` is not 0, the compressed data starts with a table of `band_cnt + 1`
+ * `uint32_t` offsets relative to the start of the table (the last one equals to `compressed_size`),
+ * followed by the bands. Each band is `band_height` rows (the last one can be shorter)
+ * compressed independently with `method`, so the rows can be decompressed band by band.
  */
 
 typedef struct _lv_image_compressed_t {
     uint32_t method: 4; /*Compression method, see `lv_image_compress_t`*/
-    uint32_t reserved : 28;  /*Reserved to be used later*/
+    uint32_t band_height: 12; /*Rows per independently compressed band, 0: the image is compressed as a whole*/
+    uint32_t reserved : 16;  /*Reserved to be used later*/
     uint32_t compressed_size;  /*Compressed data size in byte*/
     uint32_t decompressed_size;  /*Decompressed data size in byte*/
     const uint8_t * data; /*Compressed data*/
@@ -56,6 +61,9 @@ typedef struct {
     lv_draw_buf_t * decompressed;       /*Decompressed data could be used directly, thus must also be draw buf*/
     lv_draw_buf_t c_array;              /*An C-array image that need to be converted to a draw buf*/
     lv_draw_buf_t * decoded_partial;    /*A draw buf for decoded image via get_area_cb*/
+    uint32_t * band_ofs;                /*Band offset table of a banded compressed image*/
+    uint8_t * band_buf;                 /*Compressed band read from file*/
+    int32_t band_decoded;               /*The band stored in `decoded_partial`, -1 if none*/
 } decoder_data_t;
 
 /**********************
@@ -72,10 +80,17 @@ static lv_result_t decode_alpha_only(lv_image_decoder_t * decoder, lv_image_deco
 static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_color32_t * palette, int32_t x,
                                        int32_t w_px, const uint8_t * in, lv_color32_t * out);
 static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static lv_result_t read_compressed_header(lv_image_decoder_dsc_t * dsc, lv_image_compressed_t * compressed);
+static bool is_banded(lv_image_decoder_dsc_t * dsc);
+static lv_result_t open_banded(lv_image_decoder_dsc_t * dsc);
+static lv_result_t decode_band_area(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
+                                    lv_area_t * decoded_area);
 
 static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, void * buff, uint32_t btr, uint32_t * br);
 
 static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image_compressed_t * compressed);
+static lv_result_t decompress_data(lv_color_format_t cf, uint32_t method, const uint8_t * input, uint32_t input_len,
+                                   uint8_t * output, uint32_t output_len);
 
 /**********************
  *  STATIC VARIABLES
@@ -216,7 +231,8 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
         lv_color_format_t cf = dsc->header.cf;
 
         if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
-            res = decode_compressed(decoder, dsc);
+            /*Banded images are decompressed band by band in get_area_cb*/
+            res = is_banded(dsc) ? open_banded(dsc) : decode_compressed(decoder, dsc);
         }
         else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
             if(dsc->args.use_indexed) {
@@ -256,7 +272,8 @@ lv_result_t lv_bin_decoder_open(lv_image_decoder_t * decoder, lv_image_decoder_d
 
         lv_color_format_t cf = image->header.cf;
         if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
-            res = decode_compressed(decoder, dsc);
+            /*Banded images are decompressed band by band in get_area_cb*/
+            res = is_banded(dsc) ? open_banded(dsc) : decode_compressed(decoder, dsc);
         }
         else if(LV_COLOR_FORMAT_IS_INDEXED(cf)) {
             /*Need decoder data to store converted image*/
@@ -406,6 +423,8 @@ lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
         return LV_RESULT_INVALID;
     }
 
+    if(decoder_data->band_ofs) return decode_band_area(dsc, full_area, decoded_area);
+
     lv_fs_file_t * f = decoder_data->f;
     uint32_t bpp = lv_color_format_get_bpp(cf);
     int32_t w_px = lv_area_get_width(full_area);
@@ -551,6 +570,8 @@ static void free_decoder_data(lv_image_decoder_dsc_t * dsc)
     if(decoder_data->decoded) lv_draw_buf_destroy(decoder_data->decoded);
     if(decoder_data->decompressed) lv_draw_buf_destroy(decoder_data->decompressed);
     lv_free(decoder_data->palette);
+    lv_free(decoder_data->band_ofs);
+    lv_free(decoder_data->band_buf);
     lv_free(decoder_data);
     dsc->user_data = NULL;
 }
@@ -679,30 +700,12 @@ exit_with_buf:
 
 static lv_result_t load_indexed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
 {
-#if LV_BIN_DECODER_RAM_LOAD == 0
     LV_UNUSED(decoder); /*Unused*/
-    LV_UNUSED(dsc); /*Unused*/
-    LV_LOG_ERROR("LV_BIN_DECODER_RAM_LOAD is disabled");
-    return LV_RESULT_INVALID;
-#else
 
-    LV_UNUSED(decoder); /*Unused*/
-
-    lv_fs_res_t res;
-    uint32_t rn;
     decoder_data_t * decoder_data = dsc->user_data;
 
-    if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
-        /*The decompressed image is already loaded to RAM*/
-        dsc->decoded = decoder_data->decompressed;
-
-        /*Transfer ownership to decoded pointer because it's the final data we use.*/
-        decoder_data->decoded = decoder_data->decompressed;
-        decoder_data->decompressed = NULL;
-        return LV_RESULT_OK;
-    }
-
-    if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
+    /*Variables are used in place, so they don't need LV_BIN_DECODER_RAM_LOAD*/
+    if(dsc->src_type == LV_IMAGE_SRC_VARIABLE && !(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED)) {
         lv_image_dsc_t * image = (lv_image_dsc_t *)dsc->src;
         lv_draw_buf_t * decoded;
         if(image->header.flags & LV_IMAGE_FLAGS_ALLOCATED) {
@@ -723,6 +726,24 @@ static lv_result_t load_indexed(lv_image_decoder_t * decoder, lv_image_decoder_d
         return LV_RESULT_OK;
     }
 
+#if LV_BIN_DECODER_RAM_LOAD == 0
+    LV_LOG_ERROR("LV_BIN_DECODER_RAM_LOAD is disabled");
+    return LV_RESULT_INVALID;
+#else
+
+    lv_fs_res_t res;
+    uint32_t rn;
+
+    if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
+        /*The decompressed image is already loaded to RAM*/
+        dsc->decoded = decoder_data->decompressed;
+
+        /*Transfer ownership to decoded pointer because it's the final data we use.*/
+        decoder_data->decoded = decoder_data->decompressed;
+        decoder_data->decompressed = NULL;
+        return LV_RESULT_OK;
+    }
+
     if(dsc->src_type == LV_IMAGE_SRC_FILE) {
         lv_color_format_t cf = dsc->header.cf;
         lv_fs_file_t * f = decoder_data->f;
@@ -1090,8 +1111,6 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
     uint8_t * img_data;
     uint32_t out_len = compressed->decompressed_size;
     uint32_t input_len = compressed->compressed_size;
-    LV_UNUSED(input_len);
-    LV_UNUSED(out_len);
 
     lv_draw_buf_t * decompressed = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, dsc->header.w, dsc->header.h,
                                                          dsc->header.cf,
@@ -1109,53 +1128,227 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
 
     img_data = decompressed->data;
 
-    if(compressed->method == LV_IMAGE_COMPRESS_RLE) {
+    if(decompress_data(dsc->header.cf, compressed->method, compressed->data, input_len, img_data, out_len)
+       != LV_RESULT_OK) {
+        lv_draw_buf_destroy(decompressed);
+        return LV_RESULT_INVALID;
+    }
+
+    decoder_data->decompressed = decompressed; /*Free on decoder close*/
+    return LV_RESULT_OK;
+}
+
+static lv_result_t decompress_data(lv_color_format_t cf, uint32_t method, const uint8_t * input, uint32_t input_len,
+                                   uint8_t * output, uint32_t output_len)
+{
+    LV_UNUSED(cf);
+    LV_UNUSED(input);
+    LV_UNUSED(input_len);
+    LV_UNUSED(output);
+    LV_UNUSED(output_len);
+
+    if(method == LV_IMAGE_COMPRESS_RLE) {
 #if LV_USE_RLE
         /*Compress always happen on byte*/
         uint32_t pixel_byte;
-        if(dsc->header.cf == LV_COLOR_FORMAT_RGB565A8)
+        if(cf == LV_COLOR_FORMAT_RGB565A8)
             pixel_byte = 2;
         else
-            pixel_byte = (lv_color_format_get_bpp(dsc->header.cf) + 7) >> 3;
-        const uint8_t * input = compressed->data;
-        uint8_t * output = img_data;
-        uint32_t len;
-        len = lv_rle_decompress(input, input_len, output, out_len, pixel_byte);
-        if(len != compressed->decompressed_size) {
-            LV_LOG_WARN("Decompress failed: %" LV_PRIu32 ", got: %" LV_PRIu32, out_len, len);
-            lv_draw_buf_destroy(decompressed);
+            pixel_byte = (lv_color_format_get_bpp(cf) + 7) >> 3;
+        uint32_t len = lv_rle_decompress(input, input_len, output, output_len, pixel_byte);
+        if(len != output_len) {
+            LV_LOG_WARN("Decompress failed: %" LV_PRIu32 ", got: %" LV_PRIu32, output_len, len);
             return LV_RESULT_INVALID;
         }
+        return LV_RESULT_OK;
 #else
         LV_LOG_WARN("RLE decompress is not enabled");
-        lv_draw_buf_destroy(decompressed);
         return LV_RESULT_INVALID;
 #endif
     }
-    else if(compressed->method == LV_IMAGE_COMPRESS_LZ4) {
+    else if(method == LV_IMAGE_COMPRESS_LZ4) {
 #if LV_USE_LZ4
-        const char * input = (const char *)compressed->data;
-        char * output = (char *)img_data;
-        int len;
-        len = LZ4_decompress_safe(input, output, input_len, out_len);
-        if(len < 0 || (uint32_t)len != compressed->decompressed_size) {
-            LV_LOG_WARN("Decompress failed: %" LV_PRId32 ", got: %" LV_PRId32, out_len, len);
-            lv_draw_buf_destroy(decompressed);
+        int len = LZ4_decompress_safe((const char *)input, (char *)output, input_len, output_len);
+        if(len < 0 || (uint32_t)len != output_len) {
+            LV_LOG_WARN("Decompress failed: %" LV_PRId32 ", got: %" LV_PRId32, output_len, len);
             return LV_RESULT_INVALID;
         }
+        return LV_RESULT_OK;
 #else
         LV_LOG_WARN("LZ4 decompress is not enabled");
-        lv_draw_buf_destroy(decompressed);
         return LV_RESULT_INVALID;
 #endif
     }
+
+    LV_LOG_WARN("Unknown compression method: %" LV_PRIu32, method);
+    return LV_RESULT_INVALID;
+}
+
+static lv_result_t read_compressed_header(lv_image_decoder_dsc_t * dsc, lv_image_compressed_t * compressed)
+{
+    lv_memzero(compressed, sizeof(lv_image_compressed_t));
+
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        decoder_data_t * decoder_data = dsc->user_data;
+        uint32_t rn;
+        lv_fs_res_t res = fs_read_file_at(decoder_data->f, sizeof(lv_image_header_t), compressed, 12, &rn);
+        if(res != LV_FS_RES_OK || rn != 12) {
+            LV_LOG_WARN("Read compressed header failed: %d", res);
+            return LV_RESULT_INVALID;
+        }
+    }
     else {
-        LV_UNUSED(img_data);
-        LV_LOG_WARN("Unknown compression method: %d", compressed->method);
-        lv_draw_buf_destroy(decompressed);
+        const lv_image_dsc_t * image = dsc->src;
+        if(image->data_size < 12) return LV_RESULT_INVALID;
+        lv_memcpy(compressed, image->data, 12);
+    }
+
+    return LV_RESULT_OK;
+}
+
+static bool is_banded(lv_image_decoder_dsc_t * dsc)
+{
+    lv_image_compressed_t compressed;
+    if(read_compressed_header(dsc, &compressed) != LV_RESULT_OK) return false;
+    return compressed.band_height != 0;
+}
+
+static lv_result_t open_banded(lv_image_decoder_dsc_t * dsc)
+{
+    decoder_data_t * decoder_data = get_decoder_data(dsc);
+    if(decoder_data == NULL) return LV_RESULT_INVALID;
+
+    lv_image_compressed_t * compressed = &decoder_data->compressed;
+    if(read_compressed_header(dsc, compressed) != LV_RESULT_OK) return LV_RESULT_INVALID;
+
+    /*Only formats whose rows are stored one after the other can be split to bands*/
+    lv_color_format_t cf = dsc->header.cf;
+    if(cf != LV_COLOR_FORMAT_ARGB8888 && cf != LV_COLOR_FORMAT_XRGB8888 && cf != LV_COLOR_FORMAT_RGB888
+       && cf != LV_COLOR_FORMAT_RGB565 && cf != LV_COLOR_FORMAT_ARGB8565) {
+        LV_LOG_WARN("CF: %d is not supported for banded images", cf);
         return LV_RESULT_INVALID;
     }
 
-    decoder_data->decompressed = decompressed; /*Free on decoder close*/
+    uint32_t band_h = compressed->band_height;
+    uint32_t band_cnt = (dsc->header.h + band_h - 1) / band_h;
+    uint32_t table_size = (band_cnt + 1) * sizeof(uint32_t);
+    if(compressed->decompressed_size != (uint32_t)dsc->header.stride * dsc->header.h
+       || compressed->compressed_size < table_size) {
+        LV_LOG_WARN("Invalid banded image size");
+        return LV_RESULT_INVALID;
+    }
+
+    decoder_data->band_ofs = lv_malloc(table_size);
+    LV_ASSERT_MALLOC(decoder_data->band_ofs);
+    if(decoder_data->band_ofs == NULL) return LV_RESULT_INVALID;
+
+    uint32_t * band_ofs = decoder_data->band_ofs;
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        uint32_t rn;
+        lv_fs_res_t res = fs_read_file_at(decoder_data->f, sizeof(lv_image_header_t) + 12, band_ofs, table_size, &rn);
+        if(res != LV_FS_RES_OK || rn != table_size) {
+            LV_LOG_WARN("Read band table failed: %d", res);
+            return LV_RESULT_INVALID;
+        }
+    }
+    else {
+        const lv_image_dsc_t * image = dsc->src;
+        if(image->data_size < 12 + compressed->compressed_size) {
+            LV_LOG_WARN("Compressed size mismatch: %" LV_PRIu32" > %" LV_PRIu32, compressed->compressed_size,
+                        image->data_size - 12);
+            return LV_RESULT_INVALID;
+        }
+        lv_memcpy(band_ofs, image->data + 12, table_size);
+    }
+
+    /*The bands must follow the table in order and end with the compressed data*/
+    if(band_ofs[0] != table_size || band_ofs[band_cnt] != compressed->compressed_size) {
+        LV_LOG_WARN("Invalid band table");
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t max_band_size = 0;
+    uint32_t i;
+    for(i = 0; i < band_cnt; i++) {
+        if(band_ofs[i + 1] < band_ofs[i]) {
+            LV_LOG_WARN("Invalid band table");
+            return LV_RESULT_INVALID;
+        }
+        max_band_size = LV_MAX(max_band_size, band_ofs[i + 1] - band_ofs[i]);
+    }
+
+    /*Bands of a file are read to this buffer, variables are decompressed in place*/
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        decoder_data->band_buf = lv_malloc(max_band_size);
+        LV_ASSERT_MALLOC(decoder_data->band_buf);
+        if(decoder_data->band_buf == NULL) return LV_RESULT_INVALID;
+    }
+
+    decoder_data->band_decoded = -1;
+    return LV_RESULT_OK;
+}
+
+static lv_result_t decode_band_area(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
+                                    lv_area_t * decoded_area)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    const lv_image_compressed_t * compressed = &decoder_data->compressed;
+    lv_color_format_t cf = dsc->header.cf;
+    int32_t band_h = compressed->band_height;
+
+    /*Continue with the band below the previously returned one*/
+    int32_t y = decoded_area->y1 == LV_COORD_MIN ? full_area->y1 : decoded_area->y2 + 1;
+    if(y > full_area->y2 || y >= dsc->header.h) return LV_RESULT_INVALID;
+
+    int32_t band = y / band_h;
+    int32_t band_y1 = band * band_h;
+    int32_t rows = LV_MIN(band_h, dsc->header.h - band_y1);
+
+    lv_draw_buf_t * decoded = decoder_data->decoded_partial;
+    if(band != decoder_data->band_decoded) {
+        if(decoded == NULL) {
+            /*Allocated for a whole band, the last band can be shorter*/
+            decoded = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, dsc->header.w, band_h, cf, dsc->header.stride);
+            if(decoded == NULL) {
+                LV_LOG_WARN("No memory for decompressed band");
+                return LV_RESULT_INVALID;
+            }
+            decoder_data->decoded_partial = decoded; /*Free on decoder close*/
+        }
+        lv_draw_buf_reshape(decoded, cf, dsc->header.w, rows, dsc->header.stride);
+
+        uint32_t ofs = decoder_data->band_ofs[band];
+        uint32_t len = decoder_data->band_ofs[band + 1] - ofs;
+        const uint8_t * input;
+        if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+            uint32_t rn;
+            lv_fs_res_t res = fs_read_file_at(decoder_data->f, sizeof(lv_image_header_t) + 12 + ofs,
+                                              decoder_data->band_buf, len, &rn);
+            if(res != LV_FS_RES_OK || rn != len) {
+                LV_LOG_WARN("Read band failed: %d", res);
+                return LV_RESULT_INVALID;
+            }
+            input = decoder_data->band_buf;
+        }
+        else {
+            const lv_image_dsc_t * image = dsc->src;
+            input = image->data + 12 + ofs;
+        }
+
+        decoder_data->band_decoded = -1;
+        if(decompress_data(cf, compressed->method, input, len, decoded->data,
+                           (uint32_t)dsc->header.stride * rows) != LV_RESULT_OK) {
+            return LV_RESULT_INVALID;
+        }
+        decoder_data->band_decoded = band;
+    }
+
+    /*Whole rows are returned, the caller clips them to the drawn area*/
+    decoded_area->x1 = 0;
+    decoded_area->x2 = dsc->header.w - 1;
+    decoded_area->y1 = band_y1;
+    decoded_area->y2 = band_y1 + rows - 1;
+
+    dsc->decoded = decoded;
     return LV_RESULT_OK;
 }
@@ -596,10 +596,11 @@ read_image_data(gd_GIF * gif, int interlace)
         if(ret == 1) key_size++;
         entry = table->entries[key];
         str_len = entry.length;
-	if(frm_off + str_len >= frm_size){
-		LV_LOG_WARN("LZW table token overflows the frame buffer");
-		return -1;
-	}
+        if(frm_off + str_len > frm_size) {
+            LV_LOG_WARN("LZW table token overflows the frame buffer");
+            lv_free(table);
+            return -1;
+        }
         for(i = 0; i < str_len; i++) {
             p = frm_off + entry.length - 1;
             x = p % gif->fw;
@@ -657,6 +658,28 @@ read_image(gd_GIF * gif)
     return read_image_data(gif, interlace);
 }
 
+/* Extend the changed area of the canvas with a rectangle. */
+static void
+add_changed_rect(gd_GIF * gif, uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+    if(w == 0 || h == 0) return;
+
+    if(gif->cw == 0 || gif->ch == 0) {
+        gif->cx = x;
+        gif->cy = y;
+        gif->cw = w;
+        gif->ch = h;
+        return;
+    }
+
+    uint16_t x2 = MAX(gif->cx + gif->cw, x + w);
+    uint16_t y2 = MAX(gif->cy + gif->ch, y + h);
+    gif->cx = MIN(gif->cx, x);
+    gif->cy = MIN(gif->cy, y);
+    gif->cw = x2 - gif->cx;
+    gif->ch = y2 - gif->cy;
+}
+
 static void
 render_frame_rect(gd_GIF * gif, uint8_t * buffer)
 {
@@ -665,23 +688,38 @@ render_frame_rect(gd_GIF * gif, uint8_t * buffer)
     GIFDEC_RENDER_FRAME(&buffer[i * 4], gif->fw, gif->fh, gif->width,
                         &gif->frame[i], gif->palette->colors,
                         gif->gce.transparency ? gif->gce.tindex : 0x100);
+    if(buffer == gif->canvas) add_changed_rect(gif, gif->fx, gif->fy, gif->fw, gif->fh);
 #else
     int j, k;
-    uint8_t index, * color;
+    uint8_t index, * color, * px;
+    /* Bounding box of the pixels which really change on the canvas */
+    int track = buffer == gif->canvas;
+    int min_x = gif->fw, min_y = gif->fh, max_x = -1, max_y = -1;
 
     for(j = 0; j < gif->fh; j++) {
         for(k = 0; k < gif->fw; k++) {
             index = gif->frame[(gif->fy + j) * gif->width + gif->fx + k];
             color = &gif->palette->colors[index * 3];
             if(!gif->gce.transparency || index != gif->gce.tindex) {
-                buffer[(i + k) * 4 + 0] = *(color + 2);
-                buffer[(i + k) * 4 + 1] = *(color + 1);
-                buffer[(i + k) * 4 + 2] = *(color + 0);
-                buffer[(i + k) * 4 + 3] = 0xFF;
+                px = &buffer[(i + k) * 4];
+                if(track && (px[0] != color[2] || px[1] != color[1] || px[2] != color[0] || px[3] != 0xFF)) {
+                    min_x = MIN(min_x, k);
+                    max_x = MAX(max_x, k);
+                    min_y = MIN(min_y, j);
+                    max_y = j;
+                }
+                px[0] = *(color + 2);
+                px[1] = *(color + 1);
+                px[2] = *(color + 0);
+                px[3] = 0xFF;
             }
         }
         i += gif->width;
     }
+
+    if(max_x >= 0) {
+        add_changed_rect(gif, gif->fx + min_x, gif->fy + min_y, max_x - min_x + 1, max_y - min_y + 1);
+    }
 #endif
 }
 
@@ -712,13 +750,15 @@ dispose(gd_GIF * gif)
                 i += gif->width;
             }
 #endif
+            add_changed_rect(gif, gif->fx, gif->fy, gif->fw, gif->fh);
             break;
         case 3: /* Restore to previous, i.e., don't update canvas.*/
             break;
         default:
-            /* Add frame non-transparent pixels to canvas. */
-            render_frame_rect(gif, gif->canvas);
+            /* Add frame non-transparent pixels to canvas if gd_render_frame() didn't do it. */
+            if(!gif->frame_on_canvas) render_frame_rect(gif, gif->canvas);
     }
+    gif->frame_on_canvas = 0;
 }
 
 /* Return 1 if got a frame; 0 if got GIF trailer; -1 if error. */
@@ -727,11 +767,13 @@ gd_get_frame(gd_GIF * gif)
 {
     char sep;
 
+    gif->cw = gif->ch = 0;
     dispose(gif);
     f_gif_read(gif, &sep, 1);
     while(sep != ',') {
         if(sep == ';') {
             f_gif_seek(gif, gif->anim_start, LV_FS_SEEK_SET);
+            gif->frame_cnt = 0;
             if(gif->loop_count == 1 || gif->loop_count < 0) {
                 return 0;
             }
@@ -746,6 +788,7 @@ gd_get_frame(gd_GIF * gif)
     }
     if(read_image(gif) == -1)
         return -1;
+    gif->frame_cnt++;
     return 1;
 }
 
@@ -753,12 +796,14 @@ void
 gd_render_frame(gd_GIF * gif, uint8_t * buffer)
 {
     render_frame_rect(gif, buffer);
+    if(buffer == gif->canvas) gif->frame_on_canvas = 1;
 }
 
 void
 gd_rewind(gd_GIF * gif)
 {
     gif->loop_count = -1;
+    gif->frame_cnt = 0;
     f_gif_seek(gif, gif->anim_start, LV_FS_SEEK_SET);
 }
 
@@ -45,6 +45,9 @@ typedef struct _gd_GIF {
     void (*comment)(struct _gd_GIF * gif);
     void (*application)(struct _gd_GIF * gif, char id[8], char auth[3]);
     uint16_t fx, fy, fw, fh;
+    uint16_t cx, cy, cw, ch;    /* Area of `canvas` changed by the last gd_get_frame() and gd_render_frame() */
+    int32_t frame_cnt;          /* Number of frames read since the start of the animation */
+    uint8_t frame_on_canvas;    /* The current frame is already rendered to `canvas` */
     uint8_t bgindex;
     uint8_t * canvas, * frame;
     #if LV_GIF_CACHE_DECODE_DATA
@@ -10,7 +10,10 @@
 #if LV_USE_GIF
 #include "../../misc/lv_timer_private.h"
 #include "../../misc/cache/lv_image_cache.h"
+#include "../../misc/lv_array.h"
+#include "../../misc/lv_area_private.h"
 #include "../../core/lv_obj_class_private.h"
+#include "../../widgets/image/lv_image_private.h"
 
 #include "gifdec.h"
 
@@ -23,12 +26,34 @@
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    lv_area_t area;     /*Area of the canvas changed by the frame, empty if nothing has changed*/
+    uint8_t * data;     /*ARGB8888 pixels of `area` after the frame*/
+    uint16_t delay;     /*Delay of the frame in 10 ms units*/
+} frame_cache_entry_t;
+
+struct _lv_gif_frame_cache_t {
+    /*Frame 1..N-1 of the first loop, then frame 0 of the second loop
+     *as it's the change from the last frame back to the first one*/
+    lv_array_t frames;
+    uint32_t max_size;
+    uint32_t size;
+    uint32_t cur;           /*Index of the displayed frame or UINT32_MAX if frame 0 is the next*/
+    uint16_t delay;         /*Delay of the displayed frame*/
+    uint8_t complete : 1;   /*All frames are recorded, play from the cache*/
+    uint8_t failed : 1;     /*Over the budget or the frames came out of order: don't record anymore*/
+};
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
 static void lv_gif_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_gif_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void next_frame_task_cb(lv_timer_t * t);
+static void invalidate_canvas_area(lv_obj_t * obj, const lv_area_t * area);
+static void frame_cache_clear(lv_gif_t * gifobj, bool failed);
+static void frame_cache_record(lv_gif_t * gifobj);
+static void frame_cache_play(lv_gif_t * gifobj);
 
 /**********************
  *  STATIC VARIABLES
@@ -68,6 +93,7 @@ void lv_gif_set_src(lv_obj_t * obj, const void * src)
     if(gif != NULL) {
         lv_image_cache_drop(lv_image_get_src(obj));
 
+        if(gifobj->frame_cache) frame_cache_clear(gifobj, false);
         gd_close_gif(gif);
         gifobj->gif = NULL;
         gifobj->imgdsc.data = NULL;
@@ -115,7 +141,17 @@ void lv_gif_restart(lv_obj_t * obj)
         return;
     }
 
-    gd_rewind(gifobj->gif);
+    lv_gif_frame_cache_t * cache = gifobj->frame_cache;
+    if(cache && cache->complete) {
+        /*Play from the cache, frame 0 comes next*/
+        cache->cur = UINT32_MAX;
+        gifobj->gif->loop_count = -1;
+    }
+    else {
+        /*The recorded frames would be out of order*/
+        if(cache && !cache->failed && gifobj->gif->frame_cnt != 0) frame_cache_clear(gifobj, false);
+        gd_rewind(gifobj->gif);
+    }
     lv_timer_resume(gifobj->timer);
     lv_timer_reset(gifobj->timer);
 }
@@ -168,6 +204,45 @@ void lv_gif_set_loop_count(lv_obj_t * obj, int32_t count)
     gifobj->gif->loop_count = count;
 }
 
+void lv_gif_set_frame_cache_size(lv_obj_t * obj, uint32_t max_size)
+{
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+    lv_gif_frame_cache_t * cache = gifobj->frame_cache;
+
+    if(max_size == 0) {
+        if(cache == NULL) return;
+        frame_cache_clear(gifobj, false);
+        lv_array_deinit(&cache->frames);
+        lv_free(cache);
+        gifobj->frame_cache = NULL;
+        return;
+    }
+
+    if(cache == NULL) {
+        cache = lv_malloc_zeroed(sizeof(lv_gif_frame_cache_t));
+        LV_ASSERT_MALLOC(cache);
+        if(cache == NULL) return;
+        lv_array_init(&cache->frames, 0, sizeof(frame_cache_entry_t));
+        gifobj->frame_cache = cache;
+    }
+    else if(max_size < cache->size) {
+        frame_cache_clear(gifobj, true);
+    }
+    else if(max_size > cache->max_size) {
+        /*Try again with the larger budget*/
+        cache->failed = 0;
+    }
+
+    cache->max_size = max_size;
+}
+
+bool lv_gif_is_frame_cache_complete(lv_obj_t * obj)
+{
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+
+    return gifobj->frame_cache && gifobj->frame_cache->complete;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -179,6 +254,7 @@ static void lv_gif_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_gif_t * gifobj = (lv_gif_t *) obj;
 
     gifobj->gif = NULL;
+    gifobj->frame_cache = NULL;
     gifobj->timer = lv_timer_create(next_frame_task_cb, 10, obj);
     lv_timer_pause(gifobj->timer);
 }
@@ -190,6 +266,7 @@ static void lv_gif_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     lv_image_cache_drop(lv_image_get_src(obj));
 
+    lv_gif_set_frame_cache_size(obj, 0);
     if(gifobj->gif)
         gd_close_gif(gifobj->gif);
     lv_timer_delete(gifobj->timer);
@@ -199,11 +276,18 @@ static void next_frame_task_cb(lv_timer_t * t)
 {
     lv_obj_t * obj = t->user_data;
     lv_gif_t * gifobj = (lv_gif_t *) obj;
+    lv_gif_frame_cache_t * cache = gifobj->frame_cache;
     uint32_t elaps = lv_tick_elaps(gifobj->last_call);
-    if(elaps < gifobj->gif->gce.delay * 10) return;
+    uint32_t delay = cache && cache->complete ? cache->delay : gifobj->gif->gce.delay;
+    if(elaps < delay * 10) return;
 
     gifobj->last_call = lv_tick_get();
 
+    if(cache && cache->complete) {
+        frame_cache_play(gifobj);
+        return;
+    }
+
     int has_next = gd_get_frame(gifobj->gif);
     if(has_next == 0) {
         /*It was the last repeat*/
@@ -212,10 +296,198 @@ static void next_frame_task_cb(lv_timer_t * t)
         if(res != LV_RESULT_OK) return;
     }
 
-    gd_render_frame(gifobj->gif, (uint8_t *)gifobj->imgdsc.data);
+    gd_GIF * gif = gifobj->gif;
+    gd_render_frame(gif, (uint8_t *)gifobj->imgdsc.data);
+    if(has_next == 1 && cache && !cache->failed) frame_cache_record(gifobj);
+
+    /*Redraw only the pixels which have really changed*/
+    if(gif->cw == 0 || gif->ch == 0) return;
+
+    lv_area_t area;
+    lv_area_set(&area, gif->cx, gif->cy, gif->cx + gif->cw - 1, gif->cy + gif->ch - 1);
+    lv_image_cache_drop(lv_image_get_src(obj));
+    invalidate_canvas_area(obj, &area);
+}
+
+/**
+ * Invalidate an area of the canvas on the screen
+ * @param obj       pointer to a gif object
+ * @param area      area relative to the canvas
+ */
+static void invalidate_canvas_area(lv_obj_t * obj, const lv_area_t * area)
+{
+    lv_image_t * img = (lv_image_t *)obj;
+
+    /*Transformed or tiled images are simply redrawn*/
+    if(img->rotation != 0 || img->scale_x != LV_SCALE_NONE || img->scale_y != LV_SCALE_NONE ||
+       img->align >= LV_IMAGE_ALIGN_AUTO_TRANSFORM) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    /*Place the image the same way as the draw event of the image does*/
+    lv_area_t img_area;
+    lv_area_set(&img_area, 0, 0, img->w - 1, img->h - 1);
+    lv_area_align(&obj->coords, &img_area, img->align, img->offset.x, img->offset.y);
+
+    lv_area_t inv_area = *area;
+    lv_area_move(&inv_area, img_area.x1, img_area.y1);
+    lv_obj_invalidate_area(obj, &inv_area);
+}
+
+/**
+ * Free the recorded frames and start recording again
+ * @param gifobj    pointer to a gif object with frame cache
+ * @param failed    true: don't record anymore
+ */
+static void frame_cache_clear(lv_gif_t * gifobj, bool failed)
+{
+    lv_gif_frame_cache_t * cache = gifobj->frame_cache;
+
+    /*The decoder is ahead of the canvas, continue decoding from the first frame*/
+    if(cache->complete && gifobj->gif) {
+        int32_t loop_count = gifobj->gif->loop_count;
+        gd_rewind(gifobj->gif);
+        gifobj->gif->loop_count = loop_count;
+    }
+
+    uint32_t i;
+    for(i = 0; i < lv_array_size(&cache->frames); i++) {
+        frame_cache_entry_t * entry = lv_array_at(&cache->frames, i);
+        lv_free(entry->data);
+    }
+    lv_array_clear(&cache->frames);
+    lv_array_shrink(&cache->frames);
+
+    cache->size = 0;
+    cache->complete = 0;
+    cache->failed = failed;
+}
+
+/**
+ * Save the changed area of the canvas after the frame just rendered
+ * @param gifobj    pointer to a gif object with frame cache
+ */
+static void frame_cache_record(lv_gif_t * gifobj)
+{
+    lv_gif_frame_cache_t * cache = gifobj->frame_cache;
+    gd_GIF * gif = gifobj->gif;
+    uint32_t cnt = lv_array_size(&cache->frames);
+
+    /*Start with frame 1, frame 0 is saved at the end of the loop*/
+    if(cnt == 0 && gif->frame_cnt != 2) return;
+
+    bool last = gif->frame_cnt == 1;
+    if(!last && (uint32_t)gif->frame_cnt != cnt + 2) {
+        LV_LOG_WARN("Frames are out of order, frame cache disabled");
+        frame_cache_clear(gifobj, true);
+        return;
+    }
+
+    frame_cache_entry_t entry;
+    entry.delay = gif->gce.delay;
+    entry.data = NULL;
+    lv_area_set(&entry.area, gif->cx, gif->cy, gif->cx + gif->cw - 1, gif->cy + gif->ch - 1);
+    if(last) {
+        /*Save the whole frame 0 to start from it at any time, e.g. after lv_gif_restart()*/
+        lv_area_t frame_area;
+        lv_area_set(&frame_area, gif->fx, gif->fy, gif->fx + gif->fw - 1, gif->fy + gif->fh - 1);
+        if(gif->cw && gif->ch) lv_area_join(&entry.area, &entry.area, &frame_area);
+        else entry.area = frame_area;
+    }
+
+    int32_t w = lv_area_get_width(&entry.area);
+    int32_t h = lv_area_get_height(&entry.area);
+    uint32_t data_size = w > 0 && h > 0 ? w * h * 4 : 0;
+    if(cache->size + data_size + sizeof(entry) > cache->max_size) {
+        LV_LOG_INFO("Frames don't fit into %" LV_PRIu32 " bytes, frame cache disabled", cache->max_size);
+        frame_cache_clear(gifobj, true);
+        return;
+    }
+
+    if(data_size) {
+        entry.data = lv_malloc(data_size);
+        if(entry.data == NULL) {
+            LV_LOG_WARN("Out of memory, frame cache disabled");
+            frame_cache_clear(gifobj, true);
+            return;
+        }
+
+        uint32_t stride = gif->width * 4;
+        uint32_t row_size = w * 4;
+        const uint8_t * src = &gif->canvas[entry.area.y1 * stride + entry.area.x1 * 4];
+        uint8_t * dest = entry.data;
+        int32_t y;
+        for(y = 0; y < h; y++) {
+            lv_memcpy(dest, src, row_size);
+            dest += row_size;
+            src += stride;
+        }
+    }
+
+    if(lv_array_push_back(&cache->frames, &entry) != LV_RESULT_OK) {
+        lv_free(entry.data);
+        frame_cache_clear(gifobj, true);
+        return;
+    }
+
+    cache->size += data_size + sizeof(entry);
+    if(last) {
+        cache->complete = 1;
+        cache->cur = cnt;
+        cache->delay = entry.delay;
+    }
+}
+
+/**
+ * Show the next frame from the frame cache
+ * @param gifobj    pointer to a gif object with complete frame cache
+ */
+static void frame_cache_play(lv_gif_t * gifobj)
+{
+    lv_obj_t * obj = (lv_obj_t *)gifobj;
+    lv_gif_frame_cache_t * cache = gifobj->frame_cache;
+    gd_GIF * gif = gifobj->gif;
+    uint32_t last = lv_array_size(&cache->frames) - 1;
+    uint32_t next;
+
+    if(cache->cur == UINT32_MAX) {
+        next = last;
+    }
+    else {
+        next = cache->cur == last ? 0 : cache->cur + 1;
+        /*Back to frame 0: same loop handling as gd_get_frame()*/
+        if(next == last) {
+            if(gif->loop_count == 1 || gif->loop_count < 0) {
+                cache->cur = UINT32_MAX;
+                lv_timer_pause(gifobj->timer);
+                lv_obj_send_event(obj, LV_EVENT_READY, NULL);
+                return;
+            }
+            else if(gif->loop_count > 1) {
+                gif->loop_count--;
+            }
+        }
+    }
+
+    frame_cache_entry_t * entry = lv_array_at(&cache->frames, next);
+    cache->cur = next;
+    cache->delay = entry->delay;
+    if(entry->data == NULL) return;
+
+    uint32_t stride = gif->width * 4;
+    uint32_t row_size = lv_area_get_width(&entry->area) * 4;
+    const uint8_t * src = entry->data;
+    uint8_t * dest = &gif->canvas[entry->area.y1 * stride + entry->area.x1 * 4];
+    int32_t y;
+    for(y = entry->area.y1; y <= entry->area.y2; y++) {
+        lv_memcpy(dest, src, row_size);
+        src += row_size;
+        dest += stride;
+    }
 
     lv_image_cache_drop(lv_image_get_src(obj));
-    lv_obj_invalidate(obj);
+    invalidate_canvas_area(obj, &entry->area);
 }
 
 #endif /*LV_USE_GIF*/
@@ -91,6 +91,22 @@ int32_t lv_gif_get_loop_count(lv_obj_t * obj);
  */
 void lv_gif_set_loop_count(lv_obj_t * obj, int32_t count);
 
+/**
+ * Keep the frames of the first loop in RAM to play the next loops without decoding.
+ * Only the changed area of each frame is saved. If the frames don't fit into
+ * `max_size` bytes the cache is freed and the GIF is decoded as usual.
+ * @param obj       pointer to a gif obj
+ * @param max_size  memory budget of the cache in bytes, 0: disable the cache (default)
+ */
+void lv_gif_set_frame_cache_size(lv_obj_t * obj, uint32_t max_size);
+
+/**
+ * Check if all frames are in the frame cache, i.e. the GIF is played without decoding.
+ * @param obj       pointer to a gif obj
+ * @return          true: the frames are played from the cache
+ */
+bool lv_gif_is_frame_cache_complete(lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
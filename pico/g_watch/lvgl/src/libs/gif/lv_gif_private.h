@@ -27,6 +27,8 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+typedef struct _lv_gif_frame_cache_t lv_gif_frame_cache_t;
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -37,6 +39,7 @@ struct _lv_gif_t {
     lv_timer_t * timer;
     lv_image_dsc_t imgdsc;
     uint32_t last_call;
+    lv_gif_frame_cache_t * frame_cache;
 };
 
 
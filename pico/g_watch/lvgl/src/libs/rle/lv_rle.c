@@ -105,6 +105,48 @@ uint32_t lv_rle_decompress(const uint8_t * input,
     return wr_len;
 }
 
+uint32_t lv_rle_compress(const uint8_t * input,
+                         uint32_t input_buff_len, uint8_t * output,
+                         uint32_t output_buff_len, uint8_t blk_size)
+{
+    uint32_t blk_cnt = input_buff_len / blk_size;
+    uint32_t wr_len = 0;
+    uint32_t i = 0;
+
+    while(i < blk_cnt) {
+        /*Repeat the same block*/
+        uint32_t run = 1;
+        while(i + run < blk_cnt && run < 127 &&
+              lv_memcmp(input + (i + run) * blk_size, input + i * blk_size, blk_size) == 0) run++;
+
+        uint32_t bytes;
+        uint8_t ctrl_byte;
+        if(run > 1) {
+            ctrl_byte = run;
+            bytes = blk_size;
+        }
+        else {
+            /*Copy blocks directly until the next repeat*/
+            run = 1;
+            while(i + run < blk_cnt && run < 127 &&
+                  (i + run + 1 >= blk_cnt ||
+                   lv_memcmp(input + (i + run) * blk_size, input + (i + run + 1) * blk_size, blk_size) != 0)) run++;
+            ctrl_byte = 0x80 | run;
+            bytes = blk_size * run;
+        }
+
+        if(output) {
+            if(wr_len + 1 + bytes > output_buff_len) return 0;
+            output[wr_len] = ctrl_byte;
+            lv_memcpy(output + wr_len + 1, input + i * blk_size, bytes);
+        }
+        wr_len += 1 + bytes;
+        i += run;
+    }
+
+    return wr_len;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -33,6 +33,19 @@ uint32_t lv_rle_decompress(const uint8_t * input,
                            uint32_t input_buff_len, uint8_t * output,
                            uint32_t output_buff_len, uint8_t blk_size);
 
+/**
+ * Compress data to the format of `lv_rle_decompress()`
+ * @param input             the data to compress
+ * @param input_buff_len    size of the input in bytes, a multiple of `blk_size`
+ * @param output            buffer for the compressed data or NULL to get only the compressed size
+ * @param output_buff_len   size of `output` in bytes
+ * @param blk_size          size of the repeated blocks in bytes, e.g. 4 for ARGB8888 pixels
+ * @return                  size of the compressed data or 0 if it doesn't fit into `output`
+ */
+uint32_t lv_rle_compress(const uint8_t * input,
+                         uint32_t input_buff_len, uint8_t * output,
+                         uint32_t output_buff_len, uint8_t blk_size);
+
 /**********************
  *      MACROS
  **********************/
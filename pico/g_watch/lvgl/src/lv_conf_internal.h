@@ -481,6 +481,19 @@
         #endif
     #endif
 
+    /** Specialize the blend dispatch for RGB565 target layers.
+     *  RGB565 (and RGB565A8) layers are checked before the color format switch and call the RGB565
+     *  kernels directly; the switch has no RGB565 cases then.
+     *  Other layer formats (e.g. ARGB8888 intermediate layers) are still dispatched by the switch.
+     *  Useful on MCUs with a fixed 16-bit display. Requires `LV_DRAW_SW_SUPPORT_RGB565`. */
+    #ifndef LV_DRAW_SW_BLEND_SPECIALIZE_RGB565
+        #ifdef CONFIG_LV_DRAW_SW_BLEND_SPECIALIZE_RGB565
+            #define LV_DRAW_SW_BLEND_SPECIALIZE_RGB565 CONFIG_LV_DRAW_SW_BLEND_SPECIALIZE_RGB565
+        #else
+            #define LV_DRAW_SW_BLEND_SPECIALIZE_RGB565  0
+        #endif
+    #endif
+
     /** Set number of draw units.
      *  - > 1 requires operating system to be enabled in `LV_USE_OS`.
      *  - > 1 means multiple threads will render the screen in parallel. */
@@ -1202,6 +1215,28 @@
     #endif
 #endif
 
+/** Decode images which are slow to open (files, PNG/JPG etc. `RAW` images) in the background
+ *  and draw a placeholder until they are in the image cache. Requires `LV_CACHE_DEF_SIZE > 0`.
+ *  With `LV_USE_OS` a separate thread decodes the images, else one image is decoded
+ *  per timer period outside of rendering. Start it with `lv_image_decoder_async_set_enabled(true)`. */
+#ifndef LV_USE_IMAGE_DECODER_ASYNC
+    #ifdef CONFIG_LV_USE_IMAGE_DECODER_ASYNC
+        #define LV_USE_IMAGE_DECODER_ASYNC CONFIG_LV_USE_IMAGE_DECODER_ASYNC
+    #else
+        #define LV_USE_IMAGE_DECODER_ASYNC 0
+    #endif
+#endif
+#if LV_USE_IMAGE_DECODER_ASYNC
+    /** Stack size of the decoder thread */
+    #ifndef LV_IMAGE_DECODER_ASYNC_STACK_SIZE
+        #ifdef CONFIG_LV_IMAGE_DECODER_ASYNC_STACK_SIZE
+            #define LV_IMAGE_DECODER_ASYNC_STACK_SIZE CONFIG_LV_IMAGE_DECODER_ASYNC_STACK_SIZE
+        #else
+            #define LV_IMAGE_DECODER_ASYNC_STACK_SIZE (16 * 1024)
+        #endif
+    #endif
+#endif
+
 /** Number of stops allowed per gradient. Increase this to allow more stops.
  *  This adds (sizeof(lv_color_t) + 1) bytes per additional stop. */
 #ifndef LV_GRADIENT_MAX_STOPS
@@ -2056,6 +2091,18 @@
         #define LV_USE_CHART      1
     #endif
 #endif
+#if LV_USE_CHART
+    /** Max size of the buffer of a chart in `LV_CHART_UPDATE_MODE_STREAM` in bytes.
+     *  The buffer has the display's color format and covers the content area of the chart.
+     *  If a larger buffer would be needed the series are drawn as in `LV_CHART_UPDATE_MODE_SHIFT`. */
+    #ifndef LV_CHART_STREAM_BUF_MAX_SIZE
+        #ifdef CONFIG_LV_CHART_STREAM_BUF_MAX_SIZE
+            #define LV_CHART_STREAM_BUF_MAX_SIZE CONFIG_LV_CHART_STREAM_BUF_MAX_SIZE
+        #else
+            #define LV_CHART_STREAM_BUF_MAX_SIZE (32 * 1024)
+        #endif
+    #endif
+#endif
 
 #ifndef LV_USE_CHECKBOX
     #ifdef LV_KCONFIG_PRESENT
@@ -2379,6 +2426,18 @@
     #endif
 #endif
 
+#ifndef LV_USE_VLIST
+    #ifdef LV_KCONFIG_PRESENT
+        #ifdef CONFIG_LV_USE_VLIST
+            #define LV_USE_VLIST CONFIG_LV_USE_VLIST
+        #else
+            #define LV_USE_VLIST 0
+        #endif
+    #else
+        #define LV_USE_VLIST      1
+    #endif
+#endif
+
 #ifndef LV_USE_WIN
     #ifdef LV_KCONFIG_PRESENT
         #ifdef CONFIG_LV_USE_WIN
@@ -2514,6 +2573,33 @@
     #endif
 #endif
 
+/** Size of a block cache in bytes shared by all files of the drivers without `cache_size`.
+ *  Reads are served from fixed size blocks evicted in LRU order, sequential reads are read ahead
+ *  and `lv_fs_prefetch()` can load blocks in advance. 0: disable */
+#ifndef LV_FS_BLOCK_CACHE_SIZE
+    #ifdef CONFIG_LV_FS_BLOCK_CACHE_SIZE
+        #define LV_FS_BLOCK_CACHE_SIZE CONFIG_LV_FS_BLOCK_CACHE_SIZE
+    #else
+        #define LV_FS_BLOCK_CACHE_SIZE 0
+    #endif
+#endif
+#if LV_FS_BLOCK_CACHE_SIZE
+    #ifndef LV_FS_BLOCK_CACHE_BLOCK_SIZE
+        #ifdef CONFIG_LV_FS_BLOCK_CACHE_BLOCK_SIZE
+            #define LV_FS_BLOCK_CACHE_BLOCK_SIZE CONFIG_LV_FS_BLOCK_CACHE_BLOCK_SIZE
+        #else
+            #define LV_FS_BLOCK_CACHE_BLOCK_SIZE 512    /**< Size of a block in bytes */
+        #endif
+    #endif
+    #ifndef LV_FS_BLOCK_CACHE_READ_AHEAD
+        #ifdef CONFIG_LV_FS_BLOCK_CACHE_READ_AHEAD
+            #define LV_FS_BLOCK_CACHE_READ_AHEAD CONFIG_LV_FS_BLOCK_CACHE_READ_AHEAD
+        #else
+            #define LV_FS_BLOCK_CACHE_READ_AHEAD 4      /**< Max. number of blocks to read at once on sequential reads */
+        #endif
+    #endif
+#endif
+
 /** API for fopen, fread, etc. */
 #ifndef LV_USE_FS_STDIO
     #ifdef CONFIG_LV_USE_FS_STDIO
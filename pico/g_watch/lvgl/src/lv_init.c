@@ -11,6 +11,7 @@
 #include "misc/lv_profiler_builtin_private.h"
 #include "misc/lv_anim_private.h"
 #include "draw/lv_image_decoder_private.h"
+#include "draw/lv_image_decoder_async_private.h"
 #include "draw/lv_draw_buf_private.h"
 #include "core/lv_refr_private.h"
 #include "core/lv_obj_style_private.h"
@@ -257,6 +258,9 @@ void lv_init(void)
 
     lv_image_decoder_init(LV_CACHE_DEF_SIZE, LV_IMAGE_HEADER_CACHE_DEF_CNT);
     lv_bin_decoder_init();  /*LVGL built-in binary image decoder*/
+#if LV_USE_IMAGE_DECODER_ASYNC
+    lv_image_decoder_async_init();
+#endif
 
 #if LV_USE_DRAW_VG_LITE
     lv_draw_vg_lite_init();
@@ -402,6 +406,10 @@ void lv_deinit(void)
     lv_theme_mono_deinit();
 #endif
 
+#if LV_USE_IMAGE_DECODER_ASYNC
+    lv_image_decoder_async_deinit();
+#endif
+
     lv_image_decoder_deinit();
 
     lv_refr_deinit();
@@ -36,6 +36,7 @@ extern "C" {
 #include "draw/lv_draw_rect_private.h"
 #include "draw/lv_draw_image_private.h"
 #include "draw/lv_image_decoder_private.h"
+#include "draw/lv_image_decoder_async_private.h"
 #include "draw/lv_draw_label_private.h"
 #include "draw/lv_draw_vector_private.h"
 #include "draw/lv_draw_buf_private.h"
@@ -90,6 +91,7 @@ extern "C" {
 #include "widgets/led/lv_led_private.h"
 #include "widgets/arc/lv_arc_private.h"
 #include "widgets/tileview/lv_tileview_private.h"
+#include "widgets/vlist/lv_vlist_private.h"
 #include "widgets/spinbox/lv_spinbox_private.h"
 #include "widgets/span/lv_span_private.h"
 #include "widgets/label/lv_label_private.h"
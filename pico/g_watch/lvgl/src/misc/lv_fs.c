@@ -14,6 +14,12 @@
 #include "lv_ll.h"
 #include "../core/lv_global.h"
 
+#if LV_FS_BLOCK_CACHE_SIZE
+    #include "cache/lv_cache.h"
+    #include "lv_timer.h"
+    #include "../osal/lv_os.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -24,6 +30,16 @@
 
 #define fsdrv_ll_p &(LV_GLOBAL_DEFAULT()->fsdrv_ll)
 
+#if LV_FS_BLOCK_CACHE_SIZE
+#if LV_FS_BLOCK_CACHE_SIZE < 2 * LV_FS_BLOCK_CACHE_BLOCK_SIZE
+    #error "LV_FS_BLOCK_CACHE_SIZE needs to hold at least 2 blocks of LV_FS_BLOCK_CACHE_BLOCK_SIZE"
+#endif
+
+#define block_cache_p (LV_GLOBAL_DEFAULT()->fs_block_cache)
+#define BLOCK_SIZE      LV_FS_BLOCK_CACHE_BLOCK_SIZE
+#define BLOCK_CNT       (LV_FS_BLOCK_CACHE_SIZE / LV_FS_BLOCK_CACHE_BLOCK_SIZE)
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -32,6 +48,48 @@ typedef struct {
     const char * real_path;
 } resolved_path_t;
 
+#if LV_FS_BLOCK_CACHE_SIZE
+/*A node of the block cache*/
+typedef struct {
+    uint32_t file_id;
+    uint32_t block;
+    uint32_t size;          /*Number of valid bytes, less than `BLOCK_SIZE` only at the end of the file*/
+    uint8_t * data;
+} block_cache_data_t;
+
+/*A file which has (or had) blocks in the cache*/
+typedef struct {
+    char letter;
+    char * path;
+    uint32_t id;
+} block_cache_file_t;
+
+typedef struct {
+    char * path;
+    lv_fs_file_t file;      /*Opened at the first step*/
+    uint32_t pos;
+    uint32_t end;
+} prefetch_req_t;
+
+/*Passed to `block_create_cb()`*/
+typedef struct {
+    lv_fs_file_t * file_p;
+    uint32_t drv_pos;       /*The position of the driver if known, else UINT32_MAX*/
+    lv_fs_res_t res;
+    bool created;
+} block_read_ctx_t;
+
+typedef struct _lv_fs_block_cache_t {
+    lv_cache_t * cache;
+    lv_ll_t file_ll;        /*`block_cache_file_t`, the most recently opened first*/
+    lv_ll_t prefetch_ll;    /*`prefetch_req_t`*/
+    lv_timer_t * prefetch_timer;
+    lv_mutex_t lock;        /*Protects `file_ll`*/
+    uint32_t last_file_id;
+    lv_fs_block_cache_stats_t stats;
+} lv_fs_block_cache_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -39,6 +97,21 @@ static resolved_path_t lv_fs_resolve_path(const char * path);
 static lv_fs_res_t lv_fs_read_cached(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t * br);
 static lv_fs_res_t lv_fs_write_cached(lv_fs_file_t * file_p, const void * buf, uint32_t btw, uint32_t * bw);
 static lv_fs_res_t lv_fs_seek_cached(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whence);
+static lv_fs_res_t lv_fs_drv_read(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t * br);
+
+#if LV_FS_BLOCK_CACHE_SIZE
+    static void block_cache_init(void);
+    static void block_cache_deinit(void);
+    static bool block_cache_is_used(const lv_fs_drv_t * drv, lv_fs_mode_t mode);
+    static uint32_t block_cache_get_file_id(char letter, const char * path, bool renew);
+    static lv_fs_res_t lv_fs_read_blocks(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t * br);
+    static lv_cache_entry_t * block_acquire(block_read_ctx_t * ctx, uint32_t block);
+    static bool block_create_cb(block_cache_data_t * node, block_read_ctx_t * ctx);
+    static void block_free_cb(block_cache_data_t * node, void * user_data);
+    static lv_cache_compare_res_t block_compare_cb(const block_cache_data_t * lhs, const block_cache_data_t * rhs);
+    static void prefetch_timer_cb(lv_timer_t * t);
+    static void prefetch_req_delete(prefetch_req_t * req);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -55,10 +128,18 @@ static lv_fs_res_t lv_fs_seek_cached(lv_fs_file_t * file_p, uint32_t pos, lv_fs_
 void lv_fs_init(void)
 {
     lv_ll_init(fsdrv_ll_p, sizeof(lv_fs_drv_t *));
+
+#if LV_FS_BLOCK_CACHE_SIZE
+    block_cache_init();
+#endif
 }
 
 void lv_fs_deinit(void)
 {
+#if LV_FS_BLOCK_CACHE_SIZE
+    block_cache_deinit();
+#endif
+
     lv_ll_clear(fsdrv_ll_p);
 }
 
@@ -104,6 +185,7 @@ lv_fs_res_t lv_fs_open(lv_fs_file_t * file_p, const char * path, lv_fs_mode_t mo
     LV_PROFILER_FS_BEGIN;
 
     file_p->drv = drv;
+    file_p->cache = NULL;
 
     /* For memory-mapped files we set the file handle to our file descriptor so that we can access the cache from the file operations */
     if(drv->cache_size == LV_FS_CACHE_FROM_BUFFER) {
@@ -136,6 +218,28 @@ lv_fs_res_t lv_fs_open(lv_fs_file_t * file_p, const char * path, lv_fs_mode_t mo
             file_p->cache->end = UINT32_MAX - 1;
         }
     }
+#if LV_FS_BLOCK_CACHE_SIZE
+    else if(block_cache_is_used(drv, mode)) {
+        /*Only the position is tracked here, the data is in the shared blocks*/
+        file_p->cache = lv_malloc_zeroed(sizeof(lv_fs_file_cache_t));
+        LV_ASSERT_MALLOC(file_p->cache);
+        file_p->cache->start = UINT32_MAX;
+        file_p->cache->end = UINT32_MAX - 1;
+        file_p->cache->file_id = block_cache_get_file_id(drv->letter, resolved_path.real_path, false);
+        file_p->cache->last_block = UINT32_MAX;
+        file_p->cache->read_ahead = 1;
+
+        /*Out of memory: read without cache*/
+        if(file_p->cache->file_id == 0) {
+            lv_free(file_p->cache);
+            file_p->cache = NULL;
+        }
+    }
+    else if(mode & LV_FS_MODE_WR) {
+        /*The cached blocks become outdated*/
+        block_cache_get_file_id(drv->letter, resolved_path.real_path, true);
+    }
+#endif
 
     LV_PROFILER_FS_END;
 
@@ -165,7 +269,7 @@ lv_fs_res_t lv_fs_close(lv_fs_file_t * file_p)
 
     lv_fs_res_t res = file_p->drv->close_cb(file_p->drv, file_p->file_d);
 
-    if(file_p->drv->cache_size && file_p->cache) {
+    if(file_p->cache) {
         /* Only free cache if it was pre-allocated (for memory-mapped files it is never allocated) */
         if(file_p->drv->cache_size != LV_FS_CACHE_FROM_BUFFER && file_p->cache->buffer) {
             lv_free(file_p->cache->buffer);
@@ -188,7 +292,7 @@ lv_fs_res_t lv_fs_read(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t
     if(br != NULL) *br = 0;
     if(file_p->drv == NULL) return LV_FS_RES_INV_PARAM;
 
-    if(file_p->drv->cache_size) {
+    if(file_p->cache) {
         if(file_p->drv->read_cb == NULL || file_p->drv->seek_cb == NULL) return LV_FS_RES_NOT_IMP;
     }
     else {
@@ -200,11 +304,16 @@ lv_fs_res_t lv_fs_read(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t
     uint32_t br_tmp = 0;
     lv_fs_res_t res;
 
-    if(file_p->drv->cache_size) {
-        res = lv_fs_read_cached(file_p, buf, btr, &br_tmp);
+    if(file_p->cache == NULL) {
+        res = lv_fs_drv_read(file_p, buf, btr, &br_tmp);
     }
+#if LV_FS_BLOCK_CACHE_SIZE
+    else if(file_p->cache->file_id) {
+        res = lv_fs_read_blocks(file_p, buf, btr, &br_tmp);
+    }
+#endif
     else {
-        res = file_p->drv->read_cb(file_p->drv, file_p->file_d, buf, btr, &br_tmp);
+        res = lv_fs_read_cached(file_p, buf, btr, &br_tmp);
     }
 
     if(br != NULL) *br = br_tmp;
@@ -222,7 +331,7 @@ lv_fs_res_t lv_fs_write(lv_fs_file_t * file_p, const void * buf, uint32_t btw, u
         return LV_FS_RES_INV_PARAM;
     }
 
-    if(file_p->drv->cache_size) {
+    if(file_p->cache) {
         if(file_p->drv->write_cb == NULL || file_p->drv->seek_cb == NULL) return LV_FS_RES_NOT_IMP;
     }
     else {
@@ -233,7 +342,7 @@ lv_fs_res_t lv_fs_write(lv_fs_file_t * file_p, const void * buf, uint32_t btw, u
 
     lv_fs_res_t res;
     uint32_t bw_tmp = 0;
-    if(file_p->drv->cache_size) {
+    if(file_p->cache) {
         res = lv_fs_write_cached(file_p, buf, btw, &bw_tmp);
     }
     else {
@@ -251,7 +360,7 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
         return LV_FS_RES_INV_PARAM;
     }
 
-    if(file_p->drv->cache_size) {
+    if(file_p->cache) {
         if(file_p->drv->seek_cb == NULL || file_p->drv->tell_cb == NULL) return LV_FS_RES_NOT_IMP;
     }
     else {
@@ -261,7 +370,7 @@ lv_fs_res_t lv_fs_seek(lv_fs_file_t * file_p, uint32_t pos, lv_fs_whence_t whenc
     LV_PROFILER_FS_BEGIN;
 
     lv_fs_res_t res;
-    if(file_p->drv->cache_size) {
+    if(file_p->cache) {
         res = lv_fs_seek_cached(file_p, pos, whence);
     }
     else {
@@ -280,7 +389,7 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
         return LV_FS_RES_INV_PARAM;
     }
 
-    if(file_p->drv->cache_size == 0 && file_p->drv->tell_cb == NULL) {
+    if(file_p->cache == NULL && file_p->drv->tell_cb == NULL) {
         *pos = 0;
         return LV_FS_RES_NOT_IMP;
     }
@@ -288,7 +397,7 @@ lv_fs_res_t lv_fs_tell(lv_fs_file_t * file_p, uint32_t * pos)
     LV_PROFILER_FS_BEGIN;
 
     lv_fs_res_t res;
-    if(file_p->drv->cache_size) {
+    if(file_p->cache) {
         *pos = file_p->cache->file_position;
         res = LV_FS_RES_OK;
     }
@@ -497,6 +606,91 @@ const char * lv_fs_get_last(const char * path)
 
     return &path[i + 1];
 }
+
+#if LV_FS_BLOCK_CACHE_SIZE
+
+lv_fs_res_t lv_fs_prefetch(const char * path, uint32_t pos, uint32_t len)
+{
+    if(path == NULL) return LV_FS_RES_INV_PARAM;
+
+    resolved_path_t resolved_path = lv_fs_resolve_path(path);
+    lv_fs_drv_t * drv = lv_fs_get_drv(resolved_path.drive_letter);
+    if(drv == NULL) return LV_FS_RES_NOT_EX;
+    if(!block_cache_is_used(drv, LV_FS_MODE_RD)) return LV_FS_RES_NOT_IMP;
+    if(len == 0) return LV_FS_RES_OK;
+
+    lv_fs_block_cache_t * bc = block_cache_p;
+    prefetch_req_t * req = lv_ll_ins_tail(&bc->prefetch_ll);
+    LV_ASSERT_MALLOC(req);
+    if(req == NULL) return LV_FS_RES_OUT_OF_MEM;
+
+    lv_memzero(req, sizeof(prefetch_req_t));
+    req->path = lv_strdup(path);
+    LV_ASSERT_MALLOC(req->path);
+    if(req->path == NULL) {
+        lv_ll_remove(&bc->prefetch_ll, req);
+        lv_free(req);
+        return LV_FS_RES_OUT_OF_MEM;
+    }
+
+    req->pos = pos;
+    req->end = len > UINT32_MAX - pos ? UINT32_MAX : pos + len;
+
+    if(bc->prefetch_timer == NULL) {
+        bc->prefetch_timer = lv_timer_create(prefetch_timer_cb, LV_DEF_REFR_PERIOD, NULL);
+        LV_ASSERT_MALLOC(bc->prefetch_timer);
+    }
+    else {
+        lv_timer_resume(bc->prefetch_timer);
+    }
+
+    return LV_FS_RES_OK;
+}
+
+uint32_t lv_fs_prefetch_get_pending_count(void)
+{
+    return lv_ll_get_len(&block_cache_p->prefetch_ll);
+}
+
+void lv_fs_block_cache_drop(const char * path)
+{
+    lv_fs_block_cache_t * bc = block_cache_p;
+
+    if(path) {
+        /*The blocks of the old ID are not found anymore and will be evicted*/
+        resolved_path_t resolved_path = lv_fs_resolve_path(path);
+        block_cache_get_file_id(resolved_path.drive_letter, resolved_path.real_path, true);
+        return;
+    }
+
+    lv_cache_drop_all(bc->cache, NULL);
+
+    lv_mutex_lock(&bc->lock);
+    block_cache_file_t * file;
+    LV_LL_READ(&bc->file_ll, file) {
+        lv_free(file->path);
+    }
+    lv_ll_clear(&bc->file_ll);
+    lv_mutex_unlock(&bc->lock);
+}
+
+void lv_fs_block_cache_get_stats(lv_fs_block_cache_stats_t * stats)
+{
+    LV_ASSERT_NULL(stats);
+
+    *stats = block_cache_p->stats;
+
+    uint32_t total = stats->hit_cnt + stats->miss_cnt;
+    stats->hit_ratio = total ? (uint8_t)(((uint64_t)stats->hit_cnt * 100) / total) : 0;
+}
+
+void lv_fs_block_cache_reset_stats(void)
+{
+    lv_memzero(&block_cache_p->stats, sizeof(lv_fs_block_cache_stats_t));
+}
+
+#endif /*LV_FS_BLOCK_CACHE_SIZE*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -569,12 +763,12 @@ static lv_fs_res_t lv_fs_read_cached(lv_fs_file_t * file_p, void * buf, uint32_t
             uint32_t bytes_read_to_buffer = 0;
             if(btr - buffer_remaining_length > buffer_size) {
                 /*If remaining data chuck is bigger than buffer size, then do not use cache, instead read it directly from FS*/
-                res = file_p->drv->read_cb(file_p->drv, file_p->file_d, (char *)buf + buffer_remaining_length,
-                                           btr - buffer_remaining_length, &bytes_read_to_buffer);
+                res = lv_fs_drv_read(file_p, (char *)buf + buffer_remaining_length,
+                                     btr - buffer_remaining_length, &bytes_read_to_buffer);
             }
             else {
                 /*If remaining data chunk is smaller than buffer size, then read into cache buffer*/
-                res = file_p->drv->read_cb(file_p->drv, file_p->file_d, buffer, buffer_size, &bytes_read_to_buffer);
+                res = lv_fs_drv_read(file_p, buffer, buffer_size, &bytes_read_to_buffer);
                 file_p->cache->start = file_p->cache->end + 1;
                 file_p->cache->end = file_p->cache->start + bytes_read_to_buffer - 1;
 
@@ -591,7 +785,7 @@ static lv_fs_res_t lv_fs_read_cached(lv_fs_file_t * file_p, void * buf, uint32_t
         /*Data is not in cache buffer*/
         if(btr > buffer_size) {
             /*If bigger data is requested, then do not use cache, instead read it directly*/
-            res = file_p->drv->read_cb(file_p->drv, file_p->file_d, (void *)buf, btr, br);
+            res = lv_fs_drv_read(file_p, (void *)buf, btr, br);
         }
         else {
             /*If small data is requested, then read from FS into cache buffer*/
@@ -602,7 +796,7 @@ static lv_fs_res_t lv_fs_read_cached(lv_fs_file_t * file_p, void * buf, uint32_t
             }
 
             uint32_t bytes_read_to_buffer = 0;
-            res = file_p->drv->read_cb(file_p->drv, file_p->file_d, (void *)buffer, buffer_size, &bytes_read_to_buffer);
+            res = lv_fs_drv_read(file_p, (void *)buffer, buffer_size, &bytes_read_to_buffer);
             file_p->cache->start = file_position;
             file_p->cache->end = file_p->cache->start + bytes_read_to_buffer - 1;
 
@@ -692,3 +886,331 @@ static lv_fs_res_t lv_fs_seek_cached(lv_fs_file_t * file_p, uint32_t pos, lv_fs_
 
     return res;
 }
+
+static lv_fs_res_t lv_fs_drv_read(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    lv_fs_res_t res = file_p->drv->read_cb(file_p->drv, file_p->file_d, buf, btr, br);
+
+#if LV_FS_BLOCK_CACHE_SIZE
+    block_cache_p->stats.backing_read_cnt++;
+    if(res == LV_FS_RES_OK) block_cache_p->stats.backing_read_bytes += *br;
+#endif
+
+    return res;
+}
+
+#if LV_FS_BLOCK_CACHE_SIZE
+
+static void block_cache_init(void)
+{
+    lv_fs_block_cache_t * bc = lv_malloc_zeroed(sizeof(lv_fs_block_cache_t));
+    LV_ASSERT_MALLOC(bc);
+    block_cache_p = bc;
+
+    bc->cache = lv_cache_create(&lv_cache_class_lru_rb_count, sizeof(block_cache_data_t), BLOCK_CNT,
+    (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t)block_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)block_create_cb,
+        .free_cb = (lv_cache_free_cb_t)block_free_cb,
+    });
+    lv_cache_set_name(bc->cache, "FS_BLOCK");
+
+    lv_ll_init(&bc->file_ll, sizeof(block_cache_file_t));
+    lv_ll_init(&bc->prefetch_ll, sizeof(prefetch_req_t));
+    lv_mutex_init(&bc->lock);
+}
+
+static void block_cache_deinit(void)
+{
+    lv_fs_block_cache_t * bc = block_cache_p;
+    if(bc == NULL) return;
+
+    prefetch_req_t * req;
+    while((req = lv_ll_get_head(&bc->prefetch_ll)) != NULL) {
+        prefetch_req_delete(req);
+    }
+    if(bc->prefetch_timer) lv_timer_delete(bc->prefetch_timer);
+
+    lv_fs_block_cache_drop(NULL);
+    lv_cache_destroy(bc->cache, NULL);
+    lv_mutex_delete(&bc->lock);
+
+    lv_free(bc);
+    block_cache_p = NULL;
+}
+
+/**
+ * Tell whether the files of a driver are read through the block cache.
+ * Drivers with `cache_size` keep their own buffer for each file.
+ */
+static bool block_cache_is_used(const lv_fs_drv_t * drv, lv_fs_mode_t mode)
+{
+    if(mode != LV_FS_MODE_RD) return false;
+    if(drv->cache_size) return false;
+    return drv->read_cb && drv->seek_cb && drv->tell_cb;
+}
+
+/**
+ * Get the ID of a file under which its blocks are cached.
+ * @param letter    the driver letter
+ * @param path      path of the file without the driver letter
+ * @param renew     true: the file has changed, give it a new ID so that the old blocks are not used
+ * @return          the ID of the file, or 0 if `renew` is set and the file has no ID
+ */
+static uint32_t block_cache_get_file_id(char letter, const char * path, bool renew)
+{
+    lv_fs_block_cache_t * bc = block_cache_p;
+    uint32_t id = 0;
+
+    lv_mutex_lock(&bc->lock);
+
+    block_cache_file_t * file;
+    LV_LL_READ(&bc->file_ll, file) {
+        if(file->letter == letter && lv_strcmp(file->path, path) == 0) break;
+    }
+
+    if(file == NULL && renew == false) {
+        /*A file not in the table can't have blocks, so forget the least recently opened one*/
+        if(lv_ll_get_len(&bc->file_ll) >= BLOCK_CNT) {
+            block_cache_file_t * tail = lv_ll_get_tail(&bc->file_ll);
+            lv_free(tail->path);
+            lv_ll_remove(&bc->file_ll, tail);
+            lv_free(tail);
+        }
+
+        file = lv_ll_ins_head(&bc->file_ll);
+        LV_ASSERT_MALLOC(file);
+        if(file) {
+            file->letter = letter;
+            file->path = lv_strdup(path);
+            LV_ASSERT_MALLOC(file->path);
+            renew = true;
+        }
+    }
+    else if(file) {
+        lv_ll_move_before(&bc->file_ll, file, lv_ll_get_head(&bc->file_ll));
+    }
+
+    if(file) {
+        if(renew) {
+            bc->last_file_id++;
+            if(bc->last_file_id == 0) bc->last_file_id++;
+            file->id = bc->last_file_id;
+        }
+        id = file->id;
+    }
+
+    lv_mutex_unlock(&bc->lock);
+
+    return id;
+}
+
+static lv_fs_res_t lv_fs_read_blocks(lv_fs_file_t * file_p, void * buf, uint32_t btr, uint32_t * br)
+{
+    lv_fs_block_cache_t * bc = block_cache_p;
+    lv_fs_file_cache_t * fc = file_p->cache;
+    lv_fs_res_t res;
+
+    *br = 0;
+
+    /*Large reads would only evict the blocks of the other files*/
+    if(btr > LV_FS_BLOCK_CACHE_SIZE / 2) {
+        res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, fc->file_position, LV_FS_SEEK_SET);
+        if(res == LV_FS_RES_OK) res = lv_fs_drv_read(file_p, buf, btr, br);
+        if(res == LV_FS_RES_OK) fc->file_position += *br;
+        return res;
+    }
+
+    block_read_ctx_t ctx;
+    ctx.file_p = file_p;
+    ctx.drv_pos = UINT32_MAX;
+    ctx.res = LV_FS_RES_OK;
+
+    uint8_t * dst = buf;
+    while(btr > 0) {
+        uint32_t block = fc->file_position / BLOCK_SIZE;
+        uint32_t offset = fc->file_position % BLOCK_SIZE;
+
+        ctx.created = false;
+        lv_cache_entry_t * entry = block_acquire(&ctx, block);
+        if(entry == NULL) break;
+
+        bool missed = ctx.created;
+        if(missed) bc->stats.miss_cnt++;
+        else bc->stats.hit_cnt++;
+
+        if(missed) {
+            /*Read more blocks at once while the file is read sequentially*/
+            if(block == fc->last_block + 1) fc->read_ahead = LV_MIN(fc->read_ahead * 2, LV_FS_BLOCK_CACHE_READ_AHEAD);
+            else fc->read_ahead = 1;
+        }
+        fc->last_block = block;
+
+        block_cache_data_t * data = lv_cache_entry_get_data(entry);
+        uint32_t len = offset < data->size ? LV_MIN(btr, data->size - offset) : 0;
+        lv_memcpy(dst, data->data + offset, len);
+        bool eof = data->size < BLOCK_SIZE;
+        lv_cache_release(bc->cache, entry, NULL);
+
+        dst += len;
+        btr -= len;
+        *br += len;
+        fc->file_position += len;
+
+        if(eof) break;
+
+        if(missed) {
+            uint32_t i;
+            for(i = 1; i < fc->read_ahead; i++) {
+                block_cache_data_t search_key;
+                search_key.file_id = fc->file_id;
+                search_key.block = block + i;
+                entry = lv_cache_acquire(bc->cache, &search_key, NULL);
+                /*The next blocks are probably cached too*/
+                if(entry) {
+                    lv_cache_release(bc->cache, entry, NULL);
+                    break;
+                }
+
+                ctx.created = false;
+                entry = block_acquire(&ctx, block + i);
+                if(entry == NULL) break;
+
+                if(ctx.created) bc->stats.read_ahead_cnt++;
+                data = lv_cache_entry_get_data(entry);
+                eof = data->size < BLOCK_SIZE;
+                lv_cache_release(bc->cache, entry, NULL);
+                if(eof) break;
+            }
+        }
+    }
+
+    return *br > 0 ? LV_FS_RES_OK : ctx.res;
+}
+
+/**
+ * Get a block from the cache or read it from the driver.
+ * `ctx->created` is set if the block was read.
+ */
+static lv_cache_entry_t * block_acquire(block_read_ctx_t * ctx, uint32_t block)
+{
+    block_cache_data_t search_key;
+    search_key.file_id = ctx->file_p->cache->file_id;
+    search_key.block = block;
+
+    return lv_cache_acquire_or_create(block_cache_p->cache, &search_key, ctx);
+}
+
+static bool block_create_cb(block_cache_data_t * node, block_read_ctx_t * ctx)
+{
+    lv_fs_file_t * file_p = ctx->file_p;
+    uint32_t pos = node->block * BLOCK_SIZE;
+
+    if(ctx->drv_pos != pos) {
+        ctx->res = file_p->drv->seek_cb(file_p->drv, file_p->file_d, pos, LV_FS_SEEK_SET);
+        if(ctx->res != LV_FS_RES_OK) {
+            ctx->drv_pos = UINT32_MAX;
+            return false;
+        }
+    }
+
+    node->data = lv_malloc(BLOCK_SIZE);
+    LV_ASSERT_MALLOC(node->data);
+    if(node->data == NULL) {
+        ctx->res = LV_FS_RES_OUT_OF_MEM;
+        ctx->drv_pos = UINT32_MAX;
+        return false;
+    }
+
+    uint32_t br = 0;
+    ctx->res = lv_fs_drv_read(file_p, node->data, BLOCK_SIZE, &br);
+    /*Nothing to cache after the end of the file*/
+    if(ctx->res != LV_FS_RES_OK || br == 0) {
+        lv_free(node->data);
+        ctx->drv_pos = UINT32_MAX;
+        return false;
+    }
+
+    node->size = br;
+    ctx->drv_pos = pos + br;
+    ctx->created = true;
+
+    return true;
+}
+
+static void block_free_cb(block_cache_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(node->data);
+}
+
+static lv_cache_compare_res_t block_compare_cb(const block_cache_data_t * lhs, const block_cache_data_t * rhs)
+{
+    if(lhs->file_id != rhs->file_id) return lhs->file_id > rhs->file_id ? 1 : -1;
+    if(lhs->block != rhs->block) return lhs->block > rhs->block ? 1 : -1;
+    return 0;
+}
+
+static void prefetch_timer_cb(lv_timer_t * t)
+{
+    lv_fs_block_cache_t * bc = block_cache_p;
+
+    prefetch_req_t * req = lv_ll_get_head(&bc->prefetch_ll);
+    if(req == NULL) {
+        lv_timer_pause(t);
+        return;
+    }
+
+    bool done = false;
+    if(req->file.drv == NULL) {
+        lv_fs_res_t res = lv_fs_open(&req->file, req->path, LV_FS_MODE_RD);
+        if(res != LV_FS_RES_OK) {
+            LV_LOG_WARN("Can't prefetch %s: %d", req->path, res);
+            req->file.drv = NULL;
+            done = true;
+        }
+    }
+
+    if(!done) {
+        block_read_ctx_t ctx;
+        ctx.file_p = &req->file;
+        ctx.drv_pos = UINT32_MAX;
+        ctx.res = LV_FS_RES_OK;
+
+        /*Read only a few blocks at once to not block the UI for long*/
+        uint32_t i;
+        for(i = 0; i < LV_FS_BLOCK_CACHE_READ_AHEAD && !done; i++) {
+            uint32_t block = req->pos / BLOCK_SIZE;
+
+            ctx.created = false;
+            lv_cache_entry_t * entry = block_acquire(&ctx, block);
+            if(entry == NULL) {
+                done = true;
+                break;
+            }
+
+            if(ctx.created) bc->stats.prefetch_cnt++;
+
+            block_cache_data_t * data = lv_cache_entry_get_data(entry);
+            if(data->size < BLOCK_SIZE) done = true;
+            lv_cache_release(bc->cache, entry, NULL);
+
+            req->pos = (block + 1) * BLOCK_SIZE;
+            if(req->pos >= req->end || req->pos < block * BLOCK_SIZE) done = true;
+        }
+    }
+
+    if(done) prefetch_req_delete(req);
+}
+
+static void prefetch_req_delete(prefetch_req_t * req)
+{
+    lv_fs_block_cache_t * bc = block_cache_p;
+
+    if(req->file.drv) lv_fs_close(&req->file);
+    lv_free(req->path);
+    lv_ll_remove(&bc->prefetch_ll, req);
+    lv_free(req);
+}
+
+#endif /*LV_FS_BLOCK_CACHE_SIZE*/
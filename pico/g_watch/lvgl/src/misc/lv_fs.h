@@ -97,6 +97,21 @@ typedef struct {
     lv_fs_drv_t * drv;
 } lv_fs_dir_t;
 
+#if LV_FS_BLOCK_CACHE_SIZE
+/**
+ * Statistics of the shared block cache, counted since `lv_init()` or `lv_fs_block_cache_reset_stats()`.
+ */
+typedef struct {
+    uint32_t hit_cnt;               /**< Blocks read from the cache*/
+    uint32_t miss_cnt;              /**< Blocks read from the driver because they were not in the cache*/
+    uint32_t read_ahead_cnt;        /**< Blocks read from the driver ahead of sequential reads*/
+    uint32_t prefetch_cnt;          /**< Blocks read from the driver by `lv_fs_prefetch()`*/
+    uint32_t backing_read_cnt;      /**< Number of read calls of the drivers*/
+    uint32_t backing_read_bytes;    /**< Bytes read by the drivers, including reads not going through the cache*/
+    uint8_t hit_ratio;              /**< `hit_cnt` in percentage of all the blocks read*/
+} lv_fs_block_cache_stats_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
@@ -247,6 +262,45 @@ char * lv_fs_up(char * path);
  */
 const char * lv_fs_get_last(const char * path);
 
+#if LV_FS_BLOCK_CACHE_SIZE
+
+/**
+ * Read a part of a file into the block cache in the background, e.g. an image or font
+ * which will be used soon. The blocks are read in small steps from `lv_timer_handler()`.
+ * Only the files of drivers without `cache_size` are cached.
+ * @param path      path to the file beginning with the driver letter (e.g. S:/folder/file.txt)
+ * @param pos       start of the range in bytes
+ * @param len       length of the range in bytes, `UINT32_MAX` to read until the end of the file
+ * @return          LV_FS_RES_OK: the range is queued; LV_FS_RES_NOT_IMP: the driver doesn't use
+ *                  the block cache; any other error from lv_fs_res_t enum
+ */
+lv_fs_res_t lv_fs_prefetch(const char * path, uint32_t pos, uint32_t len);
+
+/**
+ * Get the number of prefetch requests which are not finished yet.
+ * @return          number of pending requests
+ */
+uint32_t lv_fs_prefetch_get_pending_count(void);
+
+/**
+ * Drop the cached blocks of a file. Files opened for writing are dropped automatically.
+ * @param path      path to the file beginning with the driver letter, or NULL to drop all the blocks
+ */
+void lv_fs_block_cache_drop(const char * path);
+
+/**
+ * Get the statistics of the block cache
+ * @param stats     pointer to a variable to store the statistics
+ */
+void lv_fs_block_cache_get_stats(lv_fs_block_cache_stats_t * stats);
+
+/**
+ * Reset the statistics of the block cache
+ */
+void lv_fs_block_cache_reset_stats(void);
+
+#endif /*LV_FS_BLOCK_CACHE_SIZE*/
+
 /**********************
  *      MACROS
  **********************/
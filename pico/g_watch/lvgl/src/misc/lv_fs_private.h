@@ -29,6 +29,11 @@ struct _lv_fs_file_cache_t {
     uint32_t end;
     uint32_t file_position;
     void * buffer;
+#if LV_FS_BLOCK_CACHE_SIZE
+    uint32_t file_id;       /**< ID of the file in the shared block cache, 0: not in the block cache*/
+    uint32_t last_block;    /**< The last block read, to detect sequential reads*/
+    uint32_t read_ahead;    /**< Number of blocks to read at the next miss of a sequential read*/
+#endif
 };
 
 /** Extended path object to specify buffer for memory-mapped files */
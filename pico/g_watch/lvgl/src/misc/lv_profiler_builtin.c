@@ -22,6 +22,20 @@
 #define LV_PROFILER_STR_MAX_LEN 128
 #define LV_PROFILER_TICK_PER_SEC_MAX 1000000
 
+/*Maximum number of different tags which can be recorded. Must be a power of 2.*/
+#ifndef LV_PROFILER_BUILTIN_TAG_MAX
+    #define LV_PROFILER_BUILTIN_TAG_MAX 256
+#endif
+
+#define LV_PROFILER_TAG_HASH_SIZE (LV_PROFILER_BUILTIN_TAG_MAX * 2)
+#define LV_PROFILER_TAG_ID_INVALID 0xFFFF
+
+/*Binary stream format, see `flush_bin_no_lock()`*/
+#define LV_PROFILER_BIN_VERSION 1
+#define LV_PROFILER_BIN_HEADER_SIZE 16
+#define LV_PROFILER_BIN_CHUNK_STR 'S'
+#define LV_PROFILER_BIN_CHUNK_ITEMS 'I'
+
 #if LV_USE_OS
     #define LV_PROFILER_MULTEX_INIT   lv_mutex_init(&profiler_ctx->mutex)
     #define LV_PROFILER_MULTEX_DEINIT lv_mutex_delete(&profiler_ctx->mutex)
@@ -39,15 +53,17 @@
  **********************/
 
 /**
- * @brief Structure representing a built-in profiler item in LVGL
+ * @brief Structure representing a built-in profiler item in LVGL.
+ * It is also the record format of the binary output, so keep it packed without padding:
+ * 8 bytes without OS, 12 bytes with OS.
  */
 typedef struct {
-    char tag;          /**< The tag of the profiler item */
     uint32_t tick;     /**< The tick value of the profiler item */
-    const char * func; /**< A pointer to the function associated with the profiler item */
+    uint16_t tag_id;   /**< Index of the interned function name or tag */
+    char tag;          /**< The tag of the profiler item ('B' or 'E') */
+    uint8_t cpu;       /**< The CPU ID of the profiler item */
 #if LV_USE_OS
-    int tid;           /**< The thread ID of the profiler item */
-    int cpu;         /**< The CPU ID of the profiler item */
+    int32_t tid;       /**< The thread ID of the profiler item */
 #endif
 } lv_profiler_builtin_item_t;
 
@@ -59,6 +75,11 @@ typedef struct _lv_profiler_builtin_ctx_t {
     uint32_t item_num;                     /**< Number of profiler items in the array */
     uint32_t cur_index;                    /**< Index of the current profiler item */
     lv_profiler_builtin_config_t config;   /**< Configuration for the built-in profiler */
+    const char ** tag_arr;                 /**< Interned function names and tags, indexed by tag ID */
+    uint16_t * tag_hash;                   /**< Hash of the tag pointers, stores tag ID + 1, 0 is empty */
+    uint32_t tag_num;                      /**< Number of interned tags */
+    uint32_t tag_flushed;                  /**< Number of tags already written to the binary output */
+    bool bin_header_flushed;               /**< Whether the binary header is already written */
     bool enable;                           /**< Whether the built-in profiler is enabled */
 #if LV_USE_OS
     lv_mutex_t mutex;                      /**< Mutex to protect the built-in profiler */
@@ -73,6 +94,10 @@ static void default_flush_cb(const char * buf);
 static int default_tid_get_cb(void);
 static int default_cpu_get_cb(void);
 static void flush_no_lock(void);
+static void flush_bin_no_lock(void);
+static uint16_t tag_intern(const char * func);
+static void put_u16(uint8_t * buf, uint16_t v);
+static void put_u32(uint8_t * buf, uint32_t v);
 
 /**********************
  *  STATIC VARIABLES
@@ -123,8 +148,15 @@ void lv_profiler_builtin_init(const lv_profiler_builtin_config_t * config)
     LV_ASSERT_MALLOC(profiler_ctx);
 
     profiler_ctx->item_arr = lv_malloc(num * sizeof(lv_profiler_builtin_item_t));
+    profiler_ctx->tag_arr = lv_malloc(LV_PROFILER_BUILTIN_TAG_MAX * sizeof(const char *));
+    profiler_ctx->tag_hash = lv_malloc_zeroed(LV_PROFILER_TAG_HASH_SIZE * sizeof(uint16_t));
     LV_ASSERT_MALLOC(profiler_ctx->item_arr);
-    if(profiler_ctx->item_arr == NULL) {
+    LV_ASSERT_MALLOC(profiler_ctx->tag_arr);
+    LV_ASSERT_MALLOC(profiler_ctx->tag_hash);
+    if(profiler_ctx->item_arr == NULL || profiler_ctx->tag_arr == NULL || profiler_ctx->tag_hash == NULL) {
+        lv_free(profiler_ctx->item_arr);
+        lv_free(profiler_ctx->tag_arr);
+        lv_free(profiler_ctx->tag_hash);
         lv_free(profiler_ctx);
         profiler_ctx = NULL;
         LV_LOG_ERROR("malloc failed for item_arr");
@@ -135,7 +167,7 @@ void lv_profiler_builtin_init(const lv_profiler_builtin_config_t * config)
     profiler_ctx->item_num = num;
     profiler_ctx->config = *config;
 
-    if(profiler_ctx->config.flush_cb) {
+    if(profiler_ctx->config.flush_cb && !profiler_ctx->config.flush_bin_cb) {
         /* add profiler header for perfetto */
         profiler_ctx->config.flush_cb("# tracer: nop\n");
         profiler_ctx->config.flush_cb("#\n");
@@ -151,6 +183,8 @@ void lv_profiler_builtin_uninit(void)
     LV_ASSERT_NULL(profiler_ctx);
     LV_PROFILER_MULTEX_DEINIT;
     lv_free(profiler_ctx->item_arr);
+    lv_free(profiler_ctx->tag_arr);
+    lv_free(profiler_ctx->tag_hash);
     lv_free(profiler_ctx);
     profiler_ctx = NULL;
 }
@@ -170,6 +204,7 @@ void lv_profiler_builtin_flush(void)
 
     LV_PROFILER_MULTEX_LOCK;
     flush_no_lock();
+    profiler_ctx->cur_index = 0;
     LV_PROFILER_MULTEX_UNLOCK;
 }
 
@@ -190,13 +225,15 @@ void lv_profiler_builtin_write(const char * func, char tag)
     }
 
     lv_profiler_builtin_item_t * item = &profiler_ctx->item_arr[profiler_ctx->cur_index];
-    item->func = func;
+    item->tag_id = tag_intern(func);
     item->tag = tag;
     item->tick = profiler_ctx->config.tick_get_cb();
 
 #if LV_USE_OS
     item->tid = profiler_ctx->config.tid_get_cb();
-    item->cpu = profiler_ctx->config.cpu_get_cb();
+    item->cpu = (uint8_t)profiler_ctx->config.cpu_get_cb();
+#else
+    item->cpu = 0;
 #endif
 
     profiler_ctx->cur_index++;
@@ -225,6 +262,11 @@ static int default_cpu_get_cb(void)
 
 static void flush_no_lock(void)
 {
+    if(profiler_ctx->config.flush_bin_cb) {
+        flush_bin_no_lock();
+        return;
+    }
+
     if(!profiler_ctx->config.flush_cb) {
         LV_LOG_WARN("flush_cb is not registered");
         return;
@@ -237,6 +279,7 @@ static void flush_no_lock(void)
         lv_profiler_builtin_item_t * item = &profiler_ctx->item_arr[cur++];
         uint32_t sec = item->tick / tick_per_sec;
         uint32_t usec = (item->tick % tick_per_sec) * (LV_PROFILER_TICK_PER_SEC_MAX / tick_per_sec);
+        const char * func = item->tag_id < profiler_ctx->tag_num ? profiler_ctx->tag_arr[item->tag_id] : "unknown";
 
 #if LV_USE_OS
         lv_snprintf(buf, sizeof(buf),
@@ -246,17 +289,109 @@ static void flush_no_lock(void)
                     sec,
                     usec,
                     item->tag,
-                    item->func);
+                    func);
 #else
         lv_snprintf(buf, sizeof(buf),
                     "   LVGL-1 [0] %" LV_PRIu32 ".%06" LV_PRIu32 ": tracing_mark_write: %c|1|%s\n",
                     sec,
                     usec,
                     item->tag,
-                    item->func);
+                    func);
 #endif
         profiler_ctx->config.flush_cb(buf);
     }
 }
 
+/**
+ * Write the recorded items as a binary stream. All fields are little-endian.
+ *
+ * The stream starts with a 16 byte header (only once after init):
+ *   char magic[4] = "LVPF", uint8_t version, uint8_t item_size, uint16_t reserved,
+ *   uint32_t tick_per_sec, uint32_t reserved
+ * followed by chunks which start with a one byte type:
+ *   'S': uint8_t reserved, uint16_t tag_id, uint16_t len, char name[len]
+ *        Sent once for each new tag, before the first item referring to it.
+ *   'I': uint8_t reserved, uint16_t reserved, uint32_t count, item[count]
+ *        `item` is `lv_profiler_builtin_item_t` as is: uint32_t tick, uint16_t tag_id,
+ *        char tag, uint8_t cpu and, if `item_size` is 12, int32_t tid.
+ */
+static void flush_bin_no_lock(void)
+{
+    void (*flush_bin_cb)(const void * buf, uint32_t size) = profiler_ctx->config.flush_bin_cb;
+    uint8_t buf[LV_PROFILER_BIN_HEADER_SIZE];
+
+    if(!profiler_ctx->bin_header_flushed) {
+        lv_memzero(buf, sizeof(buf));
+        lv_memcpy(buf, "LVPF", 4);
+        buf[4] = LV_PROFILER_BIN_VERSION;
+        buf[5] = sizeof(lv_profiler_builtin_item_t);
+        put_u32(&buf[8], profiler_ctx->config.tick_per_sec);
+        flush_bin_cb(buf, LV_PROFILER_BIN_HEADER_SIZE);
+        profiler_ctx->bin_header_flushed = true;
+    }
+
+    while(profiler_ctx->tag_flushed < profiler_ctx->tag_num) {
+        const char * name = profiler_ctx->tag_arr[profiler_ctx->tag_flushed];
+        size_t len = lv_strlen(name);
+        if(len > UINT16_MAX) len = UINT16_MAX;
+
+        buf[0] = LV_PROFILER_BIN_CHUNK_STR;
+        buf[1] = 0;
+        put_u16(&buf[2], (uint16_t)profiler_ctx->tag_flushed);
+        put_u16(&buf[4], (uint16_t)len);
+        flush_bin_cb(buf, 6);
+        flush_bin_cb(name, (uint32_t)len);
+        profiler_ctx->tag_flushed++;
+    }
+
+    if(profiler_ctx->cur_index == 0) return;
+
+    buf[0] = LV_PROFILER_BIN_CHUNK_ITEMS;
+    buf[1] = 0;
+    put_u16(&buf[2], 0);
+    put_u32(&buf[4], profiler_ctx->cur_index);
+    flush_bin_cb(buf, 8);
+    flush_bin_cb(profiler_ctx->item_arr, profiler_ctx->cur_index * sizeof(lv_profiler_builtin_item_t));
+}
+
+/**
+ * Get the ID of a function name or tag. The strings are identified by their address
+ * so it's only a hash lookup on the hot path and the string is copied only when flushing.
+ */
+static uint16_t tag_intern(const char * func)
+{
+    uint32_t mask = LV_PROFILER_TAG_HASH_SIZE - 1;
+    uint32_t i = (uint32_t)(((lv_uintptr_t)func >> 2) * 2654435761u) & mask;
+
+    while(profiler_ctx->tag_hash[i] != 0) {
+        uint16_t id = profiler_ctx->tag_hash[i] - 1;
+        if(profiler_ctx->tag_arr[id] == func) return id;
+        i = (i + 1) & mask;
+    }
+
+    if(profiler_ctx->tag_num >= LV_PROFILER_BUILTIN_TAG_MAX) {
+        return LV_PROFILER_TAG_ID_INVALID;
+    }
+
+    uint16_t id = (uint16_t)profiler_ctx->tag_num;
+    profiler_ctx->tag_arr[id] = func;
+    profiler_ctx->tag_hash[i] = id + 1;
+    profiler_ctx->tag_num++;
+    return id;
+}
+
+static void put_u16(uint8_t * buf, uint16_t v)
+{
+    buf[0] = (uint8_t)v;
+    buf[1] = (uint8_t)(v >> 8);
+}
+
+static void put_u32(uint8_t * buf, uint32_t v)
+{
+    buf[0] = (uint8_t)v;
+    buf[1] = (uint8_t)(v >> 8);
+    buf[2] = (uint8_t)(v >> 16);
+    buf[3] = (uint8_t)(v >> 24);
+}
+
 #endif /*LV_USE_PROFILER_BUILTIN*/
@@ -36,6 +36,13 @@ struct _lv_profiler_builtin_config_t {
     void (*flush_cb)(const char * buf); /**< Callback function to flush the profiling data */
     int (*tid_get_cb)(void);            /**< Callback function to get the current thread ID */
     int (*cpu_get_cb)(void);            /**< Callback function to get the current CPU */
+
+    /**
+     * Callback function to flush the profiling data in binary form.
+     * If set, it is used instead of `flush_cb` and the records are not formatted on the target.
+     * Use `scripts/profiler_bin_to_json.py` to convert the captured stream to a Chrome trace.
+     */
+    void (*flush_bin_cb)(const void * buf, uint32_t size);
 };
 
 
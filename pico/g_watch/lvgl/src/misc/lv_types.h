@@ -251,6 +251,8 @@ typedef struct _lv_tileview_t lv_tileview_t;
 
 typedef struct _lv_tileview_tile_t lv_tileview_tile_t;
 
+typedef struct _lv_vlist_t lv_vlist_t;
+
 typedef struct _lv_win_t lv_win_t;
 
 typedef struct _lv_observer_t lv_observer_t;
@@ -14,6 +14,8 @@
 #if LV_USE_CHART != 0
 
 #include "../../misc/lv_assert.h"
+#include "../../core/lv_refr_private.h"
+#include "../../misc/cache/lv_image_cache.h"
 
 /*********************
  *      DEFINES
@@ -43,6 +45,12 @@ static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer);
 static void draw_cursors(lv_obj_t * obj, lv_layer_t * layer);
 static uint32_t get_index_from_x(lv_obj_t * obj, int32_t x);
 static void invalidate_point(lv_obj_t * obj, uint32_t i);
+static void stream_invalidate(lv_obj_t * obj);
+static void stream_invalidate_next(lv_obj_t * obj, lv_chart_series_t * ser);
+static int32_t stream_get_point_step(lv_obj_t * obj);
+static void stream_drop_buf(lv_obj_t * obj);
+static void stream_refr_start_cb(lv_event_t * e);
+static void draw_series_stream(lv_obj_t * obj, lv_layer_t * layer);
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, int32_t ** a);
 
 /**********************
@@ -169,7 +177,8 @@ void lv_chart_set_update_mode(lv_obj_t * obj, lv_chart_update_mode_t update_mode
     if(chart->update_mode == update_mode) return;
 
     chart->update_mode = update_mode;
-    lv_obj_invalidate(obj);
+    if(update_mode != LV_CHART_UPDATE_MODE_STREAM) stream_drop_buf(obj);
+    lv_chart_refresh(obj);
 }
 
 void lv_chart_set_div_line_count(lv_obj_t * obj, uint8_t hdiv, uint8_t vdiv)
@@ -271,7 +280,7 @@ void lv_chart_get_point_pos_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint3
     p_out->x += lv_obj_get_style_pad_left(obj, LV_PART_MAIN) + border_width;
     p_out->x -= lv_obj_get_scroll_left(obj);
 
-    uint32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+    uint32_t start_point = chart->update_mode != LV_CHART_UPDATE_MODE_CIRCULAR ? ser->start_point : 0;
     id = ((int32_t)start_point + id) % chart->point_cnt;
     int32_t temp_y = 0;
     temp_y = (int32_t)((int32_t)ser->y_points[id] - chart->ymin[ser->y_axis_sec]) * h;
@@ -285,6 +294,7 @@ void lv_chart_refresh(lv_obj_t * obj)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    stream_invalidate(obj);
     lv_obj_invalidate(obj);
 }
 
@@ -351,6 +361,7 @@ lv_chart_series_t * lv_chart_add_series(lv_obj_t * obj, lv_color_t color, lv_cha
         p_tmp++;
     }
 
+    stream_invalidate(obj);
     return ser;
 }
 
@@ -366,6 +377,7 @@ void lv_chart_remove_series(lv_obj_t * obj, lv_chart_series_t * series)
     lv_ll_remove(&chart->series_ll, series);
     lv_free(series);
 
+    stream_invalidate(obj);
     return;
 }
 
@@ -404,6 +416,7 @@ void lv_chart_set_x_start_point(lv_obj_t * obj, lv_chart_series_t * ser, uint32_
     lv_chart_t * chart  = (lv_chart_t *)obj;
     if(id >= chart->point_cnt) return;
     ser->start_point = id;
+    stream_invalidate(obj);
 }
 
 lv_chart_series_t * lv_chart_get_series_next(const lv_obj_t * obj, const lv_chart_series_t * ser)
@@ -492,6 +505,13 @@ void lv_chart_set_next_value(lv_obj_t * obj, lv_chart_series_t * ser, int32_t va
 
     lv_chart_t * chart  = (lv_chart_t *)obj;
     ser->y_points[ser->start_point] = value;
+
+    if(chart->update_mode == LV_CHART_UPDATE_MODE_STREAM) {
+        ser->start_point = (ser->start_point + 1) % chart->point_cnt;
+        stream_invalidate_next(obj, ser);
+        return;
+    }
+
     invalidate_point(obj, ser->start_point);
     ser->start_point = (ser->start_point + 1) % chart->point_cnt;
     invalidate_point(obj, ser->start_point);
@@ -523,6 +543,7 @@ void lv_chart_set_value_by_id(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t
 
     if(id >= chart->point_cnt) return;
     ser->y_points[id] = value;
+    stream_invalidate(obj);
     invalidate_point(obj, id);
 }
 
@@ -552,7 +573,7 @@ void lv_chart_set_ext_y_array(lv_obj_t * obj, lv_chart_series_t * ser, int32_t a
     if(!ser->y_ext_buf_assigned && ser->y_points) lv_free(ser->y_points);
     ser->y_ext_buf_assigned = true;
     ser->y_points = array;
-    lv_obj_invalidate(obj);
+    lv_chart_refresh(obj);
 }
 
 void lv_chart_set_ext_x_array(lv_obj_t * obj, lv_chart_series_t * ser, int32_t array[])
@@ -563,7 +584,7 @@ void lv_chart_set_ext_x_array(lv_obj_t * obj, lv_chart_series_t * ser, int32_t a
     if(!ser->x_ext_buf_assigned && ser->x_points) lv_free(ser->x_points);
     ser->x_ext_buf_assigned = true;
     ser->x_points = array;
-    lv_obj_invalidate(obj);
+    lv_chart_refresh(obj);
 }
 
 int32_t * lv_chart_get_y_array(const lv_obj_t * obj, lv_chart_series_t * ser)
@@ -666,6 +687,8 @@ static void lv_chart_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     }
     lv_ll_clear(&chart->cursor_ll);
 
+    stream_drop_buf(obj);
+
     LV_TRACE_OBJ_CREATE("finished");
 }
 
@@ -701,12 +724,17 @@ static void lv_chart_event(const lv_obj_class_t * class_p, lv_event_t * e)
         invalidate_point(obj, chart->pressed_point_id);
         chart->pressed_point_id = LV_CHART_POINT_NONE;
     }
+    else if(code == LV_EVENT_STYLE_CHANGED || code == LV_EVENT_SIZE_CHANGED || code == LV_EVENT_SCROLL) {
+        stream_invalidate(obj);
+    }
     else if(code == LV_EVENT_DRAW_MAIN) {
         lv_layer_t * layer = lv_event_get_layer(e);
         draw_div_lines(obj, layer);
 
         if(lv_ll_is_empty(&chart->series_ll) == false) {
-            if(chart->type == LV_CHART_TYPE_LINE) draw_series_line(obj, layer);
+            if(chart->update_mode == LV_CHART_UPDATE_MODE_STREAM &&
+               chart->type != LV_CHART_TYPE_SCATTER) draw_series_stream(obj, layer);
+            else if(chart->type == LV_CHART_TYPE_LINE) draw_series_line(obj, layer);
             else if(chart->type == LV_CHART_TYPE_BAR) draw_series_bar(obj, layer);
             else if(chart->type == LV_CHART_TYPE_SCATTER) draw_series_scatter(obj, layer);
         }
@@ -848,7 +876,7 @@ static void draw_series_line(lv_obj_t * obj, lv_layer_t * layer)
         line_dsc.base.id2 = 0;
         point_dsc_default.base.id2 = 0;
 
-        int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+        int32_t start_point = chart->update_mode != LV_CHART_UPDATE_MODE_CIRCULAR ? ser->start_point : 0;
 
         line_dsc.p1.x = x_ofs;
         line_dsc.p2.x = x_ofs;
@@ -986,7 +1014,7 @@ static void draw_series_scatter(lv_obj_t * obj, lv_layer_t * layer)
         line_dsc.color = ser->color;
         point_dsc_default.bg_color = ser->color;
 
-        int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+        int32_t start_point = chart->update_mode != LV_CHART_UPDATE_MODE_CIRCULAR ? ser->start_point : 0;
 
         line_dsc.p1.x = x_ofs;
         line_dsc.p2.x = x_ofs;
@@ -1123,7 +1151,7 @@ static void draw_series_bar(lv_obj_t * obj, lv_layer_t * layer)
         LV_LL_READ(&chart->series_ll, ser) {
             if(ser->hidden) continue;
 
-            int32_t start_point = chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT ? ser->start_point : 0;
+            int32_t start_point = chart->update_mode != LV_CHART_UPDATE_MODE_CIRCULAR ? ser->start_point : 0;
 
             col_a.x1 = x_act;
             col_a.x2 = col_a.x1 + col_w - 1;
@@ -1279,7 +1307,7 @@ static void invalidate_point(lv_obj_t * obj, uint32_t i)
     int32_t scroll_left = lv_obj_get_scroll_left(obj);
 
     /*In shift mode the whole chart changes so the whole object*/
-    if(chart->update_mode == LV_CHART_UPDATE_MODE_SHIFT) {
+    if(chart->update_mode != LV_CHART_UPDATE_MODE_CIRCULAR) {
         lv_obj_invalidate(obj);
         return;
     }
@@ -1332,6 +1360,398 @@ static void invalidate_point(lv_obj_t * obj, uint32_t i)
     }
 }
 
+static void stream_invalidate(lv_obj_t * obj)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    chart->stream_valid = 0;
+}
+
+/**
+ * Invalidate the chart after a new point was added to a series in stream mode.
+ * Only the right edge is invalidated here to request a refresh, the pixels are moved
+ * and the redrawn strips are invalidated in `stream_refr_start_cb()`.
+ * @param obj       pointer to a chart
+ * @param ser       the series which got a new point
+ */
+static void stream_invalidate_next(lv_obj_t * obj, lv_chart_series_t * ser)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    /*All the points of the series were replaced since the last update*/
+    if(ser->start_point == ser->stream_start) stream_invalidate(obj);
+
+    if(!chart->stream_valid || chart->stream_buf == NULL) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    chart->stream_pending = 1;
+
+    lv_area_t area = chart->stream_area;
+    lv_area_move(&area, obj->coords.x1, obj->coords.y1);
+    area.x1 = LV_MAX(area.x1, area.x2 - stream_get_point_step(obj));
+    lv_obj_invalidate_area(obj, &area);
+}
+
+/**
+ * Free the stream buffer, e.g. if it can't be used or the chart is deleted
+ */
+static void stream_drop_buf(lv_obj_t * obj)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    if(chart->stream_buf) {
+        lv_image_cache_drop(chart->stream_buf);
+        lv_draw_buf_destroy(chart->stream_buf);
+        chart->stream_buf = NULL;
+    }
+
+    if(chart->stream_disp) {
+        lv_display_remove_event_cb_with_user_data(chart->stream_disp, stream_refr_start_cb, obj);
+        chart->stream_disp = NULL;
+    }
+
+    chart->stream_valid = 0;
+    chart->stream_pending = 0;
+}
+
+/**
+ * Get the distance of two adjacent points in pixels.
+ * @return      the distance or 0 if it's not a whole number of pixels, so the rendered series can't be shifted
+ */
+static int32_t stream_get_point_step(lv_obj_t * obj)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    if(chart->point_cnt < 2) return 0;
+
+    int32_t w = lv_obj_get_content_width(obj);
+    if(chart->type == LV_CHART_TYPE_BAR) {
+        int32_t block_gap = lv_obj_get_style_pad_column(obj, LV_PART_MAIN);
+        int32_t block_w = (w - ((chart->point_cnt - 1) * block_gap)) / chart->point_cnt;
+        w -= block_w;
+    }
+    /*In crowded mode the drawn vertical lines depend on the neighbor columns too*/
+    else if((int32_t)chart->point_cnt >= w) return 0;
+
+    if(w <= 0 || w % (chart->point_cnt - 1)) return 0;
+    return w / (chart->point_cnt - 1);
+}
+
+/**
+ * Get the number of points the visible series were shifted by since the stream buffer was updated.
+ * @return      the number of points or -1 if the series were shifted by different amounts
+ */
+static int32_t stream_get_shift_cnt(lv_obj_t * obj)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    int32_t shift_cnt = 0;
+    bool first = true;
+    lv_chart_series_t * ser;
+    LV_LL_READ(&chart->series_ll, ser) {
+        if(ser->hidden) continue;
+        int32_t d = (int32_t)((ser->start_point + chart->point_cnt - ser->stream_start) % chart->point_cnt);
+        if(first) shift_cnt = d;
+        else if(d != shift_cnt) return -1;
+        first = false;
+    }
+
+    return shift_cnt;
+}
+
+/**
+ * Get the area where the series can draw in stream mode: the content area
+ * extended with the size of the lines and points.
+ */
+static void stream_get_area(lv_obj_t * obj, lv_area_t * area)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    int32_t ext = lv_obj_get_style_line_width(obj, LV_PART_ITEMS);
+    ext += LV_MAX(lv_obj_get_style_width(obj, LV_PART_INDICATOR), lv_obj_get_style_height(obj, LV_PART_INDICATOR));
+
+    lv_obj_get_content_coords(obj, area);
+    lv_area_increase(area, ext, ext);
+
+    /*The bars are drawn to the bottom of the chart*/
+    if(chart->type == LV_CHART_TYPE_BAR) area->y2 = obj->coords.y2;
+
+    if(!lv_area_intersect(area, area, &obj->coords)) lv_area_set(area, 0, 0, -1, -1);
+}
+
+/**
+ * Get the parts of the stream area which need to be drawn again after shifting it.
+ * @param obj       pointer to a chart
+ * @param area      the absolute coordinates of the stream area
+ * @param shift_cnt the series were shifted by this many points
+ * @param step      the distance of two points in pixels
+ * @param left      store the strip of the first point here (it lost its left neighbor)
+ * @param right     store the strip of the last old point and the new points here
+ */
+static void stream_get_strips(lv_obj_t * obj, const lv_area_t * area, int32_t shift_cnt, int32_t step,
+                              lv_area_t * left, lv_area_t * right)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    int32_t ext = lv_obj_get_style_line_width(obj, LV_PART_ITEMS);
+    ext += LV_MAX(lv_obj_get_style_width(obj, LV_PART_INDICATOR), lv_obj_get_style_height(obj, LV_PART_INDICATOR));
+    int32_t x_ofs = obj->coords.x1 + lv_obj_get_style_pad_left(obj, LV_PART_MAIN) +
+                    lv_obj_get_style_border_width(obj, LV_PART_MAIN) - lv_obj_get_scroll_left(obj);
+
+    *left = *area;
+    left->x2 = LV_MIN(x_ofs + ext, area->x2);
+
+    *right = *area;
+    right->x1 = LV_MAX(x_ofs + (int32_t)(chart->point_cnt - 1 - shift_cnt) * step - ext, area->x1);
+}
+
+/**
+ * Check if the chart looks the same under `area` when it's shifted horizontally, i.e. only
+ * the series need to be drawn again: the background is a single opaque color and there is
+ * no vertical or dashed division line, border or rounded corner in the area.
+ * @param obj       pointer to a chart
+ * @param area      the absolute coordinates of the stream area
+ * @return          true: the background can be shifted together with the series
+ */
+static bool stream_bg_is_plain(lv_obj_t * obj, const lv_area_t * area)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    if(lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) < LV_OPA_COVER) return false;
+    if(lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) != LV_GRAD_DIR_NONE) return false;
+    if(lv_obj_get_style_bg_grad(obj, LV_PART_MAIN) != NULL) return false;
+    if(lv_obj_get_style_bg_image_src(obj, LV_PART_MAIN) != NULL) return false;
+
+    if(lv_obj_get_style_line_width(obj, LV_PART_MAIN) > 0 &&
+       lv_obj_get_style_line_opa(obj, LV_PART_MAIN) > LV_OPA_MIN) {
+        if(chart->vdiv_cnt > 0) return false;
+        if(chart->hdiv_cnt > 0 && lv_obj_get_style_line_dash_width(obj, LV_PART_MAIN) > 0 &&
+           lv_obj_get_style_line_dash_gap(obj, LV_PART_MAIN) > 0) return false;
+    }
+
+    lv_area_t inner = obj->coords;
+    int32_t border_w = lv_obj_get_style_border_width(obj, LV_PART_MAIN);
+    lv_area_increase(&inner, -border_w, -border_w);
+    int32_t radius = lv_obj_get_style_radius(obj, LV_PART_MAIN);
+    int32_t short_side = LV_MIN(lv_area_get_width(&inner), lv_area_get_height(&inner));
+    radius = LV_MIN(radius, short_side / 2);
+
+    return lv_area_is_in(area, &inner, radius);
+}
+
+/**
+ * Get the color format of the stream buffer. It's the display's color format if it has an alpha
+ * channel or the background can be drawn to the buffer too. Else a format with alpha channel
+ * is used only if it has the same pixel size, so the buffer is never larger than with the display's format.
+ * @param obj       pointer to a chart
+ * @param area      the absolute coordinates of the stream area
+ * @return          the color format or `LV_COLOR_FORMAT_UNKNOWN` if the buffer can't be used
+ */
+static lv_color_format_t stream_get_cf(lv_obj_t * obj, const lv_area_t * area)
+{
+    lv_color_format_t cf = lv_display_get_color_format(lv_obj_get_display(obj));
+
+    /*The pixels are shifted by whole bytes*/
+    if(lv_color_format_get_bpp(cf) < 8) return LV_COLOR_FORMAT_UNKNOWN;
+
+    if(lv_color_format_has_alpha(cf) || stream_bg_is_plain(obj, area)) return cf;
+    if(cf == LV_COLOR_FORMAT_XRGB8888) return LV_COLOR_FORMAT_ARGB8888;
+
+    return LV_COLOR_FORMAT_UNKNOWN;
+}
+
+/**
+ * Draw the series to `clip` of the stream buffer.
+ * @param obj       pointer to a chart
+ * @param buf_area  the absolute coordinates of the stream buffer
+ * @param clip      the absolute coordinates of the area to redraw
+ */
+static void stream_render(lv_obj_t * obj, const lv_area_t * buf_area, const lv_area_t * clip)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    lv_draw_buf_t * buf = chart->stream_buf;
+
+    lv_layer_t layer;
+    lv_memzero(&layer, sizeof(layer));
+    layer.draw_buf = buf;
+    layer.buf_area = *buf_area;
+    layer.color_format = buf->header.cf;
+    layer._clip_area = *clip;
+    layer.phy_clip_area = *clip;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    lv_matrix_identity(&layer.matrix);
+#endif
+
+    if(lv_color_format_has_alpha(buf->header.cf)) {
+        lv_area_t clear_area = *clip;
+        lv_area_move(&clear_area, -buf_area->x1, -buf_area->y1);
+        lv_draw_buf_clear(buf, &clear_area);
+    }
+    else {
+        /*An opaque buffer covers the background and the horizontal division lines so draw them too*/
+        lv_draw_rect_dsc_t bg_dsc;
+        lv_draw_rect_dsc_init(&bg_dsc);
+        bg_dsc.bg_color = lv_obj_get_style_bg_color_filtered(obj, LV_PART_MAIN);
+        lv_draw_rect(&layer, &bg_dsc, clip);
+        draw_div_lines(obj, &layer);
+    }
+
+    if(chart->type == LV_CHART_TYPE_LINE) draw_series_line(obj, &layer);
+    else draw_series_bar(obj, &layer);
+
+    /*Render only this layer, as in lv_canvas_finish_layer()*/
+    lv_display_t * disp = lv_obj_get_display(obj);
+    while(layer.draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        bool task_dispatched = lv_draw_dispatch_layer(disp, &layer);
+
+        if(!task_dispatched) {
+            lv_draw_wait_for_finish();
+            lv_draw_dispatch_request();
+        }
+    }
+}
+
+/**
+ * Bring the stream buffer up to date. If only new points were added with
+ * `lv_chart_set_next_value` the buffer is shifted and only the new points are drawn.
+ * @param obj       pointer to a chart
+ * @return          true: the buffer is ready; false: it can't be used, draw the series directly
+ */
+static bool stream_update(lv_obj_t * obj)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+    lv_display_t * disp = lv_obj_get_display(obj);
+
+    lv_area_t area;
+    stream_get_area(obj, &area);
+    int32_t w = lv_area_get_width(&area);
+    int32_t h = lv_area_get_height(&area);
+
+    lv_color_format_t cf = stream_get_cf(obj, &area);
+    if(w <= 0 || h <= 0 || cf == LV_COLOR_FORMAT_UNKNOWN ||
+       lv_draw_buf_width_to_stride(w, cf) * h > LV_CHART_STREAM_BUF_MAX_SIZE) {
+        stream_drop_buf(obj);
+        return false;
+    }
+
+    lv_area_t area_rel = area;
+    lv_area_move(&area_rel, -obj->coords.x1, -obj->coords.y1);
+    if(!lv_area_is_equal(&area_rel, &chart->stream_area)) {
+        chart->stream_area = area_rel;
+        chart->stream_valid = 0;
+    }
+
+    if(chart->stream_buf == NULL || chart->stream_disp != disp || chart->stream_buf->header.cf != cf ||
+       chart->stream_buf->header.w != (uint32_t)w || chart->stream_buf->header.h != (uint32_t)h) {
+        stream_drop_buf(obj);
+
+        /*Not an error, the series can be drawn without the buffer too*/
+        chart->stream_buf = lv_draw_buf_create(w, h, cf, LV_STRIDE_AUTO);
+        if(chart->stream_buf == NULL) return false;
+
+        chart->stream_disp = disp;
+        lv_display_add_event_cb(disp, stream_refr_start_cb, LV_EVENT_REFR_START, obj);
+    }
+
+    /*All visible series should have been shifted by the same number of points*/
+    int32_t shift_cnt = 0;
+    if(chart->stream_valid) {
+        shift_cnt = stream_get_shift_cnt(obj);
+        if(shift_cnt < 0) chart->stream_valid = 0;
+    }
+
+    int32_t step = stream_get_point_step(obj);
+    int32_t shift_px = shift_cnt * step;
+    if(shift_cnt > 0 && (step == 0 || shift_px >= w)) chart->stream_valid = 0;
+
+    if(chart->stream_valid && shift_cnt == 0) return true;
+
+    if(!chart->stream_valid) {
+        stream_render(obj, &area, &area);
+    }
+    else {
+        lv_draw_buf_t * buf = chart->stream_buf;
+        uint32_t px_size = lv_color_format_get_size(cf);
+        int32_t y;
+        for(y = 0; y < h; y++) {
+            uint8_t * row = buf->data + y * buf->header.stride;
+            lv_memmove(row, row + shift_px * px_size, (w - shift_px) * px_size);
+        }
+
+        lv_area_t left;
+        lv_area_t right;
+        stream_get_strips(obj, &area, shift_cnt, step, &left, &right);
+        if(left.x2 >= left.x1) stream_render(obj, &area, &left);
+        stream_render(obj, &area, &right);
+    }
+
+    lv_chart_series_t * ser;
+    LV_LL_READ(&chart->series_ll, ser) {
+        ser->stream_start = ser->start_point;
+    }
+    chart->stream_valid = 1;
+
+    lv_image_cache_drop(chart->stream_buf);
+    return true;
+}
+
+/**
+ * Called before the display of a chart in stream mode is refreshed. If new points were added,
+ * move the already shown pixels of the series on the display and invalidate only the strips
+ * which are drawn again. If the pixels can't be moved invalidate the whole stream area.
+ */
+static void stream_refr_start_cb(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_user_data(e);
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    if(!chart->stream_pending) return;
+    chart->stream_pending = 0;
+
+    lv_area_t area = chart->stream_area;
+    lv_area_move(&area, obj->coords.x1, obj->coords.y1);
+
+    int32_t shift_cnt = chart->stream_valid ? stream_get_shift_cnt(obj) : -1;
+    if(shift_cnt == 0) return;
+
+    int32_t step = stream_get_point_step(obj);
+    int32_t shift_px = shift_cnt * step;
+    if(shift_cnt > 0 && step > 0 && shift_px < lv_area_get_width(&area) &&
+       lv_ll_is_empty(&chart->cursor_ll) && stream_bg_is_plain(obj, &area) &&
+       lv_refr_move_area(obj, &area, -shift_px, 0)) {
+        lv_area_t left;
+        lv_area_t right;
+        stream_get_strips(obj, &area, shift_cnt, step, &left, &right);
+        if(left.x2 >= left.x1) lv_obj_invalidate_area(obj, &left);
+        lv_obj_invalidate_area(obj, &right);
+    }
+    else {
+        lv_obj_invalidate_area(obj, &area);
+    }
+}
+
+static void draw_series_stream(lv_obj_t * obj, lv_layer_t * layer)
+{
+    lv_chart_t * chart  = (lv_chart_t *)obj;
+
+    if(!stream_update(obj)) {
+        /*Draw the series as in shift mode*/
+        if(chart->type == LV_CHART_TYPE_LINE) draw_series_line(obj, layer);
+        else draw_series_bar(obj, layer);
+        return;
+    }
+
+    lv_area_t area = chart->stream_area;
+    lv_area_move(&area, obj->coords.x1, obj->coords.y1);
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = chart->stream_buf;
+    img_dsc.base.obj = obj;
+    lv_draw_image(layer, &img_dsc, &area);
+}
+
 static void new_points_alloc(lv_obj_t * obj, lv_chart_series_t * ser, uint32_t cnt, int32_t ** a)
 {
     if((*a) == NULL) return;
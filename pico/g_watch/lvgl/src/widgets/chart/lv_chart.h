@@ -46,6 +46,8 @@ typedef enum {
 typedef enum {
     LV_CHART_UPDATE_MODE_SHIFT,     /**< Shift old data to the left and add the new one the right*/
     LV_CHART_UPDATE_MODE_CIRCULAR,  /**< Add the new data in a circular way*/
+    LV_CHART_UPDATE_MODE_STREAM,    /**< Like LV_CHART_UPDATE_MODE_SHIFT but the rendered series are
+                                         kept in a buffer which is shifted and only the new points are drawn*/
 } lv_chart_update_mode_t;
 
 /**
@@ -35,6 +35,7 @@ struct _lv_chart_series_t {
     int32_t * y_points;
     lv_color_t color;
     uint32_t start_point;
+    uint32_t stream_start;      /**< `start_point` when the stream buffer was last updated*/
     uint32_t hidden : 1;
     uint32_t x_ext_buf_assigned : 1;
     uint32_t y_ext_buf_assigned : 1;
@@ -65,6 +66,11 @@ struct _lv_chart_t {
     uint32_t point_cnt;         /**< Point number in a data line*/
     lv_chart_type_t type  : 3;  /**< Line or column chart*/
     lv_chart_update_mode_t update_mode : 2;
+    uint32_t stream_valid : 1;  /**< 1: `stream_buf` matches the data at `stream_start`*/
+    uint32_t stream_pending : 1; /**< 1: points were added, move the shown pixels before the next refresh*/
+    lv_draw_buf_t * stream_buf; /**< The rendered series in LV_CHART_UPDATE_MODE_STREAM*/
+    lv_area_t stream_area;      /**< Area of `stream_buf` relative to the chart*/
+    lv_display_t * stream_disp; /**< The display whose LV_EVENT_REFR_START is handled for `stream_buf`*/
 };
 
 
@@ -19,6 +19,10 @@
 #include "../../misc/lv_timer.h"
 #include "../../core/lv_obj_class_private.h"
 #include "../../misc/cache/lv_image_cache.h"
+#include "../../misc/cache/lv_cache.h"
+#include "../../misc/cache/lv_cache_private.h"
+#include "../../display/lv_display_private.h"
+#include "../../libs/rle/lv_rle.h"
 
 /*********************
  *      DEFINES
@@ -29,6 +33,13 @@
  *      TYPEDEFS
  **********************/
 
+typedef struct {
+    lv_cache_slot_size_t slot;
+    int32_t frame;
+    uint32_t data_size;
+    uint8_t * data;         /*RLE compressed (if LV_USE_RLE) content of the draw buffer*/
+} frame_cache_data_t;
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -36,6 +47,14 @@ static void lv_lottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj
 static void lv_lottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void anim_exec_cb(void * var, int32_t v);
 static void lottie_update(lv_lottie_t * lottie, int32_t v);
+static void lottie_render(lv_lottie_t * lottie, int32_t v);
+static void frame_cache_drop_all(lv_lottie_t * lottie);
+static bool frame_cache_load(lv_lottie_t * lottie, int32_t frame);
+static bool frame_cache_save(lv_lottie_t * lottie, int32_t frame, bool evict);
+static bool frame_cache_has(lv_lottie_t * lottie, int32_t frame);
+static void frame_cache_free_cb(frame_cache_data_t * node, void * user_data);
+static lv_cache_compare_res_t frame_cache_compare_cb(const frame_cache_data_t * lhs, const frame_cache_data_t * rhs);
+static void prerender_timer_cb(lv_timer_t * t);
 
 /**********************
  *  STATIC VARIABLES
@@ -76,6 +95,7 @@ void lv_lottie_set_buffer(lv_obj_t * obj, int32_t w, int32_t h, void * buf)
     int32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_ARGB8888);
     buf = lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888);
 
+    frame_cache_drop_all(lottie);
     tvg_swcanvas_set_target(lottie->tvg_canvas, buf, stride / 4, w, h, TVG_COLORSPACE_ARGB8888);
     tvg_canvas_push(lottie->tvg_canvas, lottie->tvg_paint);
     lv_canvas_set_buffer(obj, buf, w, h, LV_COLOR_FORMAT_ARGB8888);
@@ -99,6 +119,7 @@ void lv_lottie_set_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf)
     }
 
     lv_lottie_t * lottie = (lv_lottie_t *)obj;
+    frame_cache_drop_all(lottie);
     tvg_swcanvas_set_target(lottie->tvg_canvas, (void *)draw_buf->data, draw_buf->header.stride / 4,
                             draw_buf->header.w, draw_buf->header.h, TVG_COLORSPACE_ARGB8888);
     tvg_canvas_push(lottie->tvg_canvas, lottie->tvg_paint);
@@ -117,6 +138,7 @@ void lv_lottie_set_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf)
 void lv_lottie_set_src_data(lv_obj_t * obj, const void * src, size_t src_size)
 {
     lv_lottie_t * lottie = (lv_lottie_t *)obj;
+    frame_cache_drop_all(lottie);
     tvg_picture_load_data(lottie->tvg_paint, src, src_size, "lottie", true);
     lv_draw_buf_t * canvas_draw_buf = lv_canvas_get_draw_buf(obj);
     if(canvas_draw_buf) {
@@ -135,6 +157,7 @@ void lv_lottie_set_src_data(lv_obj_t * obj, const void * src, size_t src_size)
 void lv_lottie_set_src_file(lv_obj_t * obj, const char * src)
 {
     lv_lottie_t * lottie = (lv_lottie_t *)obj;
+    frame_cache_drop_all(lottie);
     tvg_picture_load(lottie->tvg_paint, src);
     lv_draw_buf_t * canvas_draw_buf = lv_canvas_get_draw_buf(obj);
     if(canvas_draw_buf) {
@@ -158,6 +181,59 @@ lv_anim_t * lv_lottie_get_anim(lv_obj_t * obj)
     return lottie->anim;
 }
 
+void lv_lottie_set_frame_cache_size(lv_obj_t * obj, uint32_t max_size)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+
+    if(max_size == 0) {
+        if(lottie->frame_cache) {
+            lv_cache_destroy(lottie->frame_cache, NULL);
+            lottie->frame_cache = NULL;
+        }
+        return;
+    }
+
+    if(lottie->frame_cache) {
+        lv_cache_set_max_size(lottie->frame_cache, max_size, NULL);
+        /*Drop the least recently used frames which don't fit anymore*/
+        lv_cache_reserve(lottie->frame_cache, 0, NULL);
+        return;
+    }
+
+    lottie->frame_cache = lv_cache_create(&lv_cache_class_lru_rb_size, sizeof(frame_cache_data_t), max_size,
+    (lv_cache_ops_t) {
+        .compare_cb = (lv_cache_compare_cb_t)frame_cache_compare_cb,
+        .create_cb = NULL,
+        .free_cb = (lv_cache_free_cb_t)frame_cache_free_cb,
+    });
+    lv_cache_set_name(lottie->frame_cache, "LOTTIE_FRAME");
+
+    /*Start pre-rendering if it was enabled before the cache*/
+    lottie->prerender_frame = 0;
+    if(lottie->prerender_timer) lv_timer_resume(lottie->prerender_timer);
+}
+
+void lv_lottie_set_frame_cache_prerender(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+
+    if(!en) {
+        if(lottie->prerender_timer) {
+            lv_timer_delete(lottie->prerender_timer);
+            lottie->prerender_timer = NULL;
+        }
+        return;
+    }
+
+    if(lottie->prerender_timer == NULL) {
+        lottie->prerender_timer = lv_timer_create(prerender_timer_cb, LV_DEF_REFR_PERIOD, lottie);
+    }
+    lottie->prerender_frame = 0;
+    lv_timer_resume(lottie->prerender_timer);
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -191,6 +267,8 @@ static void lv_lottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     LV_UNUSED(class_p);
     lv_lottie_t * lottie = (lv_lottie_t *)obj;
 
+    if(lottie->prerender_timer) lv_timer_delete(lottie->prerender_timer);
+    if(lottie->frame_cache) lv_cache_destroy(lottie->frame_cache, NULL);
     tvg_animation_del(lottie->tvg_anim);
     tvg_canvas_destroy(lottie->tvg_canvas);
 }
@@ -221,18 +299,179 @@ static void lottie_update(lv_lottie_t * lottie, int32_t v)
 
     lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(obj);
     if(draw_buf) {
-        lv_draw_buf_clear(draw_buf, NULL);
-
         /*Drop old cached image*/
         lv_image_cache_drop(lv_image_get_src(obj));
     }
 
+    if(!frame_cache_load(lottie, v)) {
+        lottie_render(lottie, v);
+        frame_cache_save(lottie, v, true);
+    }
+    lottie->displayed_frame = v;
+
+    lv_obj_invalidate(obj);
+}
+
+static void lottie_render(lv_lottie_t * lottie, int32_t v)
+{
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf((lv_obj_t *)lottie);
+    if(draw_buf) {
+        lv_draw_buf_clear(draw_buf, NULL);
+    }
+
     tvg_animation_set_frame(lottie->tvg_anim, v);
     tvg_canvas_update(lottie->tvg_canvas);
     tvg_canvas_draw(lottie->tvg_canvas);
     tvg_canvas_sync(lottie->tvg_canvas);
+}
 
-    lv_obj_invalidate(obj);
+static void frame_cache_drop_all(lv_lottie_t * lottie)
+{
+    if(lottie->frame_cache == NULL) return;
+
+    lv_cache_drop_all(lottie->frame_cache, NULL);
+    lottie->prerender_frame = 0;
+    if(lottie->prerender_timer) lv_timer_resume(lottie->prerender_timer);
+}
+
+/**
+ * Copy a frame from the frame cache to the draw buffer
+ * @param lottie    pointer to a lottie widget
+ * @param frame     the frame to load
+ * @return          true: the frame was in the cache
+ */
+static bool frame_cache_load(lv_lottie_t * lottie, int32_t frame)
+{
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf((lv_obj_t *)lottie);
+    if(lottie->frame_cache == NULL || draw_buf == NULL) return false;
+
+    frame_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.frame = frame;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(lottie->frame_cache, &search_key, NULL);
+    if(entry == NULL) return false;
+
+    frame_cache_data_t * cached = lv_cache_entry_get_data(entry);
+    uint32_t buf_size = draw_buf->header.stride * draw_buf->header.h;
+#if LV_USE_RLE
+    lv_rle_decompress(cached->data, cached->data_size, draw_buf->data, buf_size, 4);
+#else
+    lv_memcpy(draw_buf->data, cached->data, LV_MIN(buf_size, cached->data_size));
+#endif
+    lv_cache_release(lottie->frame_cache, entry, NULL);
+    return true;
+}
+
+/**
+ * Add the content of the draw buffer to the frame cache
+ * @param lottie    pointer to a lottie widget
+ * @param frame     the rendered frame
+ * @param evict     true: drop the least recently used frames if the cache is full
+ * @return          true: the frame was added to the cache
+ */
+static bool frame_cache_save(lv_lottie_t * lottie, int32_t frame, bool evict)
+{
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf((lv_obj_t *)lottie);
+    if(lottie->frame_cache == NULL || draw_buf == NULL) return false;
+
+    uint32_t buf_size = draw_buf->header.stride * draw_buf->header.h;
+#if LV_USE_RLE
+    uint32_t data_size = lv_rle_compress(draw_buf->data, buf_size, NULL, 0, 4);
+#else
+    uint32_t data_size = buf_size;
+#endif
+    if(data_size > lv_cache_get_max_size(lottie->frame_cache, NULL)) return false;
+    if(!evict && data_size > lv_cache_get_free_size(lottie->frame_cache, NULL)) return false;
+
+    frame_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.slot.size = data_size;
+    search_key.frame = frame;
+    search_key.data_size = data_size;
+    search_key.data = lv_malloc(data_size);
+    if(search_key.data == NULL) return false;
+
+#if LV_USE_RLE
+    lv_rle_compress(draw_buf->data, buf_size, search_key.data, data_size, 4);
+#else
+    lv_memcpy(search_key.data, draw_buf->data, data_size);
+#endif
+
+    lv_cache_entry_t * entry = lv_cache_add(lottie->frame_cache, &search_key, NULL);
+    if(entry == NULL) {
+        lv_free(search_key.data);
+        return false;
+    }
+
+    lv_cache_release(lottie->frame_cache, entry, NULL);
+    return true;
+}
+
+static bool frame_cache_has(lv_lottie_t * lottie, int32_t frame)
+{
+    frame_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.frame = frame;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(lottie->frame_cache, &search_key, NULL);
+    if(entry == NULL) return false;
+
+    lv_cache_release(lottie->frame_cache, entry, NULL);
+    return true;
+}
+
+static void frame_cache_free_cb(frame_cache_data_t * node, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_free(node->data);
+}
+
+static lv_cache_compare_res_t frame_cache_compare_cb(const frame_cache_data_t * lhs, const frame_cache_data_t * rhs)
+{
+    if(lhs->frame == rhs->frame) return 0;
+    return lhs->frame > rhs->frame ? 1 : -1;
+}
+
+static void prerender_timer_cb(lv_timer_t * t)
+{
+    lv_lottie_t * lottie = lv_timer_get_user_data(t);
+    lv_obj_t * obj = (lv_obj_t *)lottie;
+    if(lottie->frame_cache == NULL || lv_canvas_get_draw_buf(obj) == NULL) return;
+
+    /*Don't delay redrawing the display*/
+    lv_display_t * disp = lv_obj_get_display(obj);
+    if(disp->inv_p != 0 || disp->rendering_in_progress) return;
+
+    float f_total;
+    tvg_animation_get_total_frame(lottie->tvg_anim, &f_total);
+    if(f_total < 1) return;
+
+    /*Same frames as played by the animation*/
+    int32_t last_frame = (int32_t)f_total;
+    while(lottie->prerender_frame <= last_frame && frame_cache_has(lottie, lottie->prerender_frame)) {
+        lottie->prerender_frame++;
+    }
+
+    if(lottie->prerender_frame > last_frame) {
+        lv_timer_pause(t);
+        return;
+    }
+
+    int32_t frame = lottie->prerender_frame;
+    lottie_render(lottie, frame);
+    if(frame_cache_save(lottie, frame, false)) {
+        lottie->prerender_frame++;
+    }
+    else {
+        /*The cache is full: more frames would only evict the others*/
+        lv_timer_pause(t);
+    }
+
+    /*Restore the displayed frame*/
+    if(!frame_cache_load(lottie, lottie->displayed_frame)) {
+        lottie_render(lottie, lottie->displayed_frame);
+    }
 }
 
 #endif /*LV_USE_LOTTIE*/
@@ -85,6 +85,23 @@ void lv_lottie_set_src_file(lv_obj_t * obj, const char * src);
  */
 lv_anim_t * lv_lottie_get_anim(lv_obj_t * obj);
 
+/**
+ * Keep the rendered frames RLE compressed in RAM and show them again without rendering.
+ * When the cache is full the least recently used frames are dropped.
+ * @param obj       pointer to a lottie widget
+ * @param max_size  memory budget of the cache in bytes, 0: disable the cache (default)
+ */
+void lv_lottie_set_frame_cache_size(lv_obj_t * obj, uint32_t max_size);
+
+/**
+ * Render the frames which are not in the frame cache yet in the background,
+ * one frame at a time when the display has nothing to redraw.
+ * The frame cache needs to be enabled by `lv_lottie_set_frame_cache_size()`.
+ * @param obj       pointer to a lottie widget
+ * @param en        true: enable pre-rendering; false: disable it (default)
+ */
+void lv_lottie_set_frame_cache_prerender(lv_obj_t * obj, bool en);
+
 /**********************
  * GLOBAL VARIABLES
  **********************/
@@ -41,6 +41,10 @@ typedef struct {
     Tvg_Animation * tvg_anim;
     lv_anim_t * anim;
     int32_t last_rendered_time;
+    lv_cache_t * frame_cache;       /**< Rendered frames, NULL if disabled*/
+    lv_timer_t * prerender_timer;   /**< Renders the missing frames while idle, NULL if disabled*/
+    int32_t prerender_frame;        /**< The next frame to check by the pre-render timer*/
+    int32_t displayed_frame;        /**< The frame in the draw buffer*/
 } lv_lottie_t;
 
 /**********************
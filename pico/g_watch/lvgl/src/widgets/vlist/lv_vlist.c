@@ -0,0 +1,374 @@
+/**
+ * @file lv_vlist.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_vlist_private.h"
+#include "../../core/lv_obj_class_private.h"
+#if LV_USE_VLIST
+
+#include "../../misc/lv_assert.h"
+#include "../../stdlib/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MY_CLASS (&lv_vlist_class)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void lv_vlist_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_vlist_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_vlist_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static int32_t get_pitch(lv_obj_t * obj);
+static void resize_pool(lv_obj_t * obj, uint32_t row_cnt);
+static void bind_row(lv_obj_t * obj, lv_vlist_row_t * row, uint32_t index);
+static void update_rows(lv_obj_t * obj, bool rebind_all);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+const lv_obj_class_t lv_vlist_class = {
+    .constructor_cb = lv_vlist_constructor,
+    .destructor_cb = lv_vlist_destructor,
+    .event_cb = lv_vlist_event,
+    .width_def = (LV_DPI_DEF * 3) / 2,
+    .height_def = LV_DPI_DEF * 2,
+    .instance_size = sizeof(lv_vlist_t),
+    .base_class = &lv_obj_class,
+    .name = "vlist",
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * lv_vlist_create(lv_obj_t * parent)
+{
+    LV_LOG_INFO("begin");
+    lv_obj_t * obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+void lv_vlist_set_item_count(lv_obj_t * obj, uint32_t cnt)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->item_cnt == cnt) return;
+    vlist->item_cnt = cnt;
+
+    lv_obj_refresh_self_size(obj);
+    update_rows(obj, false);
+
+    /*Bring the scroll position back into the new content if it got shorter*/
+    lv_obj_update_layout(obj);
+    lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
+}
+
+void lv_vlist_set_item_height(lv_obj_t * obj, int32_t h)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(h < 1) h = 1;
+    if(vlist->item_h == h) return;
+    vlist->item_h = h;
+
+    uint32_t i;
+    for(i = 0; i < vlist->row_cnt; i++) {
+        lv_obj_set_height(vlist->rows[i].obj, h);
+    }
+
+    lv_obj_refresh_self_size(obj);
+    update_rows(obj, true);
+
+    lv_obj_update_layout(obj);
+    lv_obj_readjust_scroll(obj, LV_ANIM_OFF);
+}
+
+void lv_vlist_set_overscan(lv_obj_t * obj, uint32_t rows)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->overscan == rows) return;
+    vlist->overscan = rows;
+    update_rows(obj, false);
+}
+
+void lv_vlist_set_create_cb(lv_obj_t * obj, lv_vlist_create_cb_t cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    vlist->create_cb = cb;
+
+    /*The existing rows were made by the old callback*/
+    resize_pool(obj, 0);
+    update_rows(obj, true);
+}
+
+void lv_vlist_set_bind_cb(lv_obj_t * obj, lv_vlist_bind_cb_t cb)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    vlist->bind_cb = cb;
+    update_rows(obj, true);
+}
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+uint32_t lv_vlist_get_item_count(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    return ((lv_vlist_t *)obj)->item_cnt;
+}
+
+int32_t lv_vlist_get_item_height(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    return ((lv_vlist_t *)obj)->item_h;
+}
+
+lv_obj_t * lv_vlist_get_row(const lv_obj_t * obj, uint32_t index)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->row_cnt == 0) return NULL;
+
+    lv_vlist_row_t * row = &vlist->rows[index % vlist->row_cnt];
+    return row->index == (int32_t)index ? row->obj : NULL;
+}
+
+int32_t lv_vlist_get_row_index(const lv_obj_t * obj, const lv_obj_t * row)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    uint32_t i;
+    for(i = 0; i < vlist->row_cnt; i++) {
+        if(vlist->rows[i].obj == row) return vlist->rows[i].index;
+    }
+
+    return -1;
+}
+
+/*=====================
+ * Other functions
+ *====================*/
+
+void lv_vlist_refresh(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    update_rows(obj, true);
+}
+
+void lv_vlist_refresh_item(lv_obj_t * obj, uint32_t index)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(vlist->row_cnt == 0) return;
+
+    lv_vlist_row_t * row = &vlist->rows[index % vlist->row_cnt];
+    if(row->index == (int32_t)index) bind_row(obj, row, index);
+}
+
+void lv_vlist_scroll_to_item(lv_obj_t * obj, uint32_t index, lv_anim_enable_t anim_en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(index >= vlist->item_cnt) return;
+
+    lv_obj_update_layout(obj);
+
+    int32_t y = (int32_t)index * get_pitch(obj);
+    int32_t view_h = lv_obj_get_content_height(obj);
+    int32_t scroll_y = lv_obj_get_scroll_y(obj);
+
+    if(y < scroll_y) {
+        lv_obj_scroll_to_y(obj, y, anim_en);
+    }
+    else if(y + vlist->item_h > scroll_y + view_h) {
+        lv_obj_scroll_to_y(obj, y + vlist->item_h - view_h, anim_en);
+    }
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void lv_vlist_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    LV_TRACE_OBJ_CREATE("begin");
+
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    vlist->item_h = LV_DPX(40);
+    vlist->overscan = 1;
+
+    lv_obj_set_scroll_dir(obj, LV_DIR_VER);
+
+    LV_TRACE_OBJ_CREATE("finished");
+}
+
+static void lv_vlist_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    /*The rows are deleted as children*/
+    lv_free(vlist->rows);
+    vlist->rows = NULL;
+    vlist->row_cnt = 0;
+}
+
+static void lv_vlist_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    /*Call the ancestor's event handler*/
+    lv_result_t res = lv_obj_event_base(MY_CLASS, e);
+    if(res != LV_RESULT_OK) return;
+
+    const lv_event_code_t code = lv_event_get_code(e);
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    if(code == LV_EVENT_GET_SELF_SIZE) {
+        lv_point_t * p = lv_event_get_param(e);
+        if(vlist->item_cnt > 0) {
+            int32_t h = (int32_t)vlist->item_cnt * get_pitch(obj) - lv_obj_get_style_pad_row(obj, LV_PART_MAIN);
+            p->y = LV_MAX(p->y, h);
+        }
+    }
+    else if(code == LV_EVENT_SCROLL) {
+        update_rows(obj, false);
+    }
+    else if(code == LV_EVENT_SIZE_CHANGED) {
+        update_rows(obj, false);
+    }
+    else if(code == LV_EVENT_STYLE_CHANGED) {
+        /*The row gap might have changed*/
+        lv_obj_refresh_self_size(obj);
+        update_rows(obj, true);
+    }
+}
+
+static int32_t get_pitch(lv_obj_t * obj)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    return vlist->item_h + lv_obj_get_style_pad_row(obj, LV_PART_MAIN);
+}
+
+static void resize_pool(lv_obj_t * obj, uint32_t row_cnt)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    uint32_t i;
+
+    for(i = row_cnt; i < vlist->row_cnt; i++) {
+        lv_obj_delete(vlist->rows[i].obj);
+    }
+
+    if(row_cnt == 0) {
+        lv_free(vlist->rows);
+        vlist->rows = NULL;
+        vlist->row_cnt = 0;
+        return;
+    }
+
+    lv_vlist_row_t * rows = lv_realloc(vlist->rows, row_cnt * sizeof(lv_vlist_row_t));
+    LV_ASSERT_MALLOC(rows);
+    if(rows == NULL) {
+        vlist->row_cnt = LV_MIN(vlist->row_cnt, row_cnt);
+        return;
+    }
+    vlist->rows = rows;
+
+    for(i = vlist->row_cnt; i < row_cnt; i++) {
+        lv_obj_t * row_obj;
+        if(vlist->create_cb) {
+            row_obj = vlist->create_cb(obj);
+        }
+        else {
+            row_obj = lv_obj_create(obj);
+            lv_obj_remove_flag(row_obj, LV_OBJ_FLAG_SCROLLABLE);
+        }
+        lv_obj_set_size(row_obj, lv_pct(100), vlist->item_h);
+        rows[i].obj = row_obj;
+        rows[i].index = -1;
+    }
+
+    vlist->row_cnt = row_cnt;
+}
+
+static void bind_row(lv_obj_t * obj, lv_vlist_row_t * row, uint32_t index)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+
+    row->index = (int32_t)index;
+    lv_obj_set_pos(row->obj, 0, (int32_t)index * get_pitch(obj));
+    if(vlist->bind_cb) vlist->bind_cb(obj, row->obj, index);
+}
+
+/**
+ * Assign the rows to the items in the visible window plus the overscan.
+ * Only rows whose item changed are rebound unless `rebind_all` is set.
+ */
+static void update_rows(lv_obj_t * obj, bool rebind_all)
+{
+    lv_vlist_t * vlist = (lv_vlist_t *)obj;
+    int32_t pitch = get_pitch(obj);
+    if(pitch < 1) pitch = 1;
+
+    /*Enough rows to cover the content area with a partially visible row on both ends*/
+    uint32_t row_cnt = 0;
+    if(vlist->item_cnt > 0) {
+        int32_t view_h = LV_MAX(lv_obj_get_content_height(obj), 0);
+        row_cnt = (uint32_t)(view_h / pitch) + 2 + 2 * vlist->overscan;
+        row_cnt = LV_MIN(row_cnt, vlist->item_cnt);
+    }
+
+    if(row_cnt != vlist->row_cnt) {
+        /*`i % row_cnt` changes for every item*/
+        resize_pool(obj, row_cnt);
+        rebind_all = true;
+    }
+    row_cnt = vlist->row_cnt;
+    if(row_cnt == 0) return;
+
+    int32_t first = lv_obj_get_scroll_y(obj) / pitch - (int32_t)vlist->overscan;
+    first = LV_MIN(first, (int32_t)(vlist->item_cnt - row_cnt));
+    first = LV_MAX(first, 0);
+
+    uint32_t i;
+    for(i = (uint32_t)first; i < (uint32_t)first + row_cnt; i++) {
+        lv_vlist_row_t * row = &vlist->rows[i % row_cnt];
+        if(rebind_all || row->index != (int32_t)i) bind_row(obj, row, i);
+    }
+}
+
+#endif /*LV_USE_VLIST*/
@@ -0,0 +1,166 @@
+/**
+ * @file lv_vlist.h
+ *
+ */
+
+#ifndef LV_VLIST_H
+#define LV_VLIST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../core/lv_obj.h"
+
+#if LV_USE_VLIST
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**
+ * Create a row object for the pool.
+ * @param vlist     pointer to the virtualized list, it must be the parent of the new row
+ * @return          the new row
+ */
+typedef lv_obj_t * (*lv_vlist_create_cb_t)(lv_obj_t * vlist);
+
+/**
+ * Show an item on a row. Called whenever a row is (re)assigned to an item.
+ * @param vlist     pointer to the virtualized list
+ * @param row       a row created by the `lv_vlist_create_cb_t`
+ * @param index     index of the item to show
+ */
+typedef void (*lv_vlist_bind_cb_t)(lv_obj_t * vlist, lv_obj_t * row, uint32_t index);
+
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_vlist_class;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a virtualized list object. Only the rows in the visible window (plus the overscan)
+ * exist as objects, they are rebound to other items while scrolling.
+ * @param parent    pointer to an object, it will be the parent of the new list
+ * @return          pointer to the created list
+ */
+lv_obj_t * lv_vlist_create(lv_obj_t * parent);
+
+/*=====================
+ * Setter functions
+ *====================*/
+
+/**
+ * Set the number of items
+ * @param obj       pointer to a virtualized list
+ * @param cnt       number of items
+ */
+void lv_vlist_set_item_count(lv_obj_t * obj, uint32_t cnt);
+
+/**
+ * Set the height of the rows. The gap between the rows is the `pad_row` style property.
+ * @param obj       pointer to a virtualized list
+ * @param h         height of a row in pixels
+ */
+void lv_vlist_set_item_height(lv_obj_t * obj, int32_t h);
+
+/**
+ * Set how many extra rows to keep bound above and below the visible window
+ * @param obj       pointer to a virtualized list
+ * @param rows      number of rows on each side (default 1)
+ */
+void lv_vlist_set_overscan(lv_obj_t * obj, uint32_t rows);
+
+/**
+ * Set the function creating the rows. If not set plain base objects are created.
+ * The existing rows are deleted and created again.
+ * @param obj       pointer to a virtualized list
+ * @param cb        the create callback
+ */
+void lv_vlist_set_create_cb(lv_obj_t * obj, lv_vlist_create_cb_t cb);
+
+/**
+ * Set the function showing an item on a row
+ * @param obj       pointer to a virtualized list
+ * @param cb        the bind callback
+ */
+void lv_vlist_set_bind_cb(lv_obj_t * obj, lv_vlist_bind_cb_t cb);
+
+/*=====================
+ * Getter functions
+ *====================*/
+
+/**
+ * Get the number of items
+ * @param obj       pointer to a virtualized list
+ * @return          number of items
+ */
+uint32_t lv_vlist_get_item_count(const lv_obj_t * obj);
+
+/**
+ * Get the height of the rows
+ * @param obj       pointer to a virtualized list
+ * @return          height of a row in pixels
+ */
+int32_t lv_vlist_get_item_height(const lv_obj_t * obj);
+
+/**
+ * Get the row currently showing an item
+ * @param obj       pointer to a virtualized list
+ * @param index     index of an item
+ * @return          the row or NULL if the item is not bound to any row
+ */
+lv_obj_t * lv_vlist_get_row(const lv_obj_t * obj, uint32_t index);
+
+/**
+ * Get the index of the item shown by a row. Useful in the event handlers of the rows.
+ * @param obj       pointer to a virtualized list
+ * @param row       pointer to a row of the list
+ * @return          index of the item or -1 if `row` is not a bound row of the list
+ */
+int32_t lv_vlist_get_row_index(const lv_obj_t * obj, const lv_obj_t * row);
+
+/*=====================
+ * Other functions
+ *====================*/
+
+/**
+ * Call the bind callback again on every bound row, e.g. after the data changed
+ * @param obj       pointer to a virtualized list
+ */
+void lv_vlist_refresh(lv_obj_t * obj);
+
+/**
+ * Call the bind callback again on the row of an item if it's bound
+ * @param obj       pointer to a virtualized list
+ * @param index     index of the changed item
+ */
+void lv_vlist_refresh_item(lv_obj_t * obj, uint32_t index);
+
+/**
+ * Scroll to make an item visible
+ * @param obj       pointer to a virtualized list
+ * @param index     index of an item
+ * @param anim_en   LV_ANIM_ON: scroll with animation
+ */
+void lv_vlist_scroll_to_item(lv_obj_t * obj, uint32_t index, lv_anim_enable_t anim_en);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_VLIST*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_VLIST_H*/
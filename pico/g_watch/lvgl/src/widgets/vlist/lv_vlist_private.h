@@ -0,0 +1,62 @@
+/**
+ * @file lv_vlist_private.h
+ *
+ */
+
+#ifndef LV_VLIST_PRIVATE_H
+#define LV_VLIST_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../core/lv_obj_private.h"
+#include "lv_vlist.h"
+
+#if LV_USE_VLIST
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** A pooled row and the item it shows */
+typedef struct {
+    lv_obj_t * obj;
+    int32_t index;              /**< -1 if not bound */
+} lv_vlist_row_t;
+
+/** Data of virtualized list */
+struct _lv_vlist_t {
+    lv_obj_t obj;
+    lv_vlist_create_cb_t create_cb;
+    lv_vlist_bind_cb_t bind_cb;
+    lv_vlist_row_t * rows;      /**< Item `i` is always on `rows[i % row_cnt]` */
+    uint32_t row_cnt;
+    uint32_t item_cnt;
+    int32_t item_h;
+    uint32_t overscan;
+};
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_VLIST*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_VLIST_PRIVATE_H*/
@@ -50,6 +50,7 @@
 #define LV_USE_PERF_MONITOR         1
 #define LV_USE_MEM_MONITOR          1
 #define LV_LABEL_TEXT_SELECTION     1
+#define LV_CHART_STREAM_BUF_MAX_SIZE    (256 * 1024)
 
 #define LV_USE_CALENDAR_CHINESE 1
 #define LV_USE_LOTTIE 1
@@ -69,6 +70,8 @@
 #endif
 #define LV_USE_FS_MEMFS     1
 #define LV_FS_MEMFS_LETTER  'M'
+#define LV_FS_BLOCK_CACHE_SIZE (4 * 1024)
+#define LV_FS_BLOCK_CACHE_BLOCK_SIZE 128
 
 #define LV_USE_MONKEY       1
 #define LV_USE_RLE          1
@@ -121,6 +124,7 @@
 #define LV_USE_OBJ_ID_BUILTIN   1
 
 #define LV_CACHE_DEF_SIZE       (10 * 1024 * 1024)
+#define LV_USE_IMAGE_DECODER_ASYNC  1
 
 #ifndef LV_USE_LINUX_DRM
     #define LV_USE_LINUX_DRM    1
@@ -161,5 +165,6 @@
 #define LV_USE_FONT_MANAGER 1
 
 #define LV_USE_DRAW_SW_COMPLEX_GRADIENTS    1
+#define LV_DRAW_SW_BLEND_SPECIALIZE_RGB565  1
 
 #endif /* LV_TEST_CONF_FULL_H */
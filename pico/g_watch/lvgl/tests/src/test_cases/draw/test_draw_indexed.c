@@ -0,0 +1,168 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "lv_test_helpers.h"
+
+#include "unity/unity.h"
+
+#define IMG_W       37
+#define IMG_H       9
+#define CANVAS_W    64
+#define CANVAS_H    16
+
+static LV_ATTRIBUTE_MEM_ALIGN uint8_t img_data[256 * sizeof(lv_color32_t) + IMG_W * IMG_H];
+static LV_ATTRIBUTE_MEM_ALIGN uint8_t argb_data[IMG_W * IMG_H * 4];
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Create an indexed image with a pseudo random pattern and the same image as ARGB8888*/
+static void create_images(lv_image_dsc_t * img_indexed, lv_image_dsc_t * img_argb, lv_color_format_t cf,
+                          bool transp)
+{
+    uint32_t bpp = lv_color_format_get_bpp(cf);
+    uint32_t palette_size = LV_COLOR_INDEXED_PALETTE_SIZE(cf);
+    uint32_t stride = (IMG_W * bpp + 7) / 8;
+    lv_color32_t * palette = (lv_color32_t *)img_data;
+    uint8_t * indices = img_data + palette_size * sizeof(lv_color32_t);
+    uint32_t i;
+
+    /*The same descriptors are reused with other formats*/
+    lv_image_cache_drop(img_indexed);
+    lv_image_header_cache_drop(img_indexed);
+    lv_image_cache_drop(img_argb);
+
+    for(i = 0; i < palette_size; i++) {
+        palette[i].red = (uint8_t)(i * 97 + 13);
+        palette[i].green = (uint8_t)(i * 59 + 200);
+        palette[i].blue = (uint8_t)(i * 31 + 77);
+        palette[i].alpha = transp ? (uint8_t)(i * 71) : 0xff;
+    }
+
+    lv_memzero(indices, stride * IMG_H);
+    uint32_t seed = 1;
+    int32_t x, y;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < IMG_W; x++) {
+            seed = seed * 1103515245 + 12345;
+            uint32_t idx = (seed >> 16) & (palette_size - 1);
+            uint32_t bit = x * bpp;
+            indices[y * stride + bit / 8] |= idx << (8 - bpp - bit % 8);
+            lv_color32_t * argb = (lv_color32_t *)&argb_data[(y * IMG_W + x) * 4];
+            *argb = palette[idx];
+        }
+    }
+
+    lv_memzero(img_indexed, sizeof(*img_indexed));
+    img_indexed->header.magic = LV_IMAGE_HEADER_MAGIC;
+    img_indexed->header.cf = cf;
+    img_indexed->header.w = IMG_W;
+    img_indexed->header.h = IMG_H;
+    img_indexed->header.stride = stride;
+    img_indexed->data = img_data;
+    img_indexed->data_size = palette_size * sizeof(lv_color32_t) + stride * IMG_H;
+
+    lv_memzero(img_argb, sizeof(*img_argb));
+    img_argb->header.magic = LV_IMAGE_HEADER_MAGIC;
+    img_argb->header.cf = LV_COLOR_FORMAT_ARGB8888;
+    img_argb->header.w = IMG_W;
+    img_argb->header.h = IMG_H;
+    img_argb->header.stride = IMG_W * 4;
+    img_argb->data = argb_data;
+    img_argb->data_size = sizeof(argb_data);
+}
+
+/*Draw the image to an RGB565 canvas at several x positions, partly out of the canvas on the left*/
+static void render(lv_obj_t * canvas, const lv_image_dsc_t * img, lv_opa_t opa, lv_blend_mode_t blend_mode)
+{
+    lv_canvas_fill_bg(canvas, lv_color_hex(0x406080), LV_OPA_COVER);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.src = img;
+    dsc.opa = opa;
+    dsc.blend_mode = blend_mode;
+
+    int32_t ofs;
+    for(ofs = 0; ofs < 8; ofs++) {
+        lv_area_t coords = {-ofs, 0, -ofs + IMG_W - 1, IMG_H - 1};
+        if(ofs & 1) lv_area_move(&coords, 2 * ofs + 20, CANVAS_H - IMG_H);
+        lv_draw_image(&layer, &dsc, &coords);
+    }
+
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+void test_draw_indexed_same_as_argb8888(void)
+{
+    static const lv_color_format_t cfs[] = {
+        LV_COLOR_FORMAT_I1, LV_COLOR_FORMAT_I2, LV_COLOR_FORMAT_I4, LV_COLOR_FORMAT_I8
+    };
+    static const lv_blend_mode_t blend_modes[] = {
+        LV_BLEND_MODE_NORMAL, LV_BLEND_MODE_ADDITIVE, LV_BLEND_MODE_SUBTRACTIVE, LV_BLEND_MODE_MULTIPLY
+    };
+    static const lv_opa_t opas[] = {LV_OPA_COVER, LV_OPA_50};
+
+    LV_DRAW_BUF_DEFINE_STATIC(buf_indexed, CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_RGB565);
+    LV_DRAW_BUF_DEFINE_STATIC(buf_argb, CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_RGB565);
+    LV_DRAW_BUF_INIT_STATIC(buf_indexed);
+    LV_DRAW_BUF_INIT_STATIC(buf_argb);
+
+    lv_obj_t * canvas_indexed = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas_indexed, &buf_indexed);
+    lv_obj_t * canvas_argb = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas_argb, &buf_argb);
+
+    static lv_image_dsc_t img_indexed;
+    static lv_image_dsc_t img_argb;
+    uint32_t c, t, b, o;
+    for(c = 0; c < sizeof(cfs) / sizeof(cfs[0]); c++) {
+        for(t = 0; t < 2; t++) {
+            create_images(&img_indexed, &img_argb, cfs[c], t);
+            for(b = 0; b < sizeof(blend_modes) / sizeof(blend_modes[0]); b++) {
+                for(o = 0; o < sizeof(opas) / sizeof(opas[0]); o++) {
+                    render(canvas_indexed, &img_indexed, opas[o], blend_modes[b]);
+                    render(canvas_argb, &img_argb, opas[o], blend_modes[b]);
+
+                    char msg[64];
+                    lv_snprintf(msg, sizeof(msg), "cf %d, transp %d, blend mode %d, opa %d",
+                                cfs[c], t, blend_modes[b], opas[o]);
+                    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(buf_argb.data, buf_indexed.data, buf_argb.data_size, msg);
+                }
+            }
+        }
+    }
+}
+
+void test_draw_indexed_used_in_place(void)
+{
+    static lv_image_dsc_t img_indexed;
+    static lv_image_dsc_t img_argb;
+    create_images(&img_indexed, &img_argb, LV_COLOR_FORMAT_I4, false);
+
+    /*Opened like the SW renderer does for RGB565 targets: no conversion, no allocation for the pixels*/
+    size_t heap_before = lv_test_get_free_mem();
+    lv_image_decoder_args_t args;
+    lv_memzero(&args, sizeof(args));
+    args.use_indexed = true;
+    lv_image_decoder_dsc_t decoder_dsc;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&decoder_dsc, &img_indexed, &args));
+    TEST_ASSERT_NOT_NULL(decoder_dsc.decoded);
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_I4, decoder_dsc.decoded->header.cf);
+    TEST_ASSERT_EQUAL_PTR(img_data, decoder_dsc.decoded->data);
+    TEST_ASSERT_LESS_THAN(IMG_W * IMG_H, heap_before - lv_test_get_free_mem());
+    lv_image_decoder_close(&decoder_dsc);
+}
+
+#endif
@@ -0,0 +1,266 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "lv_test_helpers.h"
+
+#include "unity/unity.h"
+#include <unistd.h>
+
+#define IMG_LOGO    "A:src/test_assets/test_img_lvgl_logo.png"
+#define IMG_EMOJI   "A:src/test_assets/test_img_emoji_F600.png"
+#define IMG_ARC     "A:src/test_assets/test_arc_bg.png"
+#define IMG_PALETTE "A:src/test_assets/test_img_lvgl_logo_8bit_palette.png"
+
+static lv_area_t inv_area;
+static uint32_t inv_cnt;
+
+void setUp(void)
+{
+    /* Function run before every test */
+    lv_image_cache_drop(NULL);
+    lv_image_decoder_async_set_enabled(true);
+    lv_image_decoder_async_set_placeholder(lv_color_hex(0xff0000), LV_OPA_COVER);
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_image_decoder_async_set_enabled(false);
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(NULL);
+}
+
+static bool is_cached(const char * src)
+{
+    lv_image_cache_data_t search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.src = src;
+    search_key.src_type = LV_IMAGE_SRC_FILE;
+
+    lv_cache_entry_t * entry = lv_cache_acquire(LV_GLOBAL_DEFAULT()->img_cache, &search_key, NULL);
+    if(entry == NULL) return false;
+    lv_cache_release(LV_GLOBAL_DEFAULT()->img_cache, entry, NULL);
+    return true;
+}
+
+static lv_color32_t get_px(int32_t x, int32_t y)
+{
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    return *(lv_color32_t *)lv_draw_buf_goto_xy(buf, x, y);
+}
+
+/*Wait until the requests are decoded and handled in the timer*/
+static void finish_decoding(void)
+{
+    do {
+#if LV_USE_OS
+        usleep(1000);
+#endif
+        lv_test_wait(LV_DEF_REFR_PERIOD);
+    } while(lv_image_decoder_async_get_pending_count());
+#if LV_USE_OS
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+#endif
+}
+
+static void invalidate_area_cb(lv_event_t * e)
+{
+    lv_area_t * area = lv_event_get_param(e);
+    if(inv_cnt == 0) inv_area = *area;
+    else lv_area_join(&inv_area, &inv_area, area);
+    inv_cnt++;
+}
+
+void test_image_decoder_async_placeholder_then_image(void)
+{
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, IMG_LOGO);
+    lv_obj_set_pos(img, 30, 20);
+    lv_refr_now(NULL);
+
+    /*The placeholder is drawn and the image is requested*/
+#if LV_USE_OS == LV_OS_NONE
+    TEST_ASSERT_EQUAL_UINT32(1, lv_image_decoder_async_get_pending_count());
+    TEST_ASSERT_FALSE(is_cached(IMG_LOGO));
+#endif
+    lv_color32_t px = get_px(30 + 52, 20 + 20);
+    TEST_ASSERT_EQUAL_HEX8(0xff, px.red);
+    TEST_ASSERT_EQUAL_HEX8(0x00, px.green);
+
+    /*Decoded: only the area of the image is invalidated and the image is drawn*/
+    lv_display_add_event_cb(lv_display_get_default(), invalidate_area_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    inv_cnt = 0;
+    finish_decoding();
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), invalidate_area_cb, NULL);
+
+    TEST_ASSERT_EQUAL_UINT32(0, lv_image_decoder_async_get_pending_count());
+    TEST_ASSERT_TRUE(is_cached(IMG_LOGO));
+    TEST_ASSERT_EQUAL_UINT32(1, inv_cnt);
+    lv_area_t coords;
+    lv_obj_get_coords(img, &coords);
+    TEST_ASSERT_EQUAL_INT32(coords.x1, inv_area.x1);
+    TEST_ASSERT_EQUAL_INT32(coords.y1, inv_area.y1);
+    TEST_ASSERT_EQUAL_INT32(coords.x2, inv_area.x2);
+    TEST_ASSERT_EQUAL_INT32(coords.y2, inv_area.y2);
+
+    /*Same pixels as decoding while drawing*/
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    static uint8_t async_rows[40][105 * 4];
+    int32_t y;
+    for(y = 0; y < 40; y++) {
+        lv_memcpy(async_rows[y], lv_draw_buf_goto_xy(buf, 30, 20 + y), sizeof(async_rows[y]));
+    }
+
+    lv_image_decoder_async_set_enabled(false);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    for(y = 0; y < 40; y++) {
+        TEST_ASSERT_EQUAL_MEMORY(async_rows[y], lv_draw_buf_goto_xy(buf, 30, 20 + y), sizeof(async_rows[y]));
+    }
+}
+
+void test_image_decoder_async_prefetch_priority(void)
+{
+#if LV_USE_OS
+    TEST_PASS_MESSAGE("The order depends on the timing of the decoder thread");
+#else
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_async_prefetch(IMG_ARC, LV_IMAGE_DECODER_ASYNC_PRIO_LOW));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_async_prefetch(IMG_EMOJI, LV_IMAGE_DECODER_ASYNC_PRIO_NORMAL));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_async_prefetch(IMG_PALETTE, LV_IMAGE_DECODER_ASYNC_PRIO_HIGH));
+    TEST_ASSERT_EQUAL_UINT32(3, lv_image_decoder_async_get_pending_count());
+
+    /*Without OS one image is decoded per timer period, the highest priority first*/
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+    TEST_ASSERT_TRUE(is_cached(IMG_PALETTE));
+    TEST_ASSERT_FALSE(is_cached(IMG_EMOJI));
+    TEST_ASSERT_FALSE(is_cached(IMG_ARC));
+
+    /*Prefetching again raises the priority*/
+    lv_image_decoder_async_prefetch(IMG_ARC, LV_IMAGE_DECODER_ASYNC_PRIO_HIGH);
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+    TEST_ASSERT_TRUE(is_cached(IMG_ARC));
+    TEST_ASSERT_FALSE(is_cached(IMG_EMOJI));
+
+    lv_test_wait(LV_DEF_REFR_PERIOD);
+    TEST_ASSERT_TRUE(is_cached(IMG_EMOJI));
+    TEST_ASSERT_EQUAL_UINT32(0, lv_image_decoder_async_get_pending_count());
+#endif
+}
+
+void test_image_decoder_async_prefetch_obj(void)
+{
+    /*A screen which is not loaded yet*/
+    lv_obj_t * scr = lv_obj_create(NULL);
+    lv_obj_set_style_bg_image_src(scr, IMG_ARC, 0);
+    lv_obj_t * cont = lv_obj_create(scr);
+    lv_obj_t * img = lv_image_create(cont);
+    lv_image_set_src(img, IMG_EMOJI);
+
+    lv_image_decoder_async_prefetch_obj(scr, LV_IMAGE_DECODER_ASYNC_PRIO_NORMAL);
+#if LV_USE_OS == LV_OS_NONE
+    TEST_ASSERT_EQUAL_UINT32(2, lv_image_decoder_async_get_pending_count());
+#endif
+
+    finish_decoding();
+    TEST_ASSERT_TRUE(is_cached(IMG_ARC));
+    TEST_ASSERT_TRUE(is_cached(IMG_EMOJI));
+
+    /*Already in the cache: drawn without placeholder at once*/
+    lv_screen_load(scr);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_image_decoder_async_get_pending_count());
+
+    lv_obj_t * scr_old = lv_obj_create(NULL);
+    lv_screen_load(scr_old);
+    lv_obj_delete(scr);
+}
+
+void test_image_decoder_async_preview(void)
+{
+    static const uint16_t preview_px[4] = {0x07e0, 0x07e0, 0x07e0, 0x07e0};
+    static const lv_image_dsc_t preview = {
+        .header.magic = LV_IMAGE_HEADER_MAGIC,
+        .header.cf = LV_COLOR_FORMAT_RGB565,
+        .header.w = 2,
+        .header.h = 2,
+        .header.stride = 4,
+        .data = (const uint8_t *)preview_px,
+        .data_size = sizeof(preview_px),
+    };
+
+    lv_image_decoder_async_set_preview(IMG_EMOJI, &preview);
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, IMG_EMOJI);
+    lv_refr_now(NULL);
+
+    /*The preview is scaled to the size of the image*/
+    lv_color32_t px = get_px(36, 36);
+    TEST_ASSERT_EQUAL_HEX8(0x00, px.red);
+    TEST_ASSERT_EQUAL_HEX8(0xff, px.green);
+    px = get_px(60, 60);
+    TEST_ASSERT_EQUAL_HEX8(0xff, px.green);
+
+    lv_image_decoder_async_set_preview(IMG_EMOJI, NULL);
+}
+
+static uint32_t failing_open_cnt;
+static const lv_image_dsc_t failing_img = {
+    .header.magic = LV_IMAGE_HEADER_MAGIC,
+    .header.cf = LV_COLOR_FORMAT_RAW,
+    .header.w = 20,
+    .header.h = 20,
+    .data = (const uint8_t *)"not an image",
+    .data_size = 12,
+};
+
+static lv_result_t failing_info_cb(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc,
+                                   lv_image_header_t * header)
+{
+    LV_UNUSED(decoder);
+    if(dsc->src != &failing_img) return LV_RESULT_INVALID;
+    *header = failing_img.header;
+    return LV_RESULT_OK;
+}
+
+static lv_result_t failing_open_cb(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
+{
+    LV_UNUSED(decoder);
+    LV_UNUSED(dsc);
+    failing_open_cnt++;
+    return LV_RESULT_INVALID;
+}
+
+void test_image_decoder_async_failed_not_requested_again(void)
+{
+    lv_image_decoder_t * decoder = lv_image_decoder_create();
+    lv_image_decoder_set_info_cb(decoder, failing_info_cb);
+    lv_image_decoder_set_open_cb(decoder, failing_open_cb);
+    decoder->name = "failing";
+
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, &failing_img);
+    failing_open_cnt = 0;
+    lv_refr_now(NULL);
+#if LV_USE_OS == LV_OS_NONE
+    TEST_ASSERT_EQUAL_UINT32(1, lv_image_decoder_async_get_pending_count());
+    TEST_ASSERT_EQUAL_UINT32(0, failing_open_cnt);
+#endif
+
+    /*Failed in the background: drawn (and failing) as usual from now on*/
+    finish_decoding();
+    TEST_ASSERT_EQUAL_UINT32(0, lv_image_decoder_async_get_pending_count());
+    TEST_ASSERT_EQUAL_UINT32(2, failing_open_cnt);
+    lv_color32_t px = get_px(10, 10);
+    lv_color_t bg_color = lv_obj_get_style_bg_color(lv_screen_active(), LV_PART_MAIN);
+    TEST_ASSERT_EQUAL_HEX8(bg_color.red, px.red);
+
+    lv_obj_invalidate(img);
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_image_decoder_async_get_pending_count());
+    TEST_ASSERT_EQUAL_UINT32(3, failing_open_cnt);
+
+    lv_obj_delete(img);
+    lv_image_decoder_delete(decoder);
+}
+
+#endif
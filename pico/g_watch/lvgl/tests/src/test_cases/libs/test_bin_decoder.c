@@ -4,6 +4,13 @@
 
 #include "unity/unity.h"
 
+#include <stdio.h>
+#include <string.h>
+
+#define BAND_HEIGHT     16
+#define BAND_FILE       "band_test.bin"
+#define RAW_FILE        "band_test_raw.bin"
+
 void setUp(void)
 {
     /* Function run before every test */
@@ -89,4 +96,165 @@ void test_bin_decoder_argb8888_tile(void)
     bin_decoder_tile(&test_image_cogwheel_argb8888, "libs/bin_decoder_4.png");
 }
 
+/*Create a copy of `src` with every BAND_HEIGHT rows RLE compressed independently*/
+static lv_image_dsc_t * create_banded(const lv_image_dsc_t * src)
+{
+    uint32_t stride = src->header.stride;
+    uint32_t h = src->header.h;
+    uint32_t blk = lv_color_format_get_bpp(src->header.cf) / 8;
+    uint32_t band_cnt = (h + BAND_HEIGHT - 1) / BAND_HEIGHT;
+    uint32_t table_size = (band_cnt + 1) * 4;
+
+    /*At worst RLE adds a control byte to every block*/
+    uint8_t * data = lv_malloc(12 + table_size + stride * h * 2);
+    TEST_ASSERT_NOT_NULL(data);
+
+    uint32_t * table = (uint32_t *)(data + 12);
+    uint32_t ofs = table_size;
+    for(uint32_t b = 0; b < band_cnt; b++) {
+        uint32_t rows = LV_MIN(BAND_HEIGHT, h - b * BAND_HEIGHT);
+        table[b] = ofs;
+        ofs += lv_rle_compress(src->data + b * BAND_HEIGHT * stride, rows * stride, data + 12 + ofs,
+                               rows * stride * 2, blk);
+    }
+    table[band_cnt] = ofs;
+
+    uint32_t compressed_header[3] = {LV_IMAGE_COMPRESS_RLE | BAND_HEIGHT << 4, ofs, stride * h};
+    memcpy(data, compressed_header, sizeof(compressed_header));
+
+    lv_image_dsc_t * img = lv_malloc_zeroed(sizeof(lv_image_dsc_t));
+    TEST_ASSERT_NOT_NULL(img);
+    img->header = src->header;
+    img->header.flags |= LV_IMAGE_FLAGS_COMPRESSED;
+    img->data = data;
+    img->data_size = 12 + ofs;
+    return img;
+}
+
+static void delete_banded(lv_image_dsc_t * img)
+{
+    lv_image_cache_drop(img);
+    lv_image_header_cache_drop(img);
+    lv_free((void *)img->data);
+    lv_free(img);
+}
+
+void test_bin_decoder_banded_argb8888(void)
+{
+    LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+    lv_image_dsc_t * img = create_banded(&test_image_cogwheel_argb8888);
+    TEST_ASSERT_LESS_THAN(test_image_cogwheel_argb8888.data_size, img->data_size);
+
+    bin_decoder(img, "libs/bin_decoder_3.png");
+    bin_decoder_tile(img, "libs/bin_decoder_4.png");
+
+    delete_banded(img);
+}
+
+void test_bin_decoder_banded_get_area(void)
+{
+    LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+    const lv_image_dsc_t * src = &test_image_cogwheel_argb8888;
+    lv_image_dsc_t * img = create_banded(src);
+    uint32_t stride = src->header.stride;
+
+    lv_image_decoder_dsc_t dsc;
+    lv_image_decoder_args_t args = { 0 };
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_open(&dsc, img, &args));
+    /*Nothing is decompressed on open*/
+    TEST_ASSERT_NULL(dsc.decoded);
+
+    /*Rows 20..29 are in the 2nd band only*/
+    size_t mem_before = lv_test_get_free_mem();
+    lv_area_t full_area = {10, 20, 50, 29};
+    lv_area_t decoded_area = {LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN};
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_image_decoder_get_area(&dsc, &full_area, &decoded_area));
+    TEST_ASSERT_EQUAL(0, decoded_area.x1);
+    TEST_ASSERT_EQUAL(src->header.w - 1, decoded_area.x2);
+    TEST_ASSERT_EQUAL(BAND_HEIGHT, decoded_area.y1);
+    TEST_ASSERT_EQUAL(2 * BAND_HEIGHT - 1, decoded_area.y2);
+    TEST_ASSERT_EQUAL_MEMORY(src->data + BAND_HEIGHT * stride, dsc.decoded->data, BAND_HEIGHT * stride);
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_get_area(&dsc, &full_area, &decoded_area));
+
+    /*Only one band is allocated*/
+    TEST_ASSERT_LESS_OR_EQUAL(BAND_HEIGHT * stride + 1024, mem_before - lv_test_get_free_mem());
+
+    /*All rows, the last band is shorter*/
+    lv_area_set(&full_area, 0, 0, src->header.w - 1, src->header.h - 1);
+    lv_area_set(&decoded_area, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN);
+    uint32_t y = 0;
+    while(lv_image_decoder_get_area(&dsc, &full_area, &decoded_area) == LV_RESULT_OK) {
+        TEST_ASSERT_EQUAL(y, decoded_area.y1);
+        uint32_t rows = lv_area_get_height(&decoded_area);
+        TEST_ASSERT_EQUAL(rows, dsc.decoded->header.h);
+        TEST_ASSERT_EQUAL_MEMORY(src->data + y * stride, dsc.decoded->data, rows * stride);
+        y += rows;
+    }
+    TEST_ASSERT_EQUAL(src->header.h, y);
+
+    lv_image_decoder_close(&dsc);
+    delete_banded(img);
+}
+
+static void write_image_file(const char * path, const lv_image_header_t * header, const void * data, uint32_t size)
+{
+    FILE * f = fopen(path, "wb");
+    TEST_ASSERT_NOT_NULL(f);
+    fwrite(header, 1, sizeof(lv_image_header_t), f);
+    fwrite(data, 1, size, f);
+    fclose(f);
+}
+
+static lv_draw_buf_t * render_image(const void * src)
+{
+    create_image(src);
+    lv_draw_buf_t * snapshot = lv_snapshot_take(lv_screen_active(), LV_COLOR_FORMAT_XRGB8888);
+    TEST_ASSERT_NOT_NULL(snapshot);
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(src);
+    lv_image_header_cache_drop(src);
+    return snapshot;
+}
+
+void test_bin_decoder_banded_file(void)
+{
+    LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+    const lv_image_dsc_t * src = &test_image_cogwheel_argb8888;
+    lv_image_dsc_t * img = create_banded(src);
+
+    /*Files are drawn line by line, so compare with the same image stored uncompressed*/
+    write_image_file(BAND_FILE, &img->header, img->data, img->data_size);
+    write_image_file(RAW_FILE, &src->header, src->data, src->data_size);
+
+    lv_draw_buf_t * expected = render_image("A:" RAW_FILE);
+    size_t mem_before = lv_test_get_free_mem();
+    lv_draw_buf_t * actual = render_image("A:" BAND_FILE);
+    TEST_ASSERT_EQUAL(expected->data_size, actual->data_size);
+    TEST_ASSERT_EQUAL_MEMORY(expected->data, actual->data, expected->data_size);
+    lv_draw_buf_destroy(actual);
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
+    lv_draw_buf_destroy(expected);
+
+    remove(BAND_FILE);
+    remove(RAW_FILE);
+    delete_banded(img);
+}
+
+void test_bin_decoder_banded_invalid(void)
+{
+    LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+    lv_image_dsc_t * img = create_banded(&test_image_cogwheel_argb8888);
+
+    /*The last offset must be the end of the compressed data*/
+    uint32_t * table = (uint32_t *)(img->data + 12);
+    uint32_t band_cnt = (img->header.h + BAND_HEIGHT - 1) / BAND_HEIGHT;
+    table[band_cnt]--;
+
+    lv_image_decoder_dsc_t dsc;
+    lv_image_decoder_args_t args = { 0 };
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_image_decoder_open(&dsc, img, &args));
+
+    delete_banded(img);
+}
+
 #endif
@@ -0,0 +1,158 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define GIF_BULB "A:../examples/libs/gif/bulb.gif"
+
+static lv_area_t inv_area;
+static uint32_t inv_cnt;
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    /* Function run after every test */
+    lv_obj_clean(lv_screen_active());
+}
+
+static void invalidate_area_cb(lv_event_t * e)
+{
+    lv_area_t * area = lv_event_get_param(e);
+    if(inv_cnt == 0) inv_area = *area;
+    else lv_area_join(&inv_area, &inv_area, area);
+    inv_cnt++;
+}
+
+/*Show the next frame regardless of the delay*/
+static void step_frame(lv_obj_t * obj)
+{
+    lv_gif_t * gifobj = (lv_gif_t *)obj;
+    gifobj->last_call = lv_tick_get() - 60000;
+    lv_timer_ready(gifobj->timer);
+    lv_timer_handler();
+}
+
+void test_gif_invalidate_changed_area(void)
+{
+    lv_obj_t * obj = lv_gif_create(lv_screen_active());
+    lv_gif_set_src(obj, GIF_BULB);
+    lv_obj_set_pos(obj, 10, 20);
+    lv_refr_now(NULL);
+
+    gd_GIF * gif = ((lv_gif_t *)obj)->gif;
+    lv_display_add_event_cb(lv_display_get_default(), invalidate_area_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+    inv_cnt = 0;
+    step_frame(obj);
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), invalidate_area_cb, NULL);
+
+    /*Only the changed part of the second frame is redrawn*/
+    TEST_ASSERT_EQUAL_INT32(2, gif->frame_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, inv_cnt);
+    TEST_ASSERT_EQUAL_INT32(10 + gif->cx, inv_area.x1);
+    TEST_ASSERT_EQUAL_INT32(20 + gif->cy, inv_area.y1);
+    TEST_ASSERT_EQUAL_INT32(gif->cw, lv_area_get_width(&inv_area));
+    TEST_ASSERT_EQUAL_INT32(gif->ch, lv_area_get_height(&inv_area));
+    TEST_ASSERT_LESS_THAN_UINT32(gif->width * gif->height, lv_area_get_size(&inv_area));
+    lv_refr_now(NULL);
+
+    /*Same pixels as redrawing the whole image*/
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    static uint8_t rows[80][60 * 4];
+    int32_t y;
+    for(y = 0; y < gif->height; y++) {
+        lv_memcpy(rows[y], lv_draw_buf_goto_xy(buf, 10, 20 + y), gif->width * 4);
+    }
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    for(y = 0; y < gif->height; y++) {
+        TEST_ASSERT_EQUAL_MEMORY(rows[y], lv_draw_buf_goto_xy(buf, 10, 20 + y), gif->width * 4);
+    }
+}
+
+void test_gif_frame_cache(void)
+{
+    lv_obj_t * obj = lv_gif_create(lv_screen_active());
+    lv_gif_set_src(obj, GIF_BULB);
+    lv_gif_set_loop_count(obj, 0);
+    lv_gif_set_frame_cache_size(obj, 512 * 1024);
+
+    gd_GIF * gif = ((lv_gif_t *)obj)->gif;
+    uint32_t canvas_size = gif->width * gif->height * 4;
+
+    /*The reference decodes every frame*/
+    gd_GIF * ref = gd_open_gif_file(GIF_BULB);
+    TEST_ASSERT_NOT_NULL(ref);
+    gd_get_frame(ref);
+    gd_render_frame(ref, ref->canvas);
+
+    /*Recorded during the first loop*/
+    uint32_t frame_cnt = 1;
+    while(!lv_gif_is_frame_cache_complete(obj)) {
+        TEST_ASSERT_LESS_THAN_UINT32(200, frame_cnt);
+        step_frame(obj);
+        gd_get_frame(ref);
+        gd_render_frame(ref, ref->canvas);
+        frame_cnt++;
+    }
+    TEST_ASSERT_EQUAL_UINT32(114, frame_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(ref->canvas, gif->canvas, canvas_size);
+
+    /*Played from the cache without decoding*/
+    uint32_t i;
+    for(i = 0; i < 2 * 113; i++) {
+        step_frame(obj);
+        gd_get_frame(ref);
+        gd_render_frame(ref, ref->canvas);
+        TEST_ASSERT_EQUAL_INT32(1, gif->frame_cnt);
+        TEST_ASSERT_EQUAL_MEMORY(ref->canvas, gif->canvas, canvas_size);
+    }
+
+    /*Restarted from the whole first frame*/
+    static uint8_t first_frame[60 * 80 * 4];
+    lv_memcpy(first_frame, gif->canvas, canvas_size);
+    for(i = 0; i < 5; i++) {
+        step_frame(obj);
+    }
+    lv_gif_restart(obj);
+    step_frame(obj);
+    TEST_ASSERT_EQUAL_MEMORY(first_frame, gif->canvas, canvas_size);
+    TEST_ASSERT_EQUAL_INT32(1, gif->frame_cnt);
+
+    /*Decoded again from the first frame if the cache is disabled*/
+    lv_gif_set_frame_cache_size(obj, 0);
+    step_frame(obj);
+    TEST_ASSERT_EQUAL_INT32(1, gif->frame_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(ref->canvas, gif->canvas, canvas_size);
+    step_frame(obj);
+    gd_get_frame(ref);
+    gd_render_frame(ref, ref->canvas);
+    TEST_ASSERT_EQUAL_INT32(2, gif->frame_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(ref->canvas, gif->canvas, canvas_size);
+
+    gd_close_gif(ref);
+}
+
+void test_gif_frame_cache_over_budget(void)
+{
+    lv_obj_t * obj = lv_gif_create(lv_screen_active());
+    lv_gif_set_src(obj, GIF_BULB);
+    lv_gif_set_loop_count(obj, 0);
+    lv_gif_set_frame_cache_size(obj, 1024);
+
+    uint32_t i;
+    for(i = 0; i < 2 * 113; i++) {
+        step_frame(obj);
+    }
+
+    /*Still decoded frame by frame*/
+    TEST_ASSERT_FALSE(lv_gif_is_frame_cache_complete(obj));
+    TEST_ASSERT_EQUAL_INT32(i % 113 + 1, ((lv_gif_t *)obj)->gif->frame_cnt);
+}
+
+#endif
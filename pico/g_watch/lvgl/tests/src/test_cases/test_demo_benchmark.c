@@ -0,0 +1,122 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+#include "../demos/lv_demos.h"
+
+#include "unity/unity.h"
+
+#include "lv_test_helpers.h"
+
+#include <string.h>
+
+#define SCENE_CNT   16
+
+static char report[256 * 1024];
+static uint32_t report_len;
+static uint32_t fake_us;
+
+void setUp(void)
+{
+    report_len = 0;
+    report[0] = '\0';
+    fake_us = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_USE_DEMO_BENCHMARK
+
+static uint32_t fake_time_us_cb(void)
+{
+    /*Every measurement point is 1 us later than the previous*/
+    return fake_us++;
+}
+
+static void write_cb(const char * str, void * user_data)
+{
+    LV_UNUSED(user_data);
+    size_t len = lv_strlen(str);
+    TEST_ASSERT_LESS_THAN(sizeof(report), report_len + len + 1);
+    lv_memcpy(&report[report_len], str, len + 1);
+    report_len += len;
+}
+
+static uint32_t count_str(const char * haystack, const char * needle)
+{
+    uint32_t cnt = 0;
+    const char * p = haystack;
+    while((p = strstr(p, needle)) != NULL) {
+        cnt++;
+        p++;
+    }
+    return cnt;
+}
+
+static void cfg_init(lv_demo_benchmark_headless_cfg_t * cfg, lv_demo_benchmark_output_t format)
+{
+    lv_demo_benchmark_headless_cfg_init(cfg);
+    cfg->frame_cnt = 4;
+    cfg->warmup_frame_cnt = 2;
+    cfg->format = format;
+    cfg->time_us_cb = fake_time_us_cb;
+    cfg->write_cb = write_cb;
+}
+
+#endif /*LV_USE_DEMO_BENCHMARK*/
+
+void test_demo_benchmark_headless_invalid_cfg(void)
+{
+#if LV_USE_DEMO_BENCHMARK
+    lv_demo_benchmark_headless_cfg_t cfg;
+    lv_demo_benchmark_headless_cfg_init(&cfg);
+    TEST_ASSERT_EQUAL_UINT32(300, cfg.frame_cnt);
+    TEST_ASSERT_EQUAL(LV_DEMO_BENCHMARK_OUTPUT_JSON, cfg.format);
+
+    /*No callbacks*/
+    TEST_ASSERT_EQUAL(LV_RESULT_INVALID, lv_demo_benchmark_run_headless(&cfg));
+    TEST_ASSERT_EQUAL_UINT32(0, report_len);
+#endif
+}
+
+void test_demo_benchmark_headless_json(void)
+{
+#if LV_USE_DEMO_BENCHMARK
+    lv_draw_unit_t * unit_head = LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+    void * dispatch_cb = (void *)unit_head->dispatch_cb;
+    uint32_t tick = lv_tick_get();
+
+    lv_demo_benchmark_headless_cfg_t cfg;
+    cfg_init(&cfg, LV_DEMO_BENCHMARK_OUTPUT_JSON);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_demo_benchmark_run_headless(&cfg));
+
+    TEST_ASSERT_NOT_NULL(strstr(report, "\"name\": \"Empty screen\""));
+    TEST_ASSERT_NOT_NULL(strstr(report, "\"name\": \"Widgets demo\""));
+    TEST_ASSERT_EQUAL_UINT32(SCENE_CNT, count_str(report, "\"render_us\""));
+    TEST_ASSERT_EQUAL_UINT32(SCENE_CNT, count_str(report, "\"name\": "));
+    TEST_ASSERT_EQUAL_UINT32(SCENE_CNT, count_str(report, "\"frame_cnt\": 4,\n"));
+    TEST_ASSERT_EQUAL_STRING("]\n}\n", &report[report_len - 4]);
+
+    /*The draw units and the tick are restored and the virtual time is not lost*/
+    TEST_ASSERT_EQUAL_PTR(dispatch_cb, (void *)unit_head->dispatch_cb);
+    TEST_ASSERT_GREATER_THAN_UINT32(SCENE_CNT * 6, lv_tick_elaps(tick));
+#endif
+}
+
+void test_demo_benchmark_headless_csv(void)
+{
+#if LV_USE_DEMO_BENCHMARK
+    lv_demo_benchmark_headless_cfg_t cfg;
+    cfg_init(&cfg, LV_DEMO_BENCHMARK_OUTPUT_CSV);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_demo_benchmark_run_headless(&cfg));
+
+    TEST_ASSERT_EQUAL_STRING_LEN("scene,frame,render_us,flush_us,", report, 31);
+    /*Header + one row per measured frame*/
+    TEST_ASSERT_EQUAL_UINT32(1 + SCENE_CNT * 4, count_str(report, "\n"));
+    TEST_ASSERT_EQUAL_UINT32(4, count_str(report, "\"Multiple arcs\","));
+#endif
+}
+
+#endif
@@ -15,6 +15,8 @@ static void read_random_drv(char drv_letter, uint32_t cache_size);
 void setUp(void)
 {
     /* Function run before every test */
+    lv_fs_block_cache_drop(NULL);
+    lv_fs_block_cache_reset_stats();
 }
 
 void tearDown(void)
@@ -274,4 +276,112 @@ void test_write_read_random(void)
     drv->cache_size = original_cache_size;
 }
 
+static void read_whole_file(const char * path, uint32_t chunk_size)
+{
+    lv_fs_file_t f;
+    lv_fs_res_t res = lv_fs_open(&f, path, LV_FS_MODE_RD);
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+
+    uint8_t buf[256];
+    uint32_t cnt = 0;
+    uint32_t br = 1;
+    while(br) {
+        res = lv_fs_read(&f, buf, chunk_size, &br);
+        TEST_ASSERT_EQUAL(LV_FS_RES_OK, res);
+        TEST_ASSERT_TRUE(memcmp(buf, read_exp + cnt, br) == 0);
+        cnt += br;
+    }
+    TEST_ASSERT_EQUAL_UINT32(745, cnt);
+
+    lv_fs_close(&f);
+}
+
+void test_block_cache_read_ahead(void)
+{
+    lv_fs_block_cache_stats_t stats;
+
+    /*'B' has no cache of its own so it uses the 128 byte blocks of the shared cache*/
+    read_whole_file("B:src/test_files/readtest.txt", 79);
+    lv_fs_block_cache_get_stats(&stats);
+
+    /*745 bytes: block 0 + 1 read ahead, then block 2 + 3..5 read ahead*/
+    TEST_ASSERT_EQUAL_UINT32(2, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(4, stats.read_ahead_cnt);
+    TEST_ASSERT_EQUAL_UINT32(6, stats.backing_read_cnt);
+    TEST_ASSERT_EQUAL_UINT32(745, stats.backing_read_bytes);
+
+    /*Reading again doesn't touch the driver*/
+    lv_fs_block_cache_reset_stats();
+    read_whole_file("B:src/test_files/readtest.txt", 50);
+    lv_fs_block_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.backing_read_cnt);
+    TEST_ASSERT_EQUAL_UINT8(100, stats.hit_ratio);
+
+    /*Random reads of the same blocks hit too*/
+    read_random_drv('B', 0);
+    lv_fs_block_cache_get_stats(&stats);
+    TEST_ASSERT_GREATER_THAN_UINT8(90, stats.hit_ratio);
+}
+
+void test_block_cache_write_drops_blocks(void)
+{
+    lv_fs_file_t f;
+    uint8_t buf[16];
+    uint32_t br;
+
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "B:fs_block_cache.bin", LV_FS_MODE_WR));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, "first content", 14, NULL));
+    lv_fs_close(&f);
+
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "B:fs_block_cache.bin", LV_FS_MODE_RD));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), &br));
+    TEST_ASSERT_EQUAL_UINT32(14, br);
+    TEST_ASSERT_EQUAL_STRING("first content", buf);
+    lv_fs_close(&f);
+
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "B:fs_block_cache.bin", LV_FS_MODE_WR));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, "second", 7, NULL));
+    lv_fs_close(&f);
+
+    /*The file is not truncated, only its beginning is overwritten*/
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "B:fs_block_cache.bin", LV_FS_MODE_RD));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, buf, sizeof(buf), &br));
+    TEST_ASSERT_EQUAL_UINT32(14, br);
+    TEST_ASSERT_EQUAL_STRING("second", buf);
+    lv_fs_close(&f);
+}
+
+void test_block_cache_prefetch(void)
+{
+    lv_fs_block_cache_stats_t stats;
+
+    /*Drivers with their own cache are not prefetched*/
+    TEST_ASSERT_EQUAL(LV_FS_RES_NOT_IMP, lv_fs_prefetch("A:src/test_files/readtest.txt", 0, UINT32_MAX));
+
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_prefetch("B:src/test_files/readtest.txt", 0, UINT32_MAX));
+    TEST_ASSERT_EQUAL_UINT32(1, lv_fs_prefetch_get_pending_count());
+    lv_fs_block_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.backing_read_cnt);
+
+    /*A few blocks are read in each timer period*/
+    uint32_t i;
+    for(i = 0; i < 10 && lv_fs_prefetch_get_pending_count(); i++) {
+        lv_tick_inc(LV_DEF_REFR_PERIOD);
+        lv_timer_handler();
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, lv_fs_prefetch_get_pending_count());
+    TEST_ASSERT_GREATER_THAN_UINT32(1, i);
+
+    lv_fs_block_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(6, stats.prefetch_cnt);
+    TEST_ASSERT_EQUAL_UINT32(745, stats.backing_read_bytes);
+
+    lv_fs_block_cache_reset_stats();
+    read_whole_file("B:src/test_files/readtest.txt", 79);
+    lv_fs_block_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.backing_read_cnt);
+    TEST_ASSERT_EQUAL_UINT8(100, stats.hit_ratio);
+}
+
 #endif
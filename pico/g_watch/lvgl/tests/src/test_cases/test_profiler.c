@@ -11,6 +11,8 @@
 static uint32_t profiler_tick = 0;
 static int output_line = 0;
 static char output_buf[OUTPUT_LINE_MAX][OUTPUT_BUF_MAX];
+static uint8_t output_bin[512];
+static uint32_t output_bin_size = 0;
 
 static uint32_t get_tick_cb(void)
 {
@@ -26,6 +28,24 @@ static void flush_cb(const char * buf)
     output_line++;
 }
 
+static void flush_bin_cb(const void * buf, uint32_t size)
+{
+    TEST_ASSERT_LESS_OR_EQUAL(sizeof(output_bin), output_bin_size + size);
+
+    lv_memcpy(output_bin + output_bin_size, buf, size);
+    output_bin_size += size;
+}
+
+static uint32_t get_u32(const uint8_t * buf)
+{
+    return buf[0] | (buf[1] << 8) | (buf[2] << 16) | ((uint32_t)buf[3] << 24);
+}
+
+static uint16_t get_u16(const uint8_t * buf)
+{
+    return (uint16_t)(buf[0] | (buf[1] << 8));
+}
+
 void setUp(void)
 {
     lv_profiler_builtin_config_t config;
@@ -98,4 +118,68 @@ void test_profiler_disable(void)
     TEST_ASSERT_EQUAL_CHAR(output_buf[4][0], '\0');
 }
 
+void test_profiler_binary(void)
+{
+    lv_profiler_builtin_uninit();
+
+    lv_profiler_builtin_config_t config;
+    lv_profiler_builtin_config_init(&config);
+    config.buf_size = 1024;
+    config.tick_per_sec = 1000000;
+    config.tick_get_cb = get_tick_cb;
+    config.flush_bin_cb = flush_bin_cb;
+    lv_profiler_builtin_init(&config);
+
+    /* reset */
+    profiler_tick = 100;
+    output_bin_size = 0;
+
+    /* the same tag is interned only once */
+    LV_PROFILER_BEGIN_TAG("custom_tag");
+    LV_PROFILER_END_TAG("custom_tag");
+    LV_PROFILER_BEGIN_TAG("custom_tag");
+    LV_PROFILER_END_TAG("custom_tag");
+
+    lv_profiler_builtin_flush();
+
+    const uint8_t * p = output_bin;
+
+    /* header */
+    TEST_ASSERT_EQUAL_MEMORY("LVPF", p, 4);
+    TEST_ASSERT_EQUAL_UINT8(1, p[4]);
+    uint32_t item_size = p[5];
+    TEST_ASSERT_TRUE(item_size == 8 || item_size == 12);
+    TEST_ASSERT_EQUAL_UINT32(1000000, get_u32(&p[8]));
+    p += 16;
+
+    /* one string chunk */
+    TEST_ASSERT_EQUAL_CHAR('S', p[0]);
+    TEST_ASSERT_EQUAL_UINT16(0, get_u16(&p[2]));
+    TEST_ASSERT_EQUAL_UINT16(10, get_u16(&p[4]));
+    TEST_ASSERT_EQUAL_MEMORY("custom_tag", &p[6], 10);
+    p += 16;
+
+    /* the items */
+    TEST_ASSERT_EQUAL_CHAR('I', p[0]);
+    TEST_ASSERT_EQUAL_UINT32(4, get_u32(&p[4]));
+    p += 8;
+    for(uint32_t i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL_UINT32(100 + i, get_u32(&p[0]));
+        TEST_ASSERT_EQUAL_UINT16(0, get_u16(&p[4]));
+        TEST_ASSERT_EQUAL_CHAR(i % 2 ? 'E' : 'B', p[6]);
+        p += item_size;
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(p - output_bin, output_bin_size);
+
+    /* the next flush contains only the new items, without header and known strings */
+    output_bin_size = 0;
+    LV_PROFILER_BEGIN_TAG("custom_tag");
+    lv_profiler_builtin_flush();
+
+    TEST_ASSERT_EQUAL_CHAR('I', output_bin[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, get_u32(&output_bin[4]));
+    TEST_ASSERT_EQUAL_UINT32(8 + item_size, output_bin_size);
+}
+
 #endif
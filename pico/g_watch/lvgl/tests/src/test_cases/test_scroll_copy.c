@@ -0,0 +1,236 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * cont;
+static uint8_t * ref_buf;
+static uint32_t scroll_cb_cnt;
+
+static lv_obj_t * create_cont(lv_obj_t * parent)
+{
+    lv_obj_t * c = lv_obj_create(parent);
+    lv_obj_set_size(c, 300, 260);
+    lv_obj_set_pos(c, 40, 30);
+    lv_obj_set_style_radius(c, 12, 0);
+    lv_obj_set_style_border_width(c, 3, 0);
+    lv_obj_set_style_bg_opa(c, LV_OPA_COVER, 0);
+    lv_obj_set_scrollbar_mode(c, LV_SCROLLBAR_MODE_ON);
+    lv_obj_set_flex_flow(c, LV_FLEX_FLOW_ROW_WRAP);
+
+    uint32_t i;
+    for(i = 0; i < 40; i++) {
+        lv_obj_t * item = lv_obj_create(c);
+        lv_obj_set_size(item, 80 + (i % 3) * 20, 50);
+        lv_obj_set_style_bg_color(item, lv_palette_main(i % 19), 0);
+        lv_obj_t * label = lv_label_create(item);
+        lv_label_set_text_fmt(label, "%" LV_PRIu32, i);
+    }
+
+    return c;
+}
+
+static uint32_t get_inv_size(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    uint32_t size = 0;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) size += lv_area_get_size(&disp->inv_areas[i]);
+    return size;
+}
+
+/*The buffer sent to the display last time*/
+static lv_draw_buf_t * get_shown_buf(void)
+{
+    lv_display_t * disp = lv_display_get_default();
+    if(!lv_display_is_double_buffered(disp)) return disp->buf_act;
+    return disp->buf_act == disp->buf_1 ? disp->buf_2 : disp->buf_1;
+}
+
+/*Render the current state with scroll copy and compare it with a full redraw*/
+static void check_render(void)
+{
+    lv_refr_now(NULL);
+    lv_draw_buf_t * buf = get_shown_buf();
+    lv_memcpy(ref_buf, buf->data, buf->data_size);
+
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+    buf = get_shown_buf();
+    TEST_ASSERT_EQUAL_MEMORY(buf->data, ref_buf, buf->data_size);
+}
+
+static bool scroll_cb(lv_display_t * disp, const lv_area_t * area, int32_t dx, int32_t dy)
+{
+    LV_UNUSED(disp);
+    LV_UNUSED(area);
+    LV_UNUSED(dx);
+    TEST_ASSERT_EQUAL_INT32(-25, dy);
+    scroll_cb_cnt++;
+    return true;
+}
+
+void setUp(void)
+{
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    ref_buf = lv_malloc(buf->data_size);
+    TEST_ASSERT_NOT_NULL(ref_buf);
+
+    cont = create_cont(lv_screen_active());
+    lv_refr_now(NULL);
+    lv_display_set_scroll_copy(NULL, true);
+}
+
+void tearDown(void)
+{
+    lv_display_set_scroll_copy(NULL, false);
+    lv_display_set_scroll_cb(NULL, NULL);
+    lv_obj_clean(lv_screen_active());
+    lv_obj_clean(lv_layer_top());
+    lv_free(ref_buf);
+}
+
+void test_scroll_copy_invalidates_only_the_exposed_strip(void)
+{
+    /*While a scroll is in progress (dragging or animation) the state doesn't change*/
+    lv_obj_add_state(cont, LV_STATE_SCROLLED);
+    lv_refr_now(NULL);
+
+    lv_obj_scroll_by_raw(cont, 0, -20);
+    TEST_ASSERT_TRUE(lv_display_get_default()->scroll_copy_pending);
+
+    /*The strip, the border, the corners and the scrollbar instead of the whole object*/
+    TEST_ASSERT_LESS_THAN_UINT32(300 * 260 / 3, get_inv_size());
+    check_render();
+}
+
+void test_scroll_copy_multiple_scrolls(void)
+{
+    /*The offsets are summed until the next refresh*/
+    lv_obj_scroll_by(cont, 0, -30, LV_ANIM_OFF);
+    lv_obj_scroll_by(cont, 0, -17, LV_ANIM_OFF);
+    lv_obj_scroll_by(cont, 0, 9, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_INT32(-38, lv_display_get_default()->scroll_copy_ofs.y);
+    check_render();
+
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN);
+    lv_obj_update_layout(cont);
+    lv_refr_now(NULL);
+    lv_obj_scroll_to_y(cont, 0, LV_ANIM_OFF);
+    lv_refr_now(NULL);
+
+    /*Changes before the scroll are redrawn on their moved place too*/
+    lv_obj_set_style_bg_color(lv_obj_get_child(cont, 2), lv_color_black(), 0);
+    lv_obj_scroll_by(cont, 0, -42, LV_ANIM_OFF);
+    lv_obj_set_style_bg_color(lv_obj_get_child(cont, 5), lv_color_white(), 0);
+    check_render();
+}
+
+void test_scroll_copy_overlays(void)
+{
+    /*Not moving with the content*/
+    lv_obj_t * floating = lv_obj_create(cont);
+    lv_obj_add_flag(floating, LV_OBJ_FLAG_FLOATING);
+    lv_obj_set_size(floating, 60, 60);
+    lv_obj_align(floating, LV_ALIGN_BOTTOM_RIGHT, -10, -10);
+
+    lv_obj_t * sibling = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(sibling, 100, 80);
+    lv_obj_set_pos(sibling, 20, 100);
+
+    lv_obj_t * top = lv_obj_create(lv_layer_top());
+    lv_obj_set_size(top, 100, 40);
+    lv_obj_set_pos(top, 200, 150);
+    lv_refr_now(NULL);
+
+    lv_obj_scroll_by(cont, 0, -25, LV_ANIM_OFF);
+    TEST_ASSERT_TRUE(lv_display_get_default()->scroll_copy_pending);
+    check_render();
+
+    lv_obj_set_flex_flow(cont, LV_FLEX_FLOW_COLUMN_WRAP);
+    lv_obj_update_layout(cont);
+    lv_refr_now(NULL);
+    lv_obj_scroll_by(cont, -33, 0, LV_ANIM_OFF);
+    TEST_ASSERT_TRUE(lv_display_get_default()->scroll_copy_pending);
+    check_render();
+}
+
+void test_scroll_copy_double_buffered(void)
+{
+    /*The moved pixels are copied from the other buffer*/
+    lv_display_t * disp = lv_display_get_default();
+    lv_draw_buf_t * buf_ori = disp->buf_1;
+    lv_draw_buf_t * buf_1 = lv_draw_buf_create(buf_ori->header.w, buf_ori->header.h, buf_ori->header.cf,
+                                               buf_ori->header.stride);
+    lv_draw_buf_t * buf_2 = lv_draw_buf_create(buf_ori->header.w, buf_ori->header.h, buf_ori->header.cf,
+                                               buf_ori->header.stride);
+    lv_display_set_draw_buffers(disp, buf_1, buf_2);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+
+    lv_obj_scroll_by(cont, 0, -20, LV_ANIM_OFF);
+    TEST_ASSERT_TRUE(disp->scroll_copy_pending);
+    check_render();
+
+    /*Both buffers are in sync after the copy*/
+    lv_obj_scroll_by(cont, 0, -31, LV_ANIM_OFF);
+    check_render();
+    lv_obj_scroll_by(cont, 0, 12, LV_ANIM_OFF);
+    check_render();
+
+    lv_display_set_draw_buffers(disp, buf_ori, NULL);
+    lv_draw_buf_destroy(buf_1);
+    lv_draw_buf_destroy(buf_2);
+}
+
+void test_scroll_copy_fallback(void)
+{
+    /*Transparent background: the parent would move with the children*/
+    lv_obj_set_style_bg_opa(cont, LV_OPA_50, 0);
+    lv_refr_now(NULL);
+    lv_obj_scroll_by(cont, 0, -20, LV_ANIM_OFF);
+    TEST_ASSERT_FALSE(lv_display_get_default()->scroll_copy_pending);
+    check_render();
+
+    /*Semi transparent*/
+    lv_obj_set_style_bg_opa(cont, LV_OPA_COVER, 0);
+    lv_obj_set_style_opa(cont, LV_OPA_80, 0);
+    lv_refr_now(NULL);
+    lv_obj_scroll_by(cont, 0, -20, LV_ANIM_OFF);
+    TEST_ASSERT_FALSE(lv_display_get_default()->scroll_copy_pending);
+    check_render();
+
+    /*Drawn on a layer*/
+    lv_obj_set_style_opa(cont, LV_OPA_COVER, 0);
+    lv_obj_set_style_transform_rotation(cont, 10, 0);
+    lv_refr_now(NULL);
+    lv_obj_scroll_by(cont, 0, -20, LV_ANIM_OFF);
+    TEST_ASSERT_FALSE(lv_display_get_default()->scroll_copy_pending);
+    check_render();
+
+    /*Moved out of the area*/
+    lv_obj_set_style_transform_rotation(cont, 0, 0);
+    lv_refr_now(NULL);
+    lv_obj_scroll_by(cont, 0, -300, LV_ANIM_OFF);
+    TEST_ASSERT_FALSE(lv_display_get_default()->scroll_copy_pending);
+    check_render();
+
+    /*Disabled*/
+    lv_display_set_scroll_copy(NULL, false);
+    lv_obj_scroll_by(cont, 0, 20, LV_ANIM_OFF);
+    TEST_ASSERT_FALSE(lv_display_get_default()->scroll_copy_pending);
+    check_render();
+}
+
+void test_scroll_copy_scroll_cb(void)
+{
+    /*The panel moves the pixels so the moved area is not flushed*/
+    scroll_cb_cnt = 0;
+    lv_display_set_scroll_cb(NULL, scroll_cb);
+    lv_obj_scroll_by(cont, 0, -25, LV_ANIM_OFF);
+    check_render();
+    TEST_ASSERT_EQUAL_UINT32(1, scroll_cb_cnt);
+}
+
+#endif
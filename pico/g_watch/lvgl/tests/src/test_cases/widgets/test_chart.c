@@ -193,4 +193,266 @@ void test_draw_task_hooking(void)
     TEST_ASSERT_EQUAL_SCREENSHOT("widgets/chart_bar_draw_hook.png");
 }
 
+static uint32_t series_task_cnt;
+
+static void count_series_tasks_cb(lv_event_t * e)
+{
+    lv_draw_task_t * draw_task = lv_event_get_param(e);
+    lv_draw_dsc_base_t * base_dsc = draw_task->draw_dsc;
+    if(base_dsc->part == LV_PART_ITEMS) series_task_cnt++;
+}
+
+static void stream_check_shifted(lv_chart_type_t type, int32_t content_w)
+{
+    /*21 points, one point is 10 px*/
+    lv_obj_set_size(chart, content_w + 20, 120);
+    lv_obj_set_style_pad_all(chart, 10, 0);
+    lv_obj_set_style_border_width(chart, 0, 0);
+    lv_obj_center(chart);
+    lv_chart_set_type(chart, type);
+    lv_chart_set_point_count(chart, 21);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_STREAM);
+    lv_obj_add_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_add_event_cb(chart, count_series_tasks_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+
+    lv_chart_series_t * ser1 = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_series_t * ser2 = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_BLUE), LV_CHART_AXIS_PRIMARY_Y);
+
+    uint32_t i;
+    for(i = 0; i < 21; i++) {
+        lv_chart_set_next_value(chart, ser1, (i * 37) % 100);
+        lv_chart_set_next_value(chart, ser2, (i * 53) % 100);
+    }
+    lv_refr_now(NULL);
+
+    /*Adding points shifts the buffer and draws only around the edges*/
+    for(i = 0; i < 30; i++) {
+        lv_chart_set_next_value(chart, ser1, (i * 71) % 100);
+        lv_chart_set_next_value(chart, ser2, (i * 13) % 100);
+        series_task_cnt = 0;
+        lv_refr_now(NULL);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(2 * 2 * 3, series_task_cnt);
+    }
+
+    /*The result is the same as drawing everything again*/
+    lv_draw_buf_t * buf = ((lv_chart_t *)chart)->stream_buf;
+    TEST_ASSERT_NOT_NULL(buf);
+    uint32_t size = buf->header.stride * buf->header.h;
+    uint8_t * shifted = lv_malloc(size);
+    lv_memcpy(shifted, buf->data, size);
+
+    lv_chart_refresh(chart);
+    series_task_cnt = 0;
+    lv_refr_now(NULL);
+    TEST_ASSERT_GREATER_THAN_UINT32(2 * 2 * 3, series_task_cnt);
+    TEST_ASSERT_EQUAL_MEMORY(shifted, ((lv_chart_t *)chart)->stream_buf->data, size);
+    lv_free(shifted);
+}
+
+void test_chart_stream_line_is_shifted(void)
+{
+    /*The points are at 0, 10, ..., 200*/
+    stream_check_shifted(LV_CHART_TYPE_LINE, 200);
+}
+
+void test_chart_stream_bar_is_shifted(void)
+{
+    lv_obj_set_style_pad_column(chart, 0, 0);
+    /*10 px wide bars at 0, 10, ..., 200*/
+    stream_check_shifted(LV_CHART_TYPE_BAR, 210);
+}
+
+void test_chart_stream_draws_like_shift(void)
+{
+    lv_obj_t * chart2 = lv_chart_create(active_screen);
+    lv_obj_t * charts[2] = {chart, chart2};
+    lv_chart_series_t * sers[2];
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_obj_set_size(charts[i], 220, 120);
+        lv_obj_set_pos(charts[i], 10, 10 + i * 150);
+        lv_obj_set_style_line_width(charts[i], 0, LV_PART_MAIN);
+        lv_chart_set_point_count(charts[i], 21);
+        sers[i] = lv_chart_add_series(charts[i], red_color, LV_CHART_AXIS_PRIMARY_Y);
+    }
+    lv_chart_set_update_mode(chart2, LV_CHART_UPDATE_MODE_STREAM);
+
+    for(i = 0; i < 40; i++) {
+        lv_chart_set_next_value(chart, sers[0], (i * 37) % 100);
+        lv_chart_set_next_value(chart2, sers[1], (i * 37) % 100);
+        lv_refr_now(NULL);
+    }
+
+    /*Only the blending can be different*/
+    lv_draw_buf_t * disp_buf = lv_display_get_buf_active(NULL);
+    int32_t x, y;
+    for(y = 0; y < 120; y++) {
+        for(x = 0; x < 220; x++) {
+            uint8_t * p1 = lv_draw_buf_goto_xy(disp_buf, 10 + x, 10 + y);
+            uint8_t * p2 = lv_draw_buf_goto_xy(disp_buf, 10 + x, 160 + y);
+            uint32_t c;
+            for(c = 0; c < 3; c++) TEST_ASSERT_UINT8_WITHIN(4, p1[c], p2[c]);
+        }
+    }
+}
+
+/*A chart whose background can be shifted with the series*/
+static lv_chart_series_t * stream_plain_chart_create(void)
+{
+    lv_obj_set_size(chart, 220, 120);
+    lv_obj_set_style_pad_all(chart, 10, 0);
+    lv_obj_set_style_border_width(chart, 0, 0);
+    lv_obj_set_style_radius(chart, 0, 0);
+    lv_obj_set_style_bg_color(chart, lv_color_white(), 0);
+    lv_obj_set_style_bg_opa(chart, LV_OPA_COVER, 0);
+    lv_obj_center(chart);
+    lv_chart_set_point_count(chart, 21);
+    lv_chart_set_div_line_count(chart, 3, 0);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_STREAM);
+
+    lv_chart_series_t * ser = lv_chart_add_series(chart, red_color, LV_CHART_AXIS_PRIMARY_Y);
+    uint32_t i;
+    for(i = 0; i < 21; i++) lv_chart_set_next_value(chart, ser, (i * 37) % 100);
+    lv_refr_now(NULL);
+
+    return ser;
+}
+
+/*Copy the pixels of the chart from the display*/
+static void stream_copy_shown(uint8_t * dest)
+{
+    lv_draw_buf_t * disp_buf = lv_display_get_buf_active(NULL);
+    uint32_t line_bytes = lv_area_get_width(&chart->coords) * lv_color_format_get_size(disp_buf->header.cf);
+    int32_t y;
+    for(y = chart->coords.y1; y <= chart->coords.y2; y++) {
+        lv_memcpy(dest, lv_draw_buf_goto_xy(disp_buf, chart->coords.x1, y), line_bytes);
+        dest += line_bytes;
+    }
+}
+
+void test_chart_stream_opaque_buf_on_rgb565(void)
+{
+    lv_color_format_t cf_ori = lv_display_get_color_format(NULL);
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_RGB565);
+
+    lv_chart_series_t * ser = stream_plain_chart_create();
+    lv_draw_buf_t * buf = ((lv_chart_t *)chart)->stream_buf;
+    TEST_ASSERT_NOT_NULL(buf);
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_RGB565, buf->header.cf);
+
+    uint32_t i;
+    for(i = 0; i < 30; i++) {
+        lv_chart_set_next_value(chart, ser, (i * 71) % 100);
+        lv_refr_now(NULL);
+    }
+
+    /*The buffer has the background and the horizontal division lines too and it's the same as drawing everything*/
+    uint32_t stride = buf->header.stride;
+    uint32_t h = buf->header.h;
+    uint32_t line_bytes = buf->header.w * lv_color_format_get_size(buf->header.cf);
+    uint8_t * shifted = lv_malloc(stride * h);
+    lv_memcpy(shifted, buf->data, stride * h);
+
+    /*The same is shown as in shift mode*/
+    uint32_t shown_size = lv_area_get_size(&chart->coords) * 2;
+    uint8_t * shown = lv_malloc(shown_size);
+    uint8_t * shown_shift = lv_malloc(shown_size);
+    stream_copy_shown(shown);
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_SHIFT);
+    lv_refr_now(NULL);
+    stream_copy_shown(shown_shift);
+    TEST_ASSERT_EQUAL_MEMORY(shown_shift, shown, shown_size);
+
+    lv_chart_set_update_mode(chart, LV_CHART_UPDATE_MODE_STREAM);
+    lv_refr_now(NULL);
+    /*The buffer is recreated so compare only the pixels, not the padding at the end of the lines*/
+    buf = ((lv_chart_t *)chart)->stream_buf;
+    for(i = 0; i < h; i++) {
+        TEST_ASSERT_EQUAL_MEMORY(shifted + i * stride, buf->data + i * buf->header.stride, line_bytes);
+    }
+
+    lv_free(shifted);
+    lv_free(shown);
+    lv_free(shown_shift);
+    lv_display_set_color_format(NULL, cf_ori);
+}
+
+void test_chart_stream_falls_back_to_shift(void)
+{
+    lv_obj_add_flag(chart, LV_OBJ_FLAG_SEND_DRAW_TASK_EVENTS);
+    lv_obj_add_event_cb(chart, count_series_tasks_cb, LV_EVENT_DRAW_TASK_ADDED, NULL);
+
+    /*Vertical division lines can't be drawn to an opaque buffer*/
+    lv_color_format_t cf_ori = lv_display_get_color_format(NULL);
+    lv_display_set_color_format(NULL, LV_COLOR_FORMAT_RGB565);
+    lv_chart_series_t * ser = stream_plain_chart_create();
+    lv_chart_set_div_line_count(chart, 3, 5);
+    lv_chart_set_next_value(chart, ser, 50);
+    series_task_cnt = 0;
+    lv_refr_now(NULL);
+    TEST_ASSERT_NULL(((lv_chart_t *)chart)->stream_buf);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, series_task_cnt);
+
+    /*With 32 bit color depth ARGB8888 is used*/
+    lv_display_set_color_format(NULL, cf_ori);
+    lv_chart_refresh(chart);
+    lv_refr_now(NULL);
+    TEST_ASSERT_NOT_NULL(((lv_chart_t *)chart)->stream_buf);
+    /*Larger than LV_CHART_STREAM_BUF_MAX_SIZE*/
+    lv_obj_set_size(chart, 700, 200);
+    lv_chart_set_next_value(chart, ser, 50);
+    series_task_cnt = 0;
+    lv_refr_now(NULL);
+    TEST_ASSERT_NULL(((lv_chart_t *)chart)->stream_buf);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, series_task_cnt);
+}
+
+static uint32_t stream_inv_size;
+
+static void stream_get_inv_size_cb(lv_event_t * e)
+{
+    lv_display_t * disp = lv_event_get_target(e);
+    stream_inv_size = 0;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) stream_inv_size += lv_area_get_size(&disp->inv_areas[i]);
+}
+
+void test_chart_stream_moves_shown_pixels(void)
+{
+    lv_display_set_scroll_copy(NULL, true);
+
+    lv_chart_series_t * ser = stream_plain_chart_create();
+    lv_chart_series_t * ser2 = lv_chart_add_series(chart, lv_palette_main(LV_PALETTE_BLUE), LV_CHART_AXIS_PRIMARY_Y);
+    lv_chart_refresh(chart);
+    lv_refr_now(NULL);
+
+    /*Added after the chart's handler so it sees the areas invalidated by the chart*/
+    lv_display_add_event_cb(lv_display_get_default(), stream_get_inv_size_cb, LV_EVENT_REFR_START, NULL);
+
+    lv_area_t area = ((lv_chart_t *)chart)->stream_area;
+    lv_draw_buf_t * disp_buf = lv_display_get_buf_active(NULL);
+    uint32_t disp_size = disp_buf->header.stride * disp_buf->header.h;
+    uint8_t * shown = lv_malloc(disp_size);
+
+    uint32_t i;
+    for(i = 0; i < 30; i++) {
+        lv_chart_set_next_value(chart, ser, (i * 71) % 100);
+        lv_chart_set_next_value(chart, ser2, (i * 13) % 100);
+        lv_refr_now(NULL);
+
+        /*Only the strips of the first and the new points, not the whole plot*/
+        TEST_ASSERT_LESS_THAN_UINT32(lv_area_get_size(&area) / 2, stream_inv_size);
+
+        /*The moved pixels are the same as the redrawn ones*/
+        lv_memcpy(shown, disp_buf->data, disp_size);
+        lv_obj_invalidate(lv_screen_active());
+        lv_refr_now(NULL);
+        TEST_ASSERT_EQUAL_MEMORY(shown, disp_buf->data, disp_size);
+    }
+
+    lv_free(shown);
+    lv_display_remove_event_cb_with_user_data(lv_display_get_default(), stream_get_inv_size_cb, NULL);
+    lv_display_set_scroll_copy(NULL, false);
+}
+
 #endif
@@ -1,10 +1,12 @@
 #if LV_BUILD_TEST
 #include "../lvgl.h"
+#include "../../lvgl_private.h"
 
 #include "unity/unity.h"
 #include "lv_test_helpers.h"
 
 static uint32_t buf[CANVAS_WIDTH_TO_STRIDE(100, 4) * 100 + LV_DRAW_BUF_ALIGN];
+static uint32_t ref_buf[CANVAS_WIDTH_TO_STRIDE(100, 4) * 100 + LV_DRAW_BUF_ALIGN];
 extern const uint8_t test_lottie_approve[];
 extern const size_t test_lottie_approve_size;
 
@@ -171,4 +173,111 @@ void test_lottie_no_jump_when_visible_again(void)
 
 }
 
+static bool is_frame_cached(lv_obj_t * obj, int32_t frame)
+{
+    /*The beginning of the cache entries of lv_lottie.c*/
+    struct {
+        lv_cache_slot_size_t slot;
+        int32_t frame;
+        uint8_t rest[16];
+    } search_key;
+    lv_memzero(&search_key, sizeof(search_key));
+    search_key.frame = frame;
+
+    lv_cache_t * cache = ((lv_lottie_t *)obj)->frame_cache;
+    lv_cache_entry_t * entry = lv_cache_acquire(cache, &search_key, NULL);
+    if(entry == NULL) return false;
+    lv_cache_release(cache, entry, NULL);
+    return true;
+}
+
+static float get_rendered_frame(lv_obj_t * obj)
+{
+    float f;
+    tvg_animation_get_frame(((lv_lottie_t *)obj)->tvg_anim, &f);
+    return f;
+}
+
+static void show_frame(lv_obj_t * obj, int32_t frame)
+{
+    lv_anim_t * a = lv_lottie_get_anim(obj);
+    a->exec_cb(obj, frame);
+}
+
+static lv_obj_t * create_with_buf(void * b)
+{
+    lv_obj_t * lottie = lv_lottie_create(lv_screen_active());
+    lv_lottie_set_buffer(lottie, 100, 100, lv_draw_buf_align(b, LV_COLOR_FORMAT_ARGB8888));
+    lv_lottie_set_src_data(lottie, test_lottie_approve, test_lottie_approve_size);
+    lv_obj_center(lottie);
+    lv_obj_update_layout(lottie);
+    return lottie;
+}
+
+void test_lottie_frame_cache(void)
+{
+    lv_obj_t * lottie = create_with_buf(buf);
+    lv_lottie_set_frame_cache_size(lottie, 1024 * 1024);
+    lv_obj_t * ref = create_with_buf(ref_buf);
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(lottie);
+    lv_draw_buf_t * ref_draw_buf = lv_canvas_get_draw_buf(ref);
+    uint32_t buf_size = draw_buf->header.stride * draw_buf->header.h;
+
+    int32_t frame;
+    for(frame = 0; frame <= 20; frame++) {
+        show_frame(lottie, frame);
+        TEST_ASSERT_TRUE(is_frame_cached(lottie, frame));
+    }
+
+    /*Shown from the cache without rendering, the same as rendered*/
+    for(frame = 20; frame >= 0; frame--) {
+        show_frame(lottie, frame);
+        show_frame(ref, frame);
+        TEST_ASSERT_EQUAL_FLOAT(20, get_rendered_frame(lottie));
+        TEST_ASSERT_EQUAL_MEMORY(ref_draw_buf->data, draw_buf->data, buf_size);
+    }
+
+    /*Drop the least recently used frames*/
+    lv_cache_t * cache = ((lv_lottie_t *)lottie)->frame_cache;
+    lv_lottie_set_frame_cache_size(lottie, lv_cache_get_size(cache, NULL) / 2);
+    TEST_ASSERT_TRUE(is_frame_cached(lottie, 0));
+    TEST_ASSERT_FALSE(is_frame_cached(lottie, 20));
+
+    /*A new source drops every frame*/
+    lv_lottie_set_src_data(lottie, test_lottie_approve, test_lottie_approve_size);
+    TEST_ASSERT_TRUE(is_frame_cached(lottie, 0));
+    TEST_ASSERT_FALSE(is_frame_cached(lottie, 1));
+}
+
+void test_lottie_frame_cache_prerender(void)
+{
+    lv_obj_t * lottie = create_with_buf(buf);
+    lv_obj_add_flag(lottie, LV_OBJ_FLAG_HIDDEN);
+    lv_lottie_set_frame_cache_size(lottie, 4 * 1024 * 1024);
+    lv_lottie_set_frame_cache_prerender(lottie, true);
+
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(lottie);
+    uint32_t buf_size = draw_buf->header.stride * draw_buf->header.h;
+    static uint8_t displayed[CANVAS_WIDTH_TO_STRIDE(100, 4) * 100];
+    lv_memcpy(displayed, draw_buf->data, buf_size);
+
+    /*One frame in every timer period*/
+    lv_timer_t * timer = ((lv_lottie_t *)lottie)->prerender_timer;
+    uint32_t i;
+    for(i = 0; i < 200 && !lv_timer_get_paused(timer); i++) {
+        lv_test_wait(LV_DEF_REFR_PERIOD);
+    }
+    TEST_ASSERT_TRUE(lv_timer_get_paused(timer));
+
+    int32_t frame;
+    int32_t last_frame = lv_lottie_get_anim(lottie)->end_value;
+    for(frame = 0; frame <= last_frame; frame++) {
+        TEST_ASSERT_TRUE(is_frame_cached(lottie, frame));
+    }
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(last_frame, i);
+
+    /*The displayed frame is kept*/
+    TEST_ASSERT_EQUAL_MEMORY(displayed, draw_buf->data, buf_size);
+}
+
 #endif
@@ -0,0 +1,153 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+static lv_obj_t * vlist;
+static uint32_t create_cnt;
+static uint32_t bind_cnt;
+
+static lv_obj_t * create_row(lv_obj_t * parent)
+{
+    create_cnt++;
+    lv_obj_t * label = lv_label_create(parent);
+    return label;
+}
+
+static void bind_row(lv_obj_t * parent, lv_obj_t * row, uint32_t index)
+{
+    LV_UNUSED(parent);
+    bind_cnt++;
+    lv_label_set_text_fmt(row, "Item %" LV_PRIu32, index);
+}
+
+static void check_rows(void)
+{
+    /*Every item in the visible window is shown on a row at its own position*/
+    lv_obj_update_layout(vlist);
+    int32_t scroll_y = lv_obj_get_scroll_y(vlist);
+    int32_t first = scroll_y / 30;
+    int32_t last = LV_MIN((scroll_y + 299) / 30, (int32_t)lv_vlist_get_item_count(vlist) - 1);
+    int32_t i;
+    for(i = first; i <= last; i++) {
+        lv_obj_t * row = lv_vlist_get_row(vlist, i);
+        TEST_ASSERT_NOT_NULL(row);
+        TEST_ASSERT_EQUAL_INT32(i, lv_vlist_get_row_index(vlist, row));
+        TEST_ASSERT_EQUAL_INT32(vlist->coords.y1 + i * 30 - scroll_y, row->coords.y1);
+
+        char buf[32];
+        lv_snprintf(buf, sizeof(buf), "Item %" LV_PRId32, i);
+        TEST_ASSERT_EQUAL_STRING(buf, lv_label_get_text(row));
+    }
+}
+
+void setUp(void)
+{
+    create_cnt = 0;
+    bind_cnt = 0;
+    vlist = lv_vlist_create(lv_screen_active());
+    lv_obj_set_size(vlist, 200, 300);
+    lv_obj_set_style_pad_all(vlist, 0, 0);
+    lv_obj_set_style_pad_row(vlist, 0, 0);
+    lv_obj_set_style_border_width(vlist, 0, 0);
+    lv_vlist_set_item_height(vlist, 30);
+    lv_vlist_set_create_cb(vlist, create_row);
+    lv_vlist_set_bind_cb(vlist, bind_row);
+    lv_obj_update_layout(vlist);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_vlist_row_count_is_constant(void)
+{
+    /*10 visible rows, 1 partial row on both ends and 1 row overscan on both ends*/
+    lv_vlist_set_item_count(vlist, 200);
+    TEST_ASSERT_EQUAL_UINT32(14, lv_obj_get_child_count(vlist));
+    TEST_ASSERT_EQUAL_UINT32(14, create_cnt);
+    TEST_ASSERT_EQUAL_INT32(200 * 30 - 300, lv_obj_get_scroll_bottom(vlist));
+
+    lv_vlist_set_item_count(vlist, 20000);
+    TEST_ASSERT_EQUAL_UINT32(14, lv_obj_get_child_count(vlist));
+    TEST_ASSERT_EQUAL_UINT32(14, create_cnt);
+    TEST_ASSERT_EQUAL_INT32(20000 * 30 - 300, lv_obj_get_scroll_bottom(vlist));
+
+    /*Fewer items than rows*/
+    lv_vlist_set_item_count(vlist, 3);
+    TEST_ASSERT_EQUAL_UINT32(3, lv_obj_get_child_count(vlist));
+    check_rows();
+}
+
+void test_vlist_scroll_rebinds_rows(void)
+{
+    lv_vlist_set_item_count(vlist, 200);
+    check_rows();
+
+    /*One row scrolled out, one row scrolled in*/
+    lv_obj_scroll_to_y(vlist, 30, LV_ANIM_OFF);
+    bind_cnt = 0;
+    lv_obj_scroll_to_y(vlist, 60, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_UINT32(1, bind_cnt);
+    check_rows();
+
+    /*Scrolling inside a row doesn't rebind anything*/
+    bind_cnt = 0;
+    lv_obj_scroll_to_y(vlist, 75, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_UINT32(0, bind_cnt);
+    check_rows();
+
+    lv_obj_scroll_to_y(vlist, 3001, LV_ANIM_OFF);
+    check_rows();
+
+    lv_vlist_scroll_to_item(vlist, 199, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_bottom(vlist));
+    check_rows();
+
+    lv_vlist_scroll_to_item(vlist, 0, LV_ANIM_OFF);
+    TEST_ASSERT_EQUAL_INT32(0, lv_obj_get_scroll_y(vlist));
+    check_rows();
+
+    TEST_ASSERT_EQUAL_UINT32(14, create_cnt);
+}
+
+void test_vlist_shrink_clamps_scroll(void)
+{
+    lv_vlist_set_item_count(vlist, 200);
+    lv_obj_scroll_to_y(vlist, 5000, LV_ANIM_OFF);
+
+    lv_vlist_set_item_count(vlist, 50);
+    TEST_ASSERT_EQUAL_INT32(50 * 30 - 300, lv_obj_get_scroll_y(vlist));
+    TEST_ASSERT_NULL(lv_vlist_get_row(vlist, 120));
+    check_rows();
+}
+
+void test_vlist_refresh_item(void)
+{
+    lv_vlist_set_item_count(vlist, 200);
+
+    bind_cnt = 0;
+    lv_vlist_refresh_item(vlist, 2);
+    lv_vlist_refresh_item(vlist, 150);
+    TEST_ASSERT_EQUAL_UINT32(1, bind_cnt);
+
+    bind_cnt = 0;
+    lv_vlist_refresh(vlist);
+    TEST_ASSERT_EQUAL_UINT32(14, bind_cnt);
+}
+
+void test_vlist_row_gap(void)
+{
+    lv_vlist_set_item_count(vlist, 100);
+    lv_obj_set_style_pad_row(vlist, 10, 0);
+    lv_obj_update_layout(vlist);
+
+    TEST_ASSERT_EQUAL_INT32(100 * 40 - 10 - 300, lv_obj_get_scroll_bottom(vlist));
+    lv_obj_t * row = lv_vlist_get_row(vlist, 3);
+    TEST_ASSERT_NOT_NULL(row);
+    TEST_ASSERT_EQUAL_INT32(vlist->coords.y1 + 3 * 40, row->coords.y1);
+}
+
+#endif
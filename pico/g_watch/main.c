@@ -2,6 +2,7 @@
 #include "pico/stdlib.h"
 #include "hardware/spi.h"
 #include "hardware/rtc.h"
+#include "hardware/sync.h"
 #include "pico/time.h"
 
 // LVGL 头文件
@@ -9,49 +10,119 @@
 #include "src/display/lv_display.h"
 #include "src/display/lv_display_private.h"
 #include "src/core/lv_obj.h"
+#include "src/core/lv_refr_private.h"
 #include "src/draw/lv_draw.h"
 
 // 本地头文件
 #include "lcd_driver.h"
 #include "clock.h"
+#include "watch_face.h"
+#include "ui_queue.h"
+#include "frame_pacer.h"
+#include "aod.h"
+#include "boot_timeline.h"
+#include "time_source.h"
+#include "asset_pack.h"
+#ifdef XIP_PROFILE
+#include "xip_profile.h"
+#endif
+#ifdef ALWAYS_ON_DISPLAY
+#include "hardware/irq.h"
+#endif
+#ifdef CLOCK_GOVERNOR
+#include "hardware/clocks.h"
+#include "hardware/vreg.h"
+#include "clock_gov.h"
+#endif
 
 #define DISP_BUF_SIZE (LCD_WIDTH * 10)
 
-// 显示缓冲区
+// 帧节拍: GC9A01约60Hz扫描, 每2个TE周期刷新一次LVGL(约30fps, 和原来的33ms刷新周期一致)
+static const frame_pacer_cfg_t pacer_cfg = {
+    .lines = LCD_HEIGHT,
+    .period_us = 16667,
+    .line_write_us = (LCD_WIDTH * 16) / 40,     // 40MHz SPI, RGB565
+    .margin_us = 150,
+    .refr_div = 2,
+    .fallback_us = 33000,                       // 没有TE信号(引脚未连接)时按原来的周期刷新
+};
+
+// 秒针走法: 0 每秒跳一格, 8或16为扫秒(每秒的步数, CMake的 SEC_SWEEP_HZ)
+#ifndef SEC_SWEEP_HZ
+#define SEC_SWEEP_HZ    0
+#endif
+
+// 扫秒时读取时间的周期, 比每步的间隔短得多, 步子才均匀
+#define SWEEP_POLL_MS   10
+
+// 启动后多久输出启动时间线: USB串口要等主机枚举之后才能收到输出
+#define BOOT_REPORT_MS  3000
+
+#ifdef ALWAYS_ON_DISPLAY
+// 多久没有唤醒请求(aod_request_wake, 唤醒按键 AOD_WAKE_GPIO)之后进入常亮显示
+#define AOD_IDLE_MS     15000
+#endif
+
+// RTC在设置时间之后才开始计时, 还没有校时来源, 先从固定时间开始
+static const datetime_t rtc_start = {
+    .year = 2025, .month = 1, .day = 1, .dotw = 3,
+    .hour = 10, .min = 8, .sec = 0
+};
+
+// 显示缓冲区: 两个缓冲区交替, 异步传输后端(PIO+DMA)写出一个的同时渲染另一个
 static lv_color_t buf1[DISP_BUF_SIZE];
+static lv_color_t buf2[DISP_BUF_SIZE];
 static lv_disp_t * disp;
 
-// 创建表盘样式
-static lv_style_t style_clock;
-static lv_obj_t *clock_obj;
-static lv_obj_t *date_label;
-
-// 添加指针样式
-static lv_style_t style_hour_hand;
-static lv_style_t style_min_hand;
-static lv_style_t style_sec_hand;
-static lv_obj_t *hour_hand;
-static lv_obj_t *min_hand;
-static lv_obj_t *sec_hand;
-
-// 创建金属质感渐变
-static void create_metallic_style(lv_style_t *style) {
-    lv_style_init(style);
-    
-    // 设置背景渐变
-    lv_style_set_bg_color(style, lv_color_hex(0xf7e8e3));  // 玫瑰金色
-    lv_style_set_bg_grad_color(style, lv_color_hex(0xe8cec7));
-    lv_style_set_bg_grad_dir(style, LV_GRAD_DIR_NONE);
-    
-    // 添加边框效果
-    lv_style_set_border_width(style, 2);
-    lv_style_set_border_color(style, lv_color_hex(0xd4b5ac));
-    lv_style_set_radius(style, LV_RADIUS_CIRCLE);
-    
-    // 添加阴影效果
-    lv_style_set_shadow_width(style, 20);
-    lv_style_set_shadow_color(style, lv_color_hex(0x666666));
-    lv_style_set_shadow_opa(style, LV_OPA_30);
+// 资源包(flash中 ASSET_PACK_FLASH_OFFSET 处): 表盘背景图和品牌字体的名称
+#define ASSET_FACE_BG       "bg"
+#define ASSET_FACE_FONT     "brand"
+static asset_pack_t assets;
+
+#ifdef ALWAYS_ON_DISPLAY
+// 常亮显示: 单独的I1显示设备, 只覆盖面板的部分显示窗口
+static uint32_t aod_buf[(AOD_BUF_SIZE + 3) / 4];
+static uint8_t aod_line[AOD_LINE_SIZE];
+static lv_display_t * aod_disp;
+static volatile bool minute_alarm;
+#endif
+
+// 功耗估算: 每种模式下CPU运行(非睡眠)的时间和SPI写入的字节数, 每小时通过stdio报告一次
+typedef struct {
+    uint64_t time_us;
+    uint64_t active_us;
+    uint64_t spi_bytes;
+} energy_t;
+
+static energy_t energy[2];  // 0: 正常, 1: 常亮
+static uint64_t energy_report_us;
+static bool boot_reported;
+
+// 正在写出的窗口, 写完时交给节拍器估计写入速度
+static uint32_t flush_start_us;
+static uint16_t flush_rows;
+static bool flush_last;
+
+// 像素写完(PIO后端在DMA中断中调用)。LVGL在 lv_display_flush_ready() 之后才会调用下一次
+// disp_flush(), 节拍器的UI线程状态不会同时被访问
+#ifdef CLOCK_GOVERNOR
+// 调速器的每帧测量: RENDER_START 时清零, 写入时间在 disp_flush_done 中累计
+static uint32_t gov_start_us;
+static uint32_t gov_stall_us;       // 渲染期间不算CPU渲染的时间: disp_flush() 内部和等待写完(FLUSH_WAIT)
+static uint32_t gov_wait_start_us;
+static volatile uint32_t gov_write_us;
+static uint32_t gov_render_us;
+static bool gov_frame_ready;
+#endif
+
+static void disp_flush_done(void * user_data)
+{
+    uint32_t write_us = time_us_32() - flush_start_us;
+    frame_pacer_flush_done(flush_rows, write_us, flush_last);
+#ifdef CLOCK_GOVERNOR
+    gov_write_us += write_us;
+#endif
+    lv_display_flush_ready((lv_display_t *)user_data);
 }
 
 // 显示刷新回调
@@ -59,190 +130,488 @@ static void disp_flush(lv_display_t * disp_drv, const lv_area_t * area, uint8_t
 {
     uint32_t w = (area->x2 - area->x1 + 1);
     uint32_t h = (area->y2 - area->y1 + 1);
+#ifdef CLOCK_GOVERNOR
+    uint32_t enter_us = time_us_32();
+#endif
 
-    lcd_set_window(area->x1, area->y1, area->x2, area->y2);
-    lcd_write_pixels((uint16_t*)px_map, w * h);
+    // 启动时面板还在异步初始化(lcd_init_async), 第一块渲染好之后等它就绪
+    if (!lcd_is_ready()) {
+        boot_mark("first block rendered");
+        lcd_wait_ready();
+    }
 
-    lv_display_flush_ready(disp_drv);
-}
+    // 等到扫描线不在窗口内再写, 避免撕裂
+    uint32_t delay = frame_pacer_get_delay(area->y1, area->y2, time_us_32());
+    if (delay) busy_wait_us_32(delay);
 
-// 添加波纹效果
-static void draw_ripple_effect(lv_obj_t *obj, lv_draw_ctx_t *draw_ctx) {
-    lv_area_t area;
-    lv_obj_get_coords(obj, &area);
-    int32_t radius = (area.x2 - area.x1) / 2;
-    int32_t cx = area.x1 + radius;
-    int32_t cy = area.y1 + radius;
-
-    // 绘制4层波纹
-    for(int i = 0; i < 4; i++) {
-        float progress = i / 4.0f;
-        uint32_t current_radius = radius * (0.45f + progress * 0.5f);
-        
-        lv_draw_arc_dsc_t arc_dsc;
-        lv_draw_arc_dsc_init(&arc_dsc);
-        arc_dsc.color = lv_color_hex(0x666666);
-        arc_dsc.width = 2;
-        arc_dsc.opa = (1.0f - progress) * 50;  // 渐变透明度
-        
-        lv_draw_arc(draw_ctx, &arc_dsc, cx, cy, current_radius, 0, 360);
-    }
+    flush_start_us = time_us_32();
+    flush_rows = h;
+    flush_last = lv_display_flush_is_last(disp_drv);
+    lcd_set_window(area->x1, area->y1, area->x2, area->y2);
+    lcd_write_pixels_async((uint16_t*)px_map, w * h, disp_flush_done, disp_drv);
+#ifdef CLOCK_GOVERNOR
+    gov_stall_us += time_us_32() - enter_us;
+#endif
 }
 
-// 更新绘制表盘函数
-static void draw_clock_face(lv_obj_t *obj, lv_event_t *e) {
-    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
-    
-    // 绘制波纹效果
-    draw_ripple_effect(obj, draw_ctx);
-    
-    // 绘制品牌名称
-    lv_draw_label_dsc_t label_dsc;
-    lv_draw_label_dsc_init(&label_dsc);
-    label_dsc.color = lv_color_hex(0xb76e5d);
-    label_dsc.font = &lv_font_montserrat_16;  // 使用合适的字体
-    
-    lv_point_t label_pos;
-    label_pos.x = obj->coords.x1 + (obj->coords.x2 - obj->coords.x1) / 2;
-    label_pos.y = obj->coords.y1 + (obj->coords.y2 - obj->coords.y1) / 3;
-    
-    lv_draw_label(draw_ctx, &label_dsc, &label_pos, "YongqiGou", NULL);
+#ifdef ALWAYS_ON_DISPLAY
+// 常亮显示刷新回调: I1逐行转换为12位RGB444, 写到部分显示窗口内
+static void aod_flush(lv_display_t * disp_drv, const lv_area_t * area, uint8_t * px_map)
+{
+    px_map += 8;  // 跳过I1调色板
+    uint32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_I1);
 
-    // 绘制刻度 (保持现有代码)
-    lv_draw_ctx_t *draw_ctx = lv_event_get_draw_ctx(e);
-    lv_area_t area;
-    lv_obj_get_coords(obj, &area);
-    
-    // 绘制主刻度
-    for(int i = 0; i < 12; i++) {
-        float angle = i * 30 * M_PI / 180;
-        int32_t x1 = area.x1 + (area.x2 - area.x1) / 2 + sin(angle) * 100;
-        int32_t y1 = area.y1 + (area.y2 - area.y1) / 2 - cos(angle) * 100;
-        int32_t x2 = area.x1 + (area.x2 - area.x1) / 2 + sin(angle) * 110;
-        int32_t y2 = area.y1 + (area.y2 - area.y1) / 2 - cos(angle) * 110;
-        
-        lv_draw_line_dsc_t line_dsc;
-        lv_draw_line_dsc_init(&line_dsc);
-        line_dsc.color = lv_color_hex(0x666666);
-        line_dsc.width = 3;
-        lv_draw_line(draw_ctx, &line_dsc, x1, y1, x2, y2);
+    lcd_set_window(area->x1, area->y1 + AOD_TOP, area->x2, area->y2 + AOD_TOP);
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        lcd_write_buffer(aod_line, aod_i1_to_rgb444(px_map, w, aod_line));
+        px_map += stride;
     }
-}
 
-// 创建指针样式
-static void create_hand_styles(void) {
-    // 时针样式
-    lv_style_init(&style_hour_hand);
-    lv_style_set_line_width(&style_hour_hand, 4);
-    lv_style_set_line_color(&style_hour_hand, lv_color_hex(0x666666));
-    lv_style_set_line_rounded(&style_hour_hand, true);
-    
-    // 分针样式
-    lv_style_init(&style_min_hand);
-    lv_style_set_line_width(&style_min_hand, 3);
-    lv_style_set_line_color(&style_min_hand, lv_color_hex(0x888888));
-    lv_style_set_line_rounded(&style_min_hand, true);
-    
-    // 秒针样式
-    lv_style_init(&style_sec_hand);
-    lv_style_set_line_width(&style_sec_hand, 2);
-    lv_style_set_line_color(&style_sec_hand, lv_color_hex(0xb76e5d));
-    lv_style_set_line_rounded(&style_sec_hand, true);
+    lv_display_flush_ready(disp_drv);
 }
+#endif
 
-// 创建日期窗口
-static void create_date_window(void) {
-    date_label = lv_label_create(clock_obj);
-    
-    static lv_style_t style_date;
-    lv_style_init(&style_date);
-    lv_style_set_bg_color(&style_date, lv_color_white());
-    lv_style_set_border_color(&style_date, lv_color_hex(0xd4b5ac));
-    lv_style_set_border_width(&style_date, 1);
-    lv_style_set_pad_all(&style_date, 2);
-    lv_style_set_text_color(&style_date, lv_color_hex(0xd4b5ac));
-    
-    lv_obj_add_style(date_label, &style_date, 0);
-    lv_obj_align(date_label, LV_ALIGN_CENTER, 0, 40);
+// RTC读数交给亚秒时间源, 返回带毫秒的时间
+static void get_watch_time(watch_time_t *wt) {
+    datetime_t t;
+    uint64_t now_us = time_us_64();
+    rtc_get_datetime(&t);
+    wt->hour = t.hour;
+    wt->min = t.min;
+    wt->sec = t.sec;
+    wt->month = t.month;
+    wt->day = t.day;
+    wt->ms = 0;
+    time_source_update(wt, now_us);
+    time_source_get(now_us, wt);
 }
 
 // 更新时间处理函数
 static void update_time(lv_timer_t * timer) {
-    datetime_t t;
-    rtc_get_datetime(&t);
-    
-    // 计算指针角度
-    int32_t hour_angle = (t.hour % 12 + t.min / 60.0f) * 30;
-    int32_t min_angle = t.min * 6;
-    int32_t sec_angle = t.sec * 6;
-    
-    // 更新指针位置
-    lv_obj_set_style_transform_angle(hour_hand, hour_angle * 10, 0);
-    lv_obj_set_style_transform_angle(min_hand, min_angle * 10, 0);
-    lv_obj_set_style_transform_angle(sec_hand, sec_angle * 10, 0);
-    
-    // 更新日期显示
-    char date_str[32];
-    snprintf(date_str, sizeof(date_str), "%s %02d", 
-             t.month < 13 ? month_names[t.month-1] : "???", 
-             t.day);
-    lv_label_set_text(date_label, date_str);
+    watch_time_t wt;
+    get_watch_time(&wt);
+    watch_face_set_time(&wt);
+}
+
+static uint32_t get_tick_ms(void) {
+    return to_ms_since_boot(get_absolute_time());
+}
+
+// 打开flash中的资源包, 把表盘用到的资源交给表盘; 没有烧录资源包时表盘使用内置的波纹和字体
+static void load_face_assets(void) {
+    if (!asset_pack_open_flash(&assets)) return;
+    watch_face_set_assets(asset_pack_get_image(&assets, ASSET_FACE_BG),
+                          asset_pack_font_create(&assets, ASSET_FACE_FONT));
 }
 
 // LVGL 初始化
 static void lvgl_init(void)
 {
     lv_init();
+    lv_tick_set_cb(get_tick_ms);
+    boot_mark("lv_init");
+
+    // 初始化跨线程UI更新队列
+    ui_queue_init();
 
     // 创建显示设备
     disp = lv_display_create(LCD_WIDTH, LCD_HEIGHT);
     
     // 设置显示缓冲区
-    lv_display_set_buffers(disp, buf1, NULL, DISP_BUF_SIZE * sizeof(lv_color_t), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_buffers(disp, buf1, buf2, DISP_BUF_SIZE * sizeof(lv_color_t), LV_DISPLAY_RENDER_MODE_PARTIAL);
     
     // 设置刷新回调
     lv_display_set_flush_cb(disp, disp_flush);
 
-    // 创建时钟对象
-    clock_obj = lv_obj_create(lv_scr_act());
-    lv_obj_set_size(clock_obj, 240, 240);
-    lv_obj_center(clock_obj);
-    
-    // 应用金属质感样式
-    create_metallic_style(&style_clock);
-    lv_obj_add_style(clock_obj, &style_clock, 0);
-    
-    // 添加表盘绘制事件
-    lv_obj_add_event_cb(clock_obj, draw_clock_face, LV_EVENT_DRAW_MAIN, NULL);
+    // 刷新由TE信号驱动(见主循环), 不使用LVGL自己的刷新定时器
+    lv_display_delete_refr_timer(disp);
 
-    // 创建指针
-    create_hand_styles();
+    // 创建表盘
+    load_face_assets();
+    boot_mark("asset pack");
+    watch_face_create(lv_scr_act());
+    watch_face_set_sweep(SEC_SWEEP_HZ);
+    boot_mark("watch face");
     
-    hour_hand = lv_line_create(clock_obj);
-    min_hand = lv_line_create(clock_obj);
-    sec_hand = lv_line_create(clock_obj);
-    
-    lv_obj_add_style(hour_hand, &style_hour_hand, 0);
-    lv_obj_add_style(min_hand, &style_min_hand, 0);
-    lv_obj_add_style(sec_hand, &style_sec_hand, 0);
-    
-    // 创建日期窗口
-    create_date_window();
-    
-    // 创建定时器更新时间
-    lv_timer_create(update_time, 1000, NULL);
+    // 创建定时器更新时间; 表盘只重画变化的部分, 扫秒时频繁读取时间不会多出刷新
+    lv_timer_create(update_time, SEC_SWEEP_HZ ? SWEEP_POLL_MS : 1000, NULL);
+
+#ifdef ALWAYS_ON_DISPLAY
+    // 常亮显示设备, 平时不刷新
+    aod_disp = lv_display_create(AOD_WIDTH, AOD_HEIGHT);
+    lv_display_set_color_format(aod_disp, LV_COLOR_FORMAT_I1);
+    lv_display_set_buffers(aod_disp, aod_buf, NULL, sizeof(aod_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(aod_disp, aod_flush);
+    lv_display_delete_refr_timer(aod_disp);
+    aod_face_create(lv_display_get_screen_active(aod_disp));
+    boot_mark("aod face");
+#endif
+}
+
+#ifdef ALWAYS_ON_DISPLAY
+// 唤醒按键(低电平有效)按下时请求退出常亮显示。
+// 用原始中断处理函数, 不替换TE使用的GPIO回调(每个核心只有一个)
+static void wake_gpio_irq(void) {
+    if (gpio_get_irq_event_mask(AOD_WAKE_GPIO) & GPIO_IRQ_EDGE_FALL) {
+        gpio_acknowledge_irq(AOD_WAKE_GPIO, GPIO_IRQ_EDGE_FALL);
+        aod_request_wake();
+    }
+}
+
+static void wake_gpio_init(void) {
+    gpio_init(AOD_WAKE_GPIO);
+    gpio_set_dir(AOD_WAKE_GPIO, GPIO_IN);
+    gpio_pull_up(AOD_WAKE_GPIO);
+    gpio_add_raw_irq_handler(AOD_WAKE_GPIO, wake_gpio_irq);
+    gpio_set_irq_enabled(AOD_WAKE_GPIO, GPIO_IRQ_EDGE_FALL, true);
+    irq_set_enabled(IO_IRQ_BANK0, true);
+}
+
+static void rtc_minute_cb(void) {
+    minute_alarm = true;
+}
+
+// 进入常亮显示: 关闭TE中断, 面板切换到部分显示+空闲模式, 之后只由RTC分钟闹钟唤醒
+static void aod_enter(void) {
+    lcd_set_te_callback(NULL);
+    lcd_enter_aod(AOD_TOP, AOD_TOP + AOD_HEIGHT - 1);
+
+    // 窗口里还是正常表盘的内容, 整个重画一次
+    watch_time_t wt;
+    get_watch_time(&wt);
+    aod_face_set_time(&wt);
+    lv_display_set_default(aod_disp);
+    lv_obj_invalidate(lv_display_get_screen_active(aod_disp));
+    lv_display_refr_timer(NULL);
+
+    // 每分钟第0秒触发, 其余字段为-1表示不比较
+    datetime_t alarm = {
+        .year = -1, .month = -1, .day = -1, .dotw = -1,
+        .hour = -1, .min = -1, .sec = 0
+    };
+    minute_alarm = false;
+    rtc_set_alarm(&alarm, rtc_minute_cb);
 }
 
+// 回到正常显示: 窗口内的像素已被常亮表盘覆盖, 整屏重画
+static void aod_exit(void) {
+    rtc_disable_alarm();
+    lcd_exit_aod();
+
+    lv_display_set_default(disp);
+    update_time(NULL);
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+
+    frame_pacer_init(&pacer_cfg);
+    lcd_set_te_callback(frame_pacer_te_edge);
+}
+#endif
+
+#ifdef CLOCK_GOVERNOR
+// 调速器的工作点, 都是PLL能精确产生的频率, 不超过RP2040的规格(133MHz)。
+// 电压随频率降低; 降压没有在所有芯片上验证过, 不稳定时提高 mv
+static const struct {
+    uint32_t sys_khz;
+    uint16_t mv;
+} gov_points[] = {
+    { 48000, 1000 },
+    { 72000, 1000 },
+    { 96000, 1050 },
+    { 125000, 1100 },   // 启动时的时钟和电压
+    { 133000, 1100 },
+};
+
+#define GOV_LEVELS  (sizeof(gov_points) / sizeof(gov_points[0]))
+#define GOV_START   3
+
+static clock_gov_level_t gov_levels[GOV_LEVELS];
+
+// 渲染的CPU时间 = RENDER_START 到 RENDER_READY, 减去 disp_flush() 内部和等待写完的时间
+static void gov_event_cb(lv_event_t * e)
+{
+    uint32_t now = time_us_32();
+    switch (lv_event_get_code(e)) {
+        case LV_EVENT_RENDER_START:
+            gov_start_us = now;
+            gov_stall_us = 0;
+            gov_write_us = 0;
+            break;
+        case LV_EVENT_FLUSH_WAIT_START:
+            gov_wait_start_us = now;
+            break;
+        case LV_EVENT_FLUSH_WAIT_FINISH:
+            gov_stall_us += now - gov_wait_start_us;
+            break;
+        case LV_EVENT_RENDER_READY:
+            gov_render_us = now - gov_start_us - gov_stall_us;
+            gov_frame_ready = true;
+            break;
+        default:
+            break;
+    }
+}
+
+static void gov_init(void)
+{
+    // 写入速率: 硬件SPI按外设时钟分频取整, PIO每位2个系统时钟周期
+    bool pio = lcd_get_transport() == &lcd_transport_pio;
+    for (size_t i = 0; i < GOV_LEVELS; i++) {
+        uint32_t hz = gov_points[i].sys_khz * 1000;
+        gov_levels[i].sys_khz = gov_points[i].sys_khz;
+        gov_levels[i].write_hz = pio ? (hz / 2 < LCD_PIO_HZ ? hz / 2 : LCD_PIO_HZ) : clock_gov_spi_hz(hz, LCD_SPI_HZ);
+        gov_levels[i].mv = gov_points[i].mv;
+    }
+
+    const clock_gov_cfg_t cfg = {
+        .levels = gov_levels,
+        .count = GOV_LEVELS,
+        .start = GOV_START,
+        .overlap = pio,                                     // PIO+DMA写入和渲染下一块重叠
+        .budget_us = pacer_cfg.period_us * pacer_cfg.refr_div,
+        .up_pct = 85,
+        .fit_pct = 70,
+        .down_pct = 60,
+        .down_frames = 30,                                  // 约1秒
+        .idle_us = 300000,                                  // 只剩每秒一次的时间刷新
+    };
+    clock_gov_init(&cfg, time_us_32());
+    lv_display_add_event_cb(disp, gov_event_cb, LV_EVENT_ALL, NULL);
+}
+
+// 0.85V起每级50mV(hardware/vreg.h)
+static enum vreg_voltage gov_vreg(uint16_t mv)
+{
+    return (enum vreg_voltage)(VREG_VOLTAGE_0_85 + (mv - 850) / 50);
+}
+
+// 切换工作点: 在写入全部完成之后进行, 先升压再升频, 先降频再降压
+static void gov_apply(uint8_t from, uint8_t to)
+{
+    const clock_gov_level_t *l = &gov_levels[to];
+    uint32_t hz = l->sys_khz * 1000;
+
+    lcd_wait_idle();
+    if (l->mv > gov_levels[from].mv) {
+        vreg_set_voltage(gov_vreg(l->mv));
+        busy_wait_us_32(1000);  // 等电压稳定
+    }
+    set_sys_clock_khz(l->sys_khz, true);
+
+    // SDK切换系统时钟后把外设时钟改为USB PLL(48MHz), SPI最高只有24MHz; 改回跟随系统时钟
+    clock_configure(clk_peri, 0, CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLK_SYS, hz, hz);
+    if (l->mv < gov_levels[from].mv) vreg_set_voltage(gov_vreg(l->mv));
+
+    // 按新时钟重新计算SPI/PIO的分频
+    lcd_set_transport(lcd_get_transport());
+}
+
+// 主循环中调用: 一帧写完后交给调速器, 没有帧时检查是否空闲
+static void gov_poll(void)
+{
+    uint8_t from = clock_gov_get_level();
+    uint8_t to;
+
+    if (gov_frame_ready) {
+        gov_frame_ready = false;
+        lcd_wait_idle();    // 最后一个窗口的写入时间在完成回调中累计
+        clock_gov_frame_t f = { .render_us = gov_render_us, .write_us = gov_write_us };
+        to = clock_gov_frame(&f, time_us_32());
+    } else {
+        to = clock_gov_idle(time_us_32());
+    }
+    if (to != from) gov_apply(from, to);
+}
+#endif
+
+// 记录一段运行时间和这段时间内的SPI字节数
+static void energy_add(int mode, uint64_t start_us, uint64_t end_us, uint32_t spi_start) {
+    energy[mode].active_us += end_us - start_us;
+    energy[mode].spi_bytes += lcd_get_spi_bytes() - spi_start;
+}
+
+// 每小时输出一次两种模式折算到每小时的CPU运行时间和SPI字节数
+static void energy_report(uint64_t now_us) {
+    if (now_us - energy_report_us < 3600ull * 1000000ull) return;
+    energy_report_us = now_us;
+
+    static const char *const names[2] = { "normal", "aod" };
+    for (int i = 0; i < 2; i++) {
+        energy_t *e = &energy[i];
+        if (e->time_us == 0) continue;
+        printf("energy %s: %llu s, cpu %llu ms/h, spi %llu bytes/h\n", names[i],
+               e->time_us / 1000000ull,
+               e->active_us * 3600ull * 1000ull / e->time_us,
+               e->spi_bytes * 3600ull * 1000000ull / e->time_us);
+    }
+#ifdef CLOCK_GOVERNOR
+    clock_gov_stats_t gs;
+    clock_gov_get_stats(&gs, time_us_32());
+    printf("clock gov: frames %lu, over %lu, up %lu, down %lu\n", (unsigned long)gs.frames,
+           (unsigned long)gs.over, (unsigned long)gs.ups, (unsigned long)gs.downs);
+    for (size_t i = 0; i < GOV_LEVELS; i++) {
+        printf("clock gov %lu kHz: %llu s\n", (unsigned long)gov_levels[i].sys_khz, gs.level_us[i] / 1000000ull);
+    }
+#endif
+}
+
+#ifdef ALWAYS_ON_DISPLAY
+// 常亮显示循环: 其余时间在WFE中睡眠, 只被RTC闹钟、TE以外的中断或 aod_request_wake() 唤醒
+static void aod_run(void) {
+    uint64_t last_us = time_us_64();
+
+    while (!aod_take_wake_request()) {
+        uint64_t start_us = time_us_64();
+        uint32_t spi_start = lcd_get_spi_bytes();
+
+        // 其他核心投递的更新照常执行, 正常表盘在退出时才会刷新
+        ui_queue_drain();
+
+        if (minute_alarm) {
+            minute_alarm = false;
+            watch_time_t wt;
+            get_watch_time(&wt);
+            aod_face_set_time(&wt);
+            lv_display_refr_timer(NULL);
+        }
+
+        uint64_t end_us = time_us_64();
+        energy_add(1, start_us, end_us, spi_start);
+        energy[1].time_us += end_us - last_us;
+        last_us = end_us;
+        energy_report(end_us);
+
+        __wfe();
+    }
+
+    energy[1].time_us += time_us_64() - last_us;
+}
+#endif
+
+#ifdef LCD_TRANSPORT_BENCH
+// 传输后端基准: 每个后端推送10帧整屏(10行一个窗口, 和LVGL的PARTIAL刷新一样),
+// 输出每帧的推送时间和CPU花在写入调用里的时间
+static void lcd_transport_bench(void)
+{
+    static const lcd_transport_t *const backends[] = { &lcd_transport_spi, &lcd_transport_pio };
+    const lcd_transport_t *def = lcd_get_transport();
+    uint16_t *px = (uint16_t *)buf1;
+
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        lcd_set_transport(backends[b]);
+        uint64_t cpu_us = 0;
+        uint64_t t0 = time_us_64();
+        for (int f = 0; f < 10; f++) {
+            for (int i = 0; i < LCD_WIDTH * 10; i++) px[i] = (uint16_t)(f * 0x0841 + i);
+            for (int y = 0; y < LCD_HEIGHT; y += 10) {
+                uint64_t c0 = time_us_64();
+                lcd_set_window(0, y, LCD_WIDTH - 1, y + 9);
+                lcd_write_pixels_async(px, LCD_WIDTH * 10, NULL, NULL);
+                cpu_us += time_us_64() - c0;
+            }
+            lcd_wait_idle();
+        }
+        uint64_t frame_us = (time_us_64() - t0) / 10;
+        printf("lcd bench %s: frame %llu us, cpu %llu us\n", backends[b]->name, frame_us, cpu_us / 10);
+    }
+    lcd_set_transport(def);
+}
+#endif
+
 // 主函数
 int main()
 {
+    boot_mark("main");
     stdio_init_all();
-    lcd_init();
+    rtc_init();
+    rtc_set_datetime(&rtc_start);
+    boot_mark("stdio rtc");
+
+    // 面板复位和退出睡眠(约175ms)由闹钟推进, 同时初始化LVGL、创建表盘并渲染第一帧
+    lcd_init_async();
+#ifdef LCD_TRANSPORT_BENCH
+    lcd_wait_ready();
+    lcd_set_backlight(true);
+    lcd_transport_bench();
+#endif
     lvgl_init();
+#ifdef XIP_PROFILE
+    xip_profile_init();
+#endif
+
+    frame_pacer_init(&pacer_cfg);
+#ifdef CLOCK_GOVERNOR
+    gov_init();
+#endif
+
+    // 第一帧不等TE(面板还没有输出TE), 第一块在 disp_flush 中等面板就绪。
+    // 整帧写完再开背光, 不显示上电时显存里的随机内容
+    update_time(NULL);
+    lv_display_refr_timer(NULL);
+    lcd_wait_idle();
+    lcd_set_backlight(true);
+    boot_mark("first frame");
+
+    lcd_set_te_callback(frame_pacer_te_edge);
+#ifdef ALWAYS_ON_DISPLAY
+    wake_gpio_init();
+#endif
+
+    uint64_t last_us = time_us_64();
+#ifdef ALWAYS_ON_DISPLAY
+    uint64_t active_us = last_us;
+#endif
+    energy_report_us = last_us;
 
     while (1) {
+        uint64_t start_us = time_us_64();
+        uint32_t spi_start = lcd_get_spi_bytes();
+
+#ifdef ALWAYS_ON_DISPLAY
+        if (aod_take_wake_request()) active_us = start_us;
+#endif
+
+        // 先执行其他线程/核心投递的UI更新, 再渲染
+        ui_queue_drain();
         lv_timer_handler();
-        sleep_ms(5);
+
+        // TE沿之后立即渲染, 让渲染、传输和面板扫描流水线衔接
+        if (frame_pacer_refr_due(time_us_32())) {
+#ifdef XIP_PROFILE
+            xip_profile_frame_begin();
+#endif
+            lv_display_refr_timer(NULL);
+#ifdef XIP_PROFILE
+            xip_profile_frame_end();
+#endif
+        }
+#ifdef CLOCK_GOVERNOR
+        gov_poll();
+#endif
+
+        uint64_t end_us = time_us_64();
+        energy_add(0, start_us, end_us, spi_start);
+        energy[0].time_us += end_us - last_us;
+        last_us = end_us;
+        energy_report(end_us);
+
+        if (!boot_reported && end_us >= BOOT_REPORT_MS * 1000ull) {
+            boot_reported = true;
+            boot_timeline_print();
+        }
+
+#ifdef ALWAYS_ON_DISPLAY
+        if (end_us - active_us >= AOD_IDLE_MS * 1000ull) {
+            aod_enter();
+            aod_run();
+            aod_exit();
+            active_us = last_us = time_us_64();
+            continue;
+        }
+#endif
+
+        uint32_t idle = frame_pacer_get_idle_us(time_us_32());
+        sleep_us(idle < 5000 ? idle : 5000);
     }
 
     return 0;
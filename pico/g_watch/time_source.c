@@ -0,0 +1,66 @@
+#include "time_source.h"
+#include <stdbool.h>
+
+// 亚秒时间源, 见 time_source.h
+
+#define SECOND_US   1000000ull
+
+static watch_time_t last;           // 最近一次RTC读数
+static uint64_t last_us;
+static bool have_sample;
+
+static uint64_t edge_lo;            // 最近一次秒边沿所在的区间 (edge_lo, edge_hi]
+static uint64_t edge_hi;
+static bool have_edge;
+static uint16_t last_ms;            // 同一秒内已经返回过的最大毫秒数
+
+static bool same_second(const watch_time_t *a, const watch_time_t *b) {
+    return a->sec == b->sec && a->min == b->min && a->hour == b->hour && a->day == b->day && a->month == b->month;
+}
+
+void time_source_update(const watch_time_t *rtc, uint64_t now_us) {
+    if (have_sample && !same_second(rtc, &last)) {
+        // 秒边沿在两次读数之间; 两次读数相隔超过1秒时, 只可能在最后1秒内
+        uint64_t start = now_us - last_us > SECOND_US ? now_us - SECOND_US : last_us;
+        uint64_t lo = start;
+        uint64_t hi = now_us;
+
+        // 相位不变: 之前的区间平移整数秒后求交集, 对不上说明RTC被重新设置过
+        if (have_edge) {
+            uint64_t n = ((lo + hi) / 2 - (edge_lo + edge_hi) / 2 + SECOND_US / 2) / SECOND_US;
+            uint64_t plo = edge_lo + n * SECOND_US;
+            uint64_t phi = edge_hi + n * SECOND_US;
+            if (plo > lo) lo = plo;
+            if (phi < hi) hi = phi;
+            if (lo >= hi) {
+                lo = start;
+                hi = now_us;
+            }
+        }
+        edge_lo = lo;
+        edge_hi = hi;
+        have_edge = true;
+        last_ms = 0;
+    }
+    last = *rtc;
+    last_us = now_us;
+    have_sample = true;
+}
+
+void time_source_get(uint64_t now_us, watch_time_t *t) {
+    *t = last;
+    t->ms = 0;
+    if (!have_edge) return;
+
+    uint64_t edge = edge_lo + (edge_hi - edge_lo) / 2;
+    uint64_t ms = now_us > edge ? (now_us - edge) / 1000 : 0;
+    if (ms > 999) ms = 999;     // RTC还没有进位(读数过旧或估计偏早), 停在这一秒的末尾
+    if (ms < last_ms) ms = last_ms;
+    last_ms = (uint16_t)ms;
+    t->ms = (uint16_t)ms;
+}
+
+uint32_t time_source_get_uncertainty_us(void) {
+    if (!have_edge) return UINT32_MAX;
+    return (uint32_t)(edge_hi - edge_lo);
+}
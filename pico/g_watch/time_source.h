@@ -0,0 +1,24 @@
+#ifndef TIME_SOURCE_H
+#define TIME_SOURCE_H
+
+#include <stdint.h>
+#include "watch_face.h"
+
+// 亚秒时间源: RTC只有秒分辨率, 用微秒计数器(time_us_64())插值出毫秒
+// RTC和微秒计数器都来自同一个12MHz晶振(RTC: USB PLL / 1024 = 46875Hz, 计时器: clk_ref / 12),
+// 秒边沿相对微秒计数器的相位是固定的。每次看到RTC的秒变化, 边沿就落在上一次读数和这一次读数之间;
+// 把之前的区间平移整数秒后和新区间求交集, 几秒之后相位就能确定到远小于读数间隔的精度。
+// 毫秒 = 现在 - 最近一次秒边沿的估计(区间中点), 限制在0..999, 同一秒内不回退。
+// RTC被重新设置(区间对不上)时从头开始估计。
+// 不依赖SDK: 设备端 main.c 提供RTC读数, 主机端 test/sec_sweep_bench.c 用模拟的RTC测试。
+
+// 用一次RTC读数更新, now_us 为读取时的 time_us_64()
+void time_source_update(const watch_time_t *rtc, uint64_t now_us);
+
+// 最近一次RTC读数加上毫秒(t->ms); now_us 不能早于最近一次更新
+void time_source_get(uint64_t now_us, watch_time_t *t);
+
+// 秒边沿估计的不确定度(区间宽度), 还没有看到秒变化时返回 UINT32_MAX
+uint32_t time_source_get_uncertainty_us(void);
+
+#endif // TIME_SOURCE_H
@@ -0,0 +1,489 @@
+#!/usr/bin/env python3
+
+"""
+把表盘的图片和字体打包成资源包(格式见 asset_pack.h)。
+
+输入:
+  图片  LVGL .bin 图片(LVGLImage.py 生成), 可用 :rle 在打包时做RLE压缩;
+        行连续存放的格式按 --band-height 行一带分别压缩, 绘制时只解压用到的行带;
+        调色板格式(I1/I2/I4/I8)不压缩, 绘制时直接按调色板混合, 压缩后反而要整图展开
+  字体  lv_font_conv --format bin 生成的字体, 预解析成 lv_font_fmt_txt 布局(零拷贝加载);
+        用 :bin 则原样保存, 运行时交给 lv_binfont_loader
+  其他  任意文件(:raw)
+
+用法:
+  asset_pack.py -o face.pack bg=bg.bin hands=hands.bin:rle clock_24=font24.fnt
+  asset_pack.py -o face.pack --uf2 face.uf2 ...   同时生成可拖拽烧录到 ASSET_PACK_FLASH_OFFSET 的UF2
+  asset_pack.py --list face.pack
+"""
+
+import argparse
+import struct
+import sys
+
+PACK_MAGIC = 0x4b504157  # "WAPK"
+PACK_VERSION = 1
+PACK_ALIGN = 16
+NAME_MAX = 20
+HEADER_FMT = '<IHHII'
+ENTRY_FMT = '<%dsB3xII' % NAME_MAX
+
+TYPE_IMAGE = 1
+TYPE_FONT = 2
+TYPE_FONT_BIN = 3
+TYPE_RAW = 4
+TYPE_NAMES = {TYPE_IMAGE: 'image', TYPE_FONT: 'font', TYPE_FONT_BIN: 'font_bin', TYPE_RAW: 'raw'}
+
+# 与 asset_pack.h 中 ASSET_PACK_FLASH_OFFSET 一致
+FLASH_OFFSET = 1024 * 1024
+XIP_BASE = 0x10000000
+UF2_FAMILY_RP2040 = 0xe48bff56
+
+IMAGE_MAGIC = 0x19
+IMAGE_FLAG_COMPRESSED = 0x08
+IMAGE_HEADER_SIZE = 12
+COMPRESS_RLE = 1
+# 行连续存放、可以分行带压缩的格式: RGB888 ARGB8888 XRGB8888 RGB565 ARGB8565
+BAND_CF = (0x0F, 0x10, 0x11, 0x12, 0x13)
+BAND_HEIGHT_MAX = 0xfff
+
+CF_RGB565A8 = 0x14
+CF_INDEXED = (0x07, 0x08, 0x09, 0x0A)
+CF_BPP = {
+    0x06: 8, 0x07: 1, 0x08: 2, 0x09: 4, 0x0A: 8, 0x0B: 1, 0x0C: 2, 0x0D: 4, 0x0E: 8,
+    0x0F: 24, 0x10: 32, 0x11: 32, 0x12: 16, 0x13: 24, 0x14: 16, 0x15: 16, 0x16: 16, 0x17: 16,
+}
+
+CMAP_FORMAT0_FULL = 0
+CMAP_SPARSE_FULL = 1
+CMAP_FORMAT0_TINY = 2
+CMAP_SPARSE_TINY = 3
+
+KERN_NONE = 0
+KERN_PAIRS = 1
+KERN_CLASSES = 2
+
+FONT_HEADER_FMT = '<hhbbBBBBHHHIIII'
+FONT_CMAP_FMT = '<IHHHBxII'
+FONT_KERN_FMT = '<IBBBxIII'
+
+
+def align_up(v, a):
+    return (v + a - 1) // a * a
+
+
+# ----------------------------------------------------------------------------
+# 图片
+# ----------------------------------------------------------------------------
+
+def rle_compress(data, blk):
+    '''与 lv_rle_decompress() 对应: 控制字节最高位为1表示后面跟 n 个原样块, 否则表示后面的块重复 n 次'''
+    out = bytearray()
+    n_blk = len(data) // blk
+    i = 0
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:127]
+            del literal[:127]
+            out.append(0x80 | len(chunk))
+            for b in chunk:
+                out.extend(data[b * blk:(b + 1) * blk])
+
+    while i < n_blk:
+        cur = data[i * blk:(i + 1) * blk]
+        run = 1
+        while i + run < n_blk and run < 127 and data[(i + run) * blk:(i + run + 1) * blk] == cur:
+            run += 1
+        # 短重复不值得单独编码
+        if run >= 3:
+            flush_literal()
+            out.append(run)
+            out += cur
+        else:
+            literal.extend(range(i, i + run))
+        i += run
+    flush_literal()
+    return bytes(out)
+
+
+def rle_compress_bands(pixels, stride, h, band_height, blk):
+    '''分行带压缩: 偏移表(band_cnt + 1 项, 相对表头) + 各行带的RLE数据'''
+    bands = []
+    for y in range(0, h, band_height):
+        band = pixels[y * stride:min(y + band_height, h) * stride]
+        bands.append(rle_compress(band + b'\0' * (-len(band) % blk), blk))
+    ofs = [(len(bands) + 1) * 4]
+    for band in bands:
+        ofs.append(ofs[-1] + len(band))
+    return struct.pack('<%dI' % len(ofs), *ofs) + b''.join(bands)
+
+
+def load_image(path, compress, band_height):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if len(data) < IMAGE_HEADER_SIZE or data[0] != IMAGE_MAGIC:
+        raise ValueError('%s: not an LVGL v9 .bin image' % path)
+
+    magic, cf, flags, w, h, stride, _ = struct.unpack_from('<BBHHHHH', data, 0)
+    if compress != 'rle' or flags & IMAGE_FLAG_COMPRESSED:
+        return data
+    if cf in CF_INDEXED:
+        print('%s: indexed image, stored uncompressed' % path, file=sys.stderr)
+        return data
+
+    pixels = data[IMAGE_HEADER_SIZE:]
+    blk = 2 if cf == CF_RGB565A8 else (CF_BPP.get(cf, 8) + 7) // 8
+    if band_height and cf in BAND_CF and len(pixels) == stride * h:
+        compressed = rle_compress_bands(pixels, stride, h, band_height, blk)
+        method = COMPRESS_RLE | band_height << 4
+    else:
+        compressed = rle_compress(pixels + b'\0' * (-len(pixels) % blk), blk)
+        method = COMPRESS_RLE
+    header = struct.pack('<BBHHHHH', magic, cf, flags | IMAGE_FLAG_COMPRESSED, w, h, stride, 0)
+    return header + struct.pack('<III', method, len(compressed), len(pixels)) + compressed
+
+
+def image_info(data):
+    _, cf, flags, w, h, stride, _ = struct.unpack_from('<BBHHHHH', data, 0)
+    info = '%dx%d cf=0x%02x stride=%d' % (w, h, cf, stride)
+    if flags & IMAGE_FLAG_COMPRESSED:
+        method, csize, dsize = struct.unpack_from('<III', data, IMAGE_HEADER_SIZE)
+        info += ' %s %d->%d' % ('rle' if method & 0xf == COMPRESS_RLE else 'lz4', dsize, csize)
+        if method >> 4:
+            info += ' bands=%d' % (method >> 4 & BAND_HEIGHT_MAX)
+    return info
+
+
+# ----------------------------------------------------------------------------
+# 字体: 解析 lv_font_conv 的 .bin 格式(与 lv_binfont_loader.c 相同的规则)
+# ----------------------------------------------------------------------------
+
+class BitReader:
+    def __init__(self, data, pos):
+        self.data = data
+        self.bit = pos * 8
+
+    def read(self, n):
+        v = 0
+        for _ in range(n):
+            byte = self.data[self.bit >> 3]
+            v = (v << 1) | ((byte >> (7 - (self.bit & 7))) & 1)
+            self.bit += 1
+        return v
+
+    def read_signed(self, n):
+        v = self.read(n)
+        if n and v & (1 << (n - 1)):
+            v -= 1 << n
+        return v
+
+
+def read_table(data, pos, label):
+    length, name = struct.unpack_from('<I4s', data, pos)
+    if name != label.encode():
+        raise ValueError('missing "%s" table' % label)
+    return length
+
+
+def parse_binfont(data):
+    font = {}
+    head_len = read_table(data, 0, 'head')
+    (_, tables_cnt, _, ascent, descent, _, _, _, _, _, default_adv_w, kern_scale,
+     loc_format, glyph_id_format, adv_w_format, bpp, xy_bits, wh_bits, adv_w_bits,
+     compression, subpx, _, underline_pos, underline_thick) = struct.unpack_from(
+        '<IHHHhHhHhhHHBBBBBBBBBBhH', data, 8)
+
+    font.update(line_height=ascent - descent, base_line=-descent, bpp=bpp, kern_scale=kern_scale,
+                bitmap_format=compression, subpx=subpx,
+                underline_position=max(-128, min(127, underline_pos)),
+                underline_thickness=max(-128, min(127, underline_thick)))
+
+    # cmap
+    cmap_start = head_len
+    cmap_len = read_table(data, cmap_start, 'cmap')
+    (sub_cnt,) = struct.unpack_from('<I', data, cmap_start + 8)
+    cmaps = []
+    for i in range(sub_cnt):
+        ofs, range_start, range_len, gid_start, entries, fmt = struct.unpack_from(
+            '<IIHHHBx', data, cmap_start + 12 + i * 16)
+        c = {'range_start': range_start, 'range_length': range_len, 'glyph_id_start': gid_start,
+             'type': fmt, 'list_length': 0, 'unicode_list': None, 'glyph_id_ofs_list': None}
+        pos = cmap_start + ofs
+        if fmt == CMAP_FORMAT0_FULL:
+            c['glyph_id_ofs_list'] = data[pos:pos + entries]
+            c['list_length'] = range_len
+        elif fmt in (CMAP_SPARSE_FULL, CMAP_SPARSE_TINY):
+            c['list_length'] = entries
+            c['unicode_list'] = data[pos:pos + entries * 2]
+            if fmt == CMAP_SPARSE_FULL:
+                c['glyph_id_ofs_list'] = data[pos + entries * 2:pos + entries * 4]
+        elif fmt != CMAP_FORMAT0_TINY:
+            raise ValueError('unknown cmap format %d' % fmt)
+        cmaps.append(c)
+    font['cmaps'] = cmaps
+
+    # loca
+    loca_start = cmap_start + cmap_len
+    loca_len = read_table(data, loca_start, 'loca')
+    (loca_cnt,) = struct.unpack_from('<I', data, loca_start + 8)
+    fmt = '<%d%s' % (loca_cnt, 'H' if loc_format == 0 else 'I')
+    offsets = list(struct.unpack_from(fmt, data, loca_start + 12))
+
+    # glyf
+    glyf_start = loca_start + loca_len
+    glyf_len = read_table(data, glyf_start, 'glyf')
+    nbits = adv_w_bits + 2 * xy_bits + 2 * wh_bits
+    glyphs = []
+    bitmap = bytearray()
+    for i in range(loca_cnt):
+        it = BitReader(data, glyf_start + offsets[i])
+        adv_w = it.read(adv_w_bits) if adv_w_bits else default_adv_w
+        if adv_w_format == 0:
+            adv_w *= 16
+        ofs_x = it.read_signed(xy_bits)
+        ofs_y = it.read_signed(xy_bits)
+        box_w = it.read(wh_bits)
+        box_h = it.read(wh_bits)
+        end = offsets[i + 1] if i + 1 < loca_cnt else glyf_len
+        bmp_size = end - offsets[i] - nbits // 8
+        if i == 0:
+            adv_w = box_w = box_h = ofs_x = ofs_y = 0
+
+        index = len(bitmap)
+        if box_w * box_h and i:
+            # 位图紧跟在不定长的字形头后面, 不一定从字节边界开始
+            if nbits % 8 == 0:
+                pos = glyf_start + offsets[i] + nbits // 8
+                bitmap += data[pos:pos + bmp_size]
+            else:
+                for _ in range(bmp_size - 1):
+                    bitmap.append(it.read(8))
+                bitmap.append((it.read(8 - nbits % 8) << (nbits % 8)) & 0xff)
+
+        if index >= 1 << 20 or adv_w >= 1 << 12 or box_w > 255 or box_h > 255:
+            raise ValueError('glyph %d does not fit lv_font_fmt_txt_glyph_dsc_t' % i)
+        glyphs.append((index, adv_w, box_w, box_h, ofs_x, ofs_y))
+    font['glyphs'] = glyphs
+    font['bitmap'] = bytes(bitmap)
+
+    # kern
+    font['kern'] = None
+    if tables_cnt >= 4:
+        kern_start = glyf_start + glyf_len
+        read_table(data, kern_start, 'kern')
+        kern_fmt = data[kern_start + 8]
+        pos = kern_start + 12
+        if kern_fmt == 0:
+            (cnt,) = struct.unpack_from('<I', data, pos)
+            ids_size = cnt * 2 * (1 if glyph_id_format == 0 else 2)
+            font['kern'] = {'type': KERN_PAIRS, 'cnt': cnt, 'ids_size': glyph_id_format,
+                            'ids': data[pos + 4:pos + 4 + ids_size],
+                            'values': data[pos + 4 + ids_size:pos + 4 + ids_size + cnt]}
+        elif kern_fmt == 3:
+            map_len, rows, cols = struct.unpack_from('<HBB', data, pos)
+            pos += 4
+            font['kern'] = {'type': KERN_CLASSES, 'cnt': map_len, 'rows': rows, 'cols': cols,
+                            'left': data[pos:pos + map_len],
+                            'right': data[pos + map_len:pos + 2 * map_len],
+                            'values': data[pos + 2 * map_len:pos + 2 * map_len + rows * cols]}
+        else:
+            raise ValueError('unknown kern format %d' % kern_fmt)
+
+    return font
+
+
+def build_font(font):
+    '''生成 asset_pack.c 中描述的预解析字体布局'''
+    cmaps = font['cmaps']
+    kern = font['kern']
+    header_size = struct.calcsize(FONT_HEADER_FMT)
+    cmap_ofs = header_size
+    kern_ofs = cmap_ofs + len(cmaps) * struct.calcsize(FONT_CMAP_FMT)
+    glyph_dsc_ofs = kern_ofs + (struct.calcsize(FONT_KERN_FMT) if kern else 0)
+
+    body = bytearray()
+    # lv_font_fmt_txt_glyph_dsc_t: bitmap_index:20 | adv_w:12, box_w, box_h, ofs_x, ofs_y
+    for index, adv_w, box_w, box_h, ofs_x, ofs_y in font['glyphs']:
+        body += struct.pack('<IBBbb', index | (adv_w << 20), box_w, box_h, ofs_x, ofs_y)
+
+    base = glyph_dsc_ofs
+
+    def put(blob, align):
+        while (base + len(body)) % align:
+            body.append(0)
+        ofs = base + len(body)
+        body.extend(blob)
+        return ofs
+
+    cmap_recs = []
+    for c in cmaps:
+        uni = put(c['unicode_list'], 2) if c['unicode_list'] is not None else 0
+        gid = put(c['glyph_id_ofs_list'], 2) if c['glyph_id_ofs_list'] is not None else 0
+        cmap_recs.append(struct.pack(FONT_CMAP_FMT, c['range_start'], c['range_length'], c['glyph_id_start'],
+                                     c['list_length'], c['type'], uni, gid))
+
+    kern_type = KERN_NONE
+    kern_rec = b''
+    if kern and kern['type'] == KERN_PAIRS:
+        kern_type = KERN_PAIRS
+        ids = put(kern['ids'], 2)
+        values = put(kern['values'], 1)
+        kern_rec = struct.pack(FONT_KERN_FMT, kern['cnt'], kern['ids_size'], 0, 0, ids, values, 0)
+    elif kern:
+        kern_type = KERN_CLASSES
+        values = put(kern['values'], 1)
+        left = put(kern['left'], 1)
+        right = put(kern['right'], 1)
+        kern_rec = struct.pack(FONT_KERN_FMT, kern['cnt'], 0, kern['rows'], kern['cols'], values, left, right)
+
+    bitmap_ofs = put(font['bitmap'], 4)
+
+    header = struct.pack(FONT_HEADER_FMT, font['line_height'], font['base_line'], font['underline_position'],
+                         font['underline_thickness'], font['subpx'], font['bpp'], font['bitmap_format'],
+                         kern_type, font['kern_scale'], len(cmaps), len(font['glyphs']),
+                         glyph_dsc_ofs, bitmap_ofs, cmap_ofs, kern_ofs if kern else 0)
+    return header + b''.join(cmap_recs) + kern_rec + bytes(body)
+
+
+def load_font(path, mode):
+    with open(path, 'rb') as f:
+        data = f.read()
+    if mode == 'bin':
+        read_table(data, 0, 'head')
+        return data
+    return build_font(parse_binfont(data))
+
+
+# ----------------------------------------------------------------------------
+# 打包
+# ----------------------------------------------------------------------------
+
+def parse_item(spec):
+    '''name=path[:rle|:bin|:raw]'''
+    if '=' not in spec:
+        raise ValueError('expected name=path, got %r' % spec)
+    name, path = spec.split('=', 1)
+    opt = ''
+    if ':' in path and path.rsplit(':', 1)[1] in ('rle', 'bin', 'raw'):
+        path, opt = path.rsplit(':', 1)
+    if not name or len(name.encode()) >= NAME_MAX:
+        raise ValueError('name must be 1..%d bytes: %r' % (NAME_MAX - 1, name))
+    return name, path, opt
+
+
+def load_item(path, opt, band_height):
+    if opt == 'raw':
+        with open(path, 'rb') as f:
+            return TYPE_RAW, f.read()
+    with open(path, 'rb') as f:
+        head = f.read(8)
+    if head[:1] == bytes([IMAGE_MAGIC]):
+        return TYPE_IMAGE, load_image(path, opt, band_height)
+    if head[4:8] == b'head':
+        return (TYPE_FONT_BIN if opt == 'bin' else TYPE_FONT), load_font(path, opt)
+    raise ValueError('%s: unknown asset type, use :raw to store it as is' % path)
+
+
+def build_pack(items):
+    items = sorted(items, key=lambda it: it[0].encode())
+    names = [it[0] for it in items]
+    if len(set(names)) != len(names):
+        raise ValueError('duplicate asset names')
+
+    header_size = struct.calcsize(HEADER_FMT)
+    entry_size = struct.calcsize(ENTRY_FMT)
+    pos = header_size + len(items) * entry_size
+
+    entries = []
+    body = bytearray()
+    for name, type_, data in items:
+        # 图片的像素(12字节头之后)对齐, 其他数据本身对齐
+        skew = IMAGE_HEADER_SIZE if type_ == TYPE_IMAGE else 0
+        start = align_up(pos + skew, PACK_ALIGN) - skew
+        body += b'\0' * (start - pos)
+        entries.append(struct.pack(ENTRY_FMT, name.encode(), type_, start, len(data)))
+        body += data
+        pos = start + len(data)
+
+    total = align_up(pos, 4)
+    body += b'\0' * (total - pos)
+    header = struct.pack(HEADER_FMT, PACK_MAGIC, PACK_VERSION, len(items), total, 0)
+    return header + b''.join(entries) + bytes(body)
+
+
+def to_uf2(data, address):
+    '''每块256字节有效数据的UF2, 可直接拖到RP2040的BOOTSEL盘'''
+    blocks = [data[i:i + 256] for i in range(0, len(data), 256)]
+    out = bytearray()
+    for n, blk in enumerate(blocks):
+        out += struct.pack('<IIIIIIII', 0x0A324655, 0x9E5D5157, 0x00002000, address + n * 256, 256, n,
+                           len(blocks), UF2_FAMILY_RP2040)
+        out += blk.ljust(476, b'\0')
+        out += struct.pack('<I', 0x0AB16F30)
+    return bytes(out)
+
+
+def list_pack(path):
+    with open(path, 'rb') as f:
+        data = f.read()
+    magic, version, cnt, size, _ = struct.unpack_from(HEADER_FMT, data, 0)
+    if magic != PACK_MAGIC:
+        raise ValueError('%s: not an asset pack' % path)
+    print('version %d, %d entries, %d bytes' % (version, cnt, size))
+    for i in range(cnt):
+        name, type_, ofs, length = struct.unpack_from(ENTRY_FMT, data, struct.calcsize(HEADER_FMT) +
+                                                      i * struct.calcsize(ENTRY_FMT))
+        info = image_info(data[ofs:ofs + length]) if type_ == TYPE_IMAGE else ''
+        print('  %-20s %-8s @%-8d %8d  %s' % (name.rstrip(b'\0').decode(), TYPE_NAMES.get(type_, '?'),
+                                            ofs, length, info))
+
+
+def get_arg():
+    parser = argparse.ArgumentParser(description='Build a watch face asset pack.')
+    parser.add_argument('items', nargs='*', metavar='name=path[:rle|:bin|:raw]',
+                        help='Asset to add. Images are LVGL .bin files, fonts are lv_font_conv .bin files.')
+    parser.add_argument('-o', '--output', help='The asset pack to write.')
+    parser.add_argument('--uf2', help='Also write a UF2 that flashes the pack to the asset partition.')
+    parser.add_argument('--flash-offset', type=lambda s: int(s, 0), default=FLASH_OFFSET,
+                        help='Flash offset of the asset partition. Default: 0x%x' % FLASH_OFFSET)
+    parser.add_argument('--band-height', type=int, default=16,
+                        help='Rows per band of RLE images, 0 compresses the whole image as one block. Default: 16')
+    parser.add_argument('--list', metavar='PACK', help='Print the index of an asset pack and exit.')
+    return parser.parse_args()
+
+
+if __name__ == '__main__':
+    args = get_arg()
+
+    try:
+        if args.list:
+            list_pack(args.list)
+            sys.exit(0)
+
+        if not args.output or not args.items:
+            print('error: -o and at least one asset are required', file=sys.stderr)
+            sys.exit(2)
+
+        if not 0 <= args.band_height <= BAND_HEIGHT_MAX:
+            print('error: --band-height must be 0..%d' % BAND_HEIGHT_MAX, file=sys.stderr)
+            sys.exit(2)
+
+        items = []
+        for spec in args.items:
+            name, path, opt = parse_item(spec)
+            type_, data = load_item(path, opt, args.band_height)
+            items.append((name, type_, data))
+
+        pack = build_pack(items)
+        with open(args.output, 'wb') as f:
+            f.write(pack)
+        if args.uf2:
+            with open(args.uf2, 'wb') as f:
+                f.write(to_uf2(pack, XIP_BASE + args.flash_offset))
+    except (OSError, ValueError, struct.error) as e:
+        print('error:', e, file=sys.stderr)
+        sys.exit(1)
+
+    print('%s: %d assets, %d bytes' % (args.output, len(items), len(pack)))
@@ -0,0 +1,335 @@
+#!/usr/bin/env python3
+
+"""
+把JSON表盘描述编译成常量LVGL样式和平铺的控件表(格式见 face_table.h)。
+
+描述文件:
+  {
+    "name": "sim_face",
+    "styles": {"clock": {"bg_color": "#f7e8e3", "radius": "circle", "shadow_opa": "30%", ...}, ...},
+    "objects": [
+      {"id": "clock", "type": "obj", "style": "clock", "size": [240, 240], "align": "center"},
+      {"parent": "clock", "type": "label", "style": "brand", "align": "center", "pos": [0, -30], "text": "..."},
+      {"id": "hand", "parent": "clock", "type": "line", "style": "hand", "pivot": [120, 120], "points": [[0, 0], [0, -40]]},
+      ...
+    ]
+  }
+  样式属性见 PROPS: 颜色 "#rrggbb", 透明度 0..255 或 "30%", 字体 "default" 或 "montserrat_16"。
+  控件: type 为 obj/label/line; parent 引用之前某个控件的 id(省略时为根);
+        size [w, h](可用 "content")、align、pos [x, y]、rotation(0.1度)、pivot [x, y] 编译成布局样式,
+        相同的布局只生成一份; 有 id 的控件在头文件中生成下标常量 <NAME>_<ID>。
+输出 <输出前缀>.c 和 <输出前缀>.h, 生成的文件提交到仓库, 编译时不需要Python。
+
+用法:
+  face_gen.py test/sim_face.json                      输出 test/sim_face_gen.c/.h
+  face_gen.py test/sim_face.json -o build/my_face     输出 build/my_face.c/.h
+  face_gen.py test/sim_face.json --check              生成的文件和描述不一致时返回1
+"""
+
+import argparse
+import json
+import os
+import re
+import sys
+
+COLOR = 'color'
+OPA = 'opa'
+NUM = 'num'
+BOOL = 'bool'
+FONT = 'font'
+GRAD_DIR = 'grad_dir'
+
+# 支持的样式属性: JSON键 -> 类型, 宏名为 LV_STYLE_CONST_<键的大写>
+PROPS = {
+    'bg_color': COLOR, 'bg_grad_color': COLOR, 'bg_grad_dir': GRAD_DIR, 'bg_opa': OPA,
+    'border_color': COLOR, 'border_width': NUM, 'border_opa': OPA,
+    'outline_color': COLOR, 'outline_width': NUM, 'outline_pad': NUM,
+    'shadow_color': COLOR, 'shadow_width': NUM, 'shadow_spread': NUM, 'shadow_opa': OPA,
+    'shadow_offset_x': NUM, 'shadow_offset_y': NUM,
+    'radius': NUM, 'opa': OPA,
+    'pad_top': NUM, 'pad_bottom': NUM, 'pad_left': NUM, 'pad_right': NUM,
+    'text_color': COLOR, 'text_opa': OPA, 'text_font': FONT,
+    'line_color': COLOR, 'line_width': NUM, 'line_opa': OPA, 'line_rounded': BOOL,
+    'arc_color': COLOR, 'arc_width': NUM, 'arc_rounded': BOOL,
+}
+
+GRAD_DIRS = {'none': 'LV_GRAD_DIR_NONE', 'ver': 'LV_GRAD_DIR_VER', 'hor': 'LV_GRAD_DIR_HOR'}
+
+ALIGNS = [
+    'default', 'top_left', 'top_mid', 'top_right', 'bottom_left', 'bottom_mid', 'bottom_right',
+    'left_mid', 'right_mid', 'center',
+]
+
+TYPES = {'obj': 'FACE_TABLE_OBJ', 'label': 'FACE_TABLE_LABEL', 'line': 'FACE_TABLE_LINE'}
+
+NUM_WORDS = {'circle': 'LV_RADIUS_CIRCLE', 'content': 'LV_SIZE_CONTENT'}
+
+IDENT_RE = re.compile(r'^[a-z_][a-z0-9_]*$')
+
+
+def fail(msg):
+    sys.exit('error: %s' % msg)
+
+
+def c_color(v, where):
+    m = re.fullmatch(r'#([0-9a-fA-F]{2})([0-9a-fA-F]{2})([0-9a-fA-F]{2})', str(v))
+    if not m:
+        fail('%s: color must be "#rrggbb", got %r' % (where, v))
+    return 'LV_COLOR_MAKE(0x%s, 0x%s, 0x%s)' % tuple(g.lower() for g in m.groups())
+
+
+def c_opa(v, where):
+    if isinstance(v, str) and v.endswith('%'):
+        pct = int(v[:-1])
+        if not 0 <= pct <= 100:
+            fail('%s: opacity out of range: %r' % (where, v))
+        return 'LV_OPA_%d' % pct if pct % 10 == 0 else str((pct * 255 + 50) // 100)
+    if isinstance(v, int) and 0 <= v <= 255:
+        return str(v)
+    fail('%s: opacity must be 0..255 or "N%%", got %r' % (where, v))
+
+
+def c_num(v, where):
+    if isinstance(v, bool) or not isinstance(v, (int, str)):
+        fail('%s: expected a number, got %r' % (where, v))
+    if isinstance(v, str):
+        if v not in NUM_WORDS:
+            fail('%s: unknown value %r' % (where, v))
+        return NUM_WORDS[v]
+    return str(v)
+
+
+def c_value(kind, v, where):
+    if kind == COLOR:
+        return c_color(v, where)
+    if kind == OPA:
+        return c_opa(v, where)
+    if kind == NUM:
+        return c_num(v, where)
+    if kind == BOOL:
+        if not isinstance(v, bool):
+            fail('%s: expected true/false, got %r' % (where, v))
+        return 'true' if v else 'false'
+    if kind == FONT:
+        if v == 'default':
+            return 'LV_FONT_DEFAULT'
+        if not isinstance(v, str) or not IDENT_RE.match(v):
+            fail('%s: bad font name %r' % (where, v))
+        return '&lv_font_%s' % v
+    if kind == GRAD_DIR:
+        if v not in GRAD_DIRS:
+            fail('%s: bad gradient direction %r' % (where, v))
+        return GRAD_DIRS[v]
+    raise AssertionError(kind)
+
+
+def pair(v, where):
+    if not isinstance(v, list) or len(v) != 2:
+        fail('%s: expected [a, b], got %r' % (where, v))
+    return v
+
+
+def layout_props(obj, where):
+    """控件的布局属性: [(宏名, C值)], 顺序固定, 用于去重"""
+    props = []
+    if 'size' in obj:
+        w, h = pair(obj['size'], where + '.size')
+        props.append(('WIDTH', c_num(w, where + '.size')))
+        props.append(('HEIGHT', c_num(h, where + '.size')))
+    if 'align' in obj:
+        if obj['align'] not in ALIGNS:
+            fail('%s: bad align %r' % (where, obj['align']))
+        props.append(('ALIGN', 'LV_ALIGN_%s' % obj['align'].upper()))
+    if 'pos' in obj:
+        x, y = pair(obj['pos'], where + '.pos')
+        props.append(('X', c_num(x, where + '.pos')))
+        props.append(('Y', c_num(y, where + '.pos')))
+    if obj.get('rotation'):
+        props.append(('TRANSFORM_ROTATION', c_num(obj['rotation'], where + '.rotation')))
+    if 'pivot' in obj:
+        x, y = pair(obj['pivot'], where + '.pivot')
+        props.append(('TRANSFORM_PIVOT_X', c_num(x, where + '.pivot')))
+        props.append(('TRANSFORM_PIVOT_Y', c_num(y, where + '.pivot')))
+    return tuple(props)
+
+
+def c_string(s):
+    return '"%s"' % s.replace('\\', '\\\\').replace('"', '\\"')
+
+
+def props_array(name, props):
+    lines = ['static const lv_style_const_prop_t %s_props[] = {' % name]
+    for macro, value in props:
+        lines.append('    LV_STYLE_CONST_%s(%s),' % (macro, value))
+    lines.append('    LV_STYLE_CONST_PROPS_END')
+    lines.append('};')
+    lines.append('static LV_STYLE_CONST_INIT(%s, %s_props);' % (name, name))
+    return lines
+
+
+def generate(desc, src_name, out_base):
+    name = desc.get('name')
+    if not isinstance(name, str) or not IDENT_RE.match(name):
+        fail('"name" must be a C identifier')
+    styles = desc.get('styles', {})
+    objects = desc.get('objects', [])
+    if len(objects) >= 0xff:
+        fail('too many objects (max 254)')
+    upper = name.upper()
+    header = os.path.basename(out_base) + '.h'
+    guard = re.sub(r'[^A-Z0-9]', '_', header.upper())
+    banner = '// 由 tools/face_gen.py 根据 %s 生成, 不要手工修改' % src_name
+
+    # 样式: 只生成被控件用到的
+    used = []
+    for i, obj in enumerate(objects):
+        s = obj.get('style')
+        if s is None:
+            continue
+        if s not in styles:
+            fail('objects[%d]: unknown style %r' % (i, s))
+        if s not in used:
+            used.append(s)
+    for s in styles:
+        if s not in used:
+            print('warning: style %r is not used' % s, file=sys.stderr)
+
+    c = [banner, '#include "%s"' % header, '']
+    prop_count = 0
+    for s in used:
+        if not IDENT_RE.match(s):
+            fail('style name %r is not a C identifier' % s)
+        props = []
+        for key, value in styles[s].items():
+            if key not in PROPS:
+                fail('styles.%s: unknown property %r' % (s, key))
+            props.append((key.upper(), c_value(PROPS[key], value, 'styles.%s.%s' % (s, key))))
+        prop_count += len(props)
+        c += props_array('%s_%s' % (name, s), props)
+        c.append('')
+
+    # 布局样式, 相同的只生成一份
+    layouts = {}
+    obj_layout = []
+    for i, obj in enumerate(objects):
+        props = layout_props(obj, 'objects[%d]' % i)
+        if not props:
+            obj_layout.append(None)
+            continue
+        if props not in layouts:
+            layouts[props] = '%s_layout_%d' % (name, len(layouts))
+            c += props_array(layouts[props], props)
+            c.append('')
+        obj_layout.append(layouts[props])
+
+    # 线段端点和控件表
+    ids = {}
+    rows = []
+    for i, obj in enumerate(objects):
+        where = 'objects[%d]' % i
+        t = obj.get('type', 'obj')
+        if t not in TYPES:
+            fail('%s: bad type %r' % (where, t))
+        oid = obj.get('id')
+        if oid is not None:
+            if not IDENT_RE.match(oid) or oid in ids:
+                fail('%s: bad or duplicate id %r' % (where, oid))
+        parent = obj.get('parent')
+        if parent is None:
+            parent_c = 'FACE_TABLE_ROOT'
+        elif parent in ids:
+            parent_c = '%s_%s' % (upper, parent.upper())
+        else:
+            fail('%s: parent %r must be an earlier object id' % (where, parent))
+
+        points_c = 'NULL'
+        point_count = 0
+        if 'points' in obj:
+            if t != 'line':
+                fail('%s: only lines have points' % where)
+            pts = [pair(p, where + '.points') for p in obj['points']]
+            # face_table_obj_t.point_count 是 uint8_t
+            if len(pts) > 0xff:
+                fail('%s: too many points (%d, max 255)' % (where, len(pts)))
+            pname = '%s_%s_points' % (name, oid if oid else 'obj%d' % i)
+            c.append('static const lv_point_precise_t %s[] = {%s};' % (
+                pname, ', '.join('{%d, %d}' % (p[0], p[1]) for p in pts)))
+            points_c = pname
+            point_count = len(pts)
+        text_c = 'NULL'
+        if 'text' in obj:
+            if t != 'label':
+                fail('%s: only labels have text' % where)
+            text_c = c_string(obj['text'])
+
+        style_c = '&%s_%s' % (name, obj['style']) if obj.get('style') else 'NULL'
+        layout_c = '&%s' % obj_layout[i] if obj_layout[i] else 'NULL'
+        comment = oid if oid else (obj.get('style') or t)
+        rows.append((i, comment, '{ %s, %s, %d, %s, %s, %s, %s },' % (
+            TYPES[t], parent_c, point_count, style_c, layout_c, text_c, points_c)))
+        if oid is not None:
+            ids[oid] = i
+    if any(line.startswith('static const lv_point_precise_t') for line in c):
+        c.append('')
+
+    c.append('const face_table_obj_t %s_table[%s_OBJ_COUNT] = {' % (name, upper))
+    width = max((len(r[1]) for r in rows), default=0)
+    c += ['    /* %2d %-*s */ %s' % (i, width, comment, row) for i, comment, row in rows]
+    c.append('};')
+
+    h = [banner, '#ifndef %s' % guard, '#define %s' % guard, '', '#include "face_table.h"', '']
+    h.append('// 控件在 %s_table 中的下标' % name)
+    h.append('enum {')
+    for oid, i in ids.items():
+        h.append('    %s_%s = %d,' % (upper, oid.upper(), i))
+    h.append('    %s_OBJ_COUNT = %d' % (upper, len(objects)))
+    h.append('};')
+    h.append('')
+    h.append('extern const face_table_obj_t %s_table[%s_OBJ_COUNT];' % (name, upper))
+    h.append('')
+    h.append('#endif // %s' % guard)
+
+    summary = '%s: %d styles, %d layouts, %d style properties, %d objects' % (
+        name, len(used), len(layouts), prop_count + sum(len(p) for p in layouts), len(objects))
+    return '\n'.join(c) + '\n', '\n'.join(h) + '\n', summary
+
+
+def main():
+    ap = argparse.ArgumentParser(description='face description (JSON) -> const LVGL styles and object table')
+    ap.add_argument('desc', help='face description JSON')
+    ap.add_argument('-o', '--output', help='output path without extension (default: <desc dir>/<name>_gen)')
+    ap.add_argument('--check', action='store_true', help='exit 1 if the generated files are out of date')
+    args = ap.parse_args()
+
+    try:
+        with open(args.desc) as f:
+            desc = json.load(f)
+    except (OSError, ValueError) as e:
+        fail('%s: %s' % (args.desc, e))
+
+    out_base = args.output or os.path.join(os.path.dirname(args.desc), '%s_gen' % desc.get('name', 'face'))
+    c_text, h_text, summary = generate(desc, os.path.basename(args.desc), out_base)
+
+    if args.check:
+        stale = []
+        for path, text in ((out_base + '.c', c_text), (out_base + '.h', h_text)):
+            try:
+                with open(path) as f:
+                    if f.read() != text:
+                        stale.append(path)
+            except OSError:
+                stale.append(path)
+        if stale:
+            print('out of date: %s' % ' '.join(stale))
+            sys.exit(1)
+        print('%s (up to date)' % summary)
+        return
+
+    for path, text in ((out_base + '.c', c_text), (out_base + '.h', h_text)):
+        with open(path, 'w') as f:
+            f.write(text)
+    print(summary)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,199 @@
+#!/usr/bin/env python3
+
+"""
+根据 XIP_PROFILE 的剖析输出(xip_profile.h), 把最热的LVGL函数放进SRAM。
+
+固件用 -DXIP_PROFILE=ON 编译时, 每300帧通过stdio输出一次:
+  xip frames 300: frame 12345 us, hit 97.12%, acc 123456/frame, samples 2400 (flash 2100, ram 300, dropped 0)
+  xip pc 0x10012345 57
+  ...
+  xip end
+把串口输出保存成日志, 本工具:
+  sections  把PC直方图对应到ELF中的函数(nm -S), 按采样数从高到低挑选lvgl库中的函数, 直到用完SRAM预算,
+            输出objcopy的 --rename-section 参数列表(每行一个), 交给CMake的 XIP_HOT_SECTIONS:
+            .text.<函数> 改为 .time_critical.<函数>, 和 __not_in_flash_func 的效果相同。
+            不在lvgl库中的热点函数只列出来, 需要在源码中用 __not_in_flash_func 标记。
+  report    汇总一个或多个日志的平均帧时间、XIP命中率和每帧的XIP访问数, 用于对比放置前后。
+            代码进入SRAM后不再经过XIP, 每帧访问数的下降和命中率一样重要。
+
+用法:
+  xip_hot.py sections --elf build/yongqigou_watch.elf --lib build/liblvgl.a -o hot_sections.txt profile.log
+  xip_hot.py sections ... --budget 12288 --nm arm-none-eabi-nm
+  xip_hot.py report before.log after.log
+"""
+
+import argparse
+import bisect
+import re
+import subprocess
+import sys
+
+FRAMES_RE = re.compile(r'xip frames (\d+): frame (\d+) us, hit (\d+)\.(\d+)%, acc (\d+)/frame, '
+                       r'samples (\d+) \(flash (\d+), ram (\d+), dropped (\d+)\)')
+PC_RE = re.compile(r'xip pc 0x([0-9a-fA-F]+) (\d+)')
+
+XIP_BASE = 0x10000000
+SRAM_BASE = 0x20000000
+FUNC_TYPES = 'tTwW'
+
+
+def read_profile(paths):
+    """汇总日志中的PC直方图和每组帧的统计"""
+    pcs = {}
+    groups = []
+    for path in paths:
+        with open(path, errors='replace') as f:
+            for line in f:
+                m = PC_RE.search(line)
+                if m:
+                    pc = int(m.group(1), 16)
+                    pcs[pc] = pcs.get(pc, 0) + int(m.group(2))
+                    continue
+                m = FRAMES_RE.search(line)
+                if m:
+                    v = [int(x) for x in m.groups()]
+                    groups.append({
+                        'frames': v[0], 'frame_us': v[1], 'hit': v[2] + v[3] / 100.0, 'acc': v[4],
+                        'samples': v[5], 'flash': v[6], 'ram': v[7], 'dropped': v[8],
+                    })
+    return pcs, groups
+
+
+def run_nm(nm, path, sizes):
+    args = [nm, '--defined-only']
+    if sizes:
+        args.append('-S')
+    try:
+        out = subprocess.run(args + [path], check=True, capture_output=True, text=True).stdout
+    except (OSError, subprocess.CalledProcessError) as e:
+        sys.exit('error: %s failed: %s' % (nm, e))
+    return out.splitlines()
+
+
+def read_functions(nm, elf):
+    """ELF中的函数: [(起始地址, 大小, 名字)], 按地址排序; Thumb函数地址的最低位去掉"""
+    funcs = []
+    for line in run_nm(nm, elf, True):
+        parts = line.split()
+        if len(parts) != 4 or parts[2] not in FUNC_TYPES:
+            continue
+        size = int(parts[1], 16)
+        if size == 0:
+            continue
+        funcs.append((int(parts[0], 16) & ~1, size, parts[3]))
+    funcs.sort()
+    return funcs
+
+
+def read_lib_functions(nm, lib):
+    """库中定义的函数名, 只有这些函数的段可以在打包后改名"""
+    names = set()
+    for line in run_nm(nm, lib, False):
+        parts = line.split()
+        if len(parts) == 3 and parts[1] in FUNC_TYPES:
+            names.add(parts[2])
+    return names
+
+
+def map_samples(pcs, funcs):
+    """每个函数的采样数; 找不到函数的PC按区域归到 <flash>/<ram>/<other>"""
+    starts = [f[0] for f in funcs]
+    hot = {}
+    for pc, count in pcs.items():
+        i = bisect.bisect_right(starts, pc) - 1
+        if i >= 0 and pc < funcs[i][0] + funcs[i][1]:
+            key = funcs[i]
+        elif XIP_BASE <= pc < SRAM_BASE:
+            key = (0, 0, '<flash>')
+        elif pc >= SRAM_BASE:
+            key = (0, 0, '<ram>')
+        else:
+            key = (0, 0, '<other>')
+        hot[key] = hot.get(key, 0) + count
+    return hot
+
+
+def cmd_sections(args):
+    pcs, _ = read_profile(args.profile)
+    if not pcs:
+        sys.exit('error: no "xip pc" lines in the profile')
+    funcs = read_functions(args.nm, args.elf)
+    lib_names = read_lib_functions(args.nm, args.lib) if args.lib else None
+    hot = sorted(map_samples(pcs, funcs).items(), key=lambda kv: -kv[1])
+
+    total = sum(pcs.values())
+    flash_total = sum(c for pc, c in pcs.items() if XIP_BASE <= pc < SRAM_BASE)
+    budget = args.budget
+    chosen = []
+    moved = 0
+
+    print('%-44s %8s %7s %7s  %s' % ('function', 'samples', '%', 'bytes', 'placement'))
+    for (addr, size, name), count in hot:
+        if count * 1000 < total * args.min_permille:
+            break
+        if name.startswith('<'):
+            where = ''
+        elif addr >= SRAM_BASE:
+            where = 'sram'
+        elif lib_names is not None and name not in lib_names:
+            where = 'not in lib, use __not_in_flash_func'
+        elif size > budget:
+            where = 'over budget'
+        else:
+            where = 'SRAM (moved)'
+            budget -= size
+            moved += count
+            chosen.append(name)
+        print('%-44s %8d %6.1f%% %7d  %s' % (name[:44], count, 100.0 * count / total, size, where))
+
+    print()
+    print('samples %d, flash %d; moved %d functions, %d bytes, %.1f%% of flash samples'
+          % (total, flash_total, len(chosen), args.budget - budget,
+             100.0 * moved / flash_total if flash_total else 0.0))
+
+    with open(args.output, 'w') as f:
+        for name in chosen:
+            f.write('--rename-section .text.%s=.time_critical.%s\n' % (name, name))
+
+
+def cmd_report(args):
+    print('%-24s %8s %10s %8s %12s %8s %8s' % ('log', 'frames', 'frame_us', 'hit%', 'acc/frame', 'flash%', 'ram%'))
+    for path in args.logs:
+        _, groups = read_profile([path])
+        frames = sum(g['frames'] for g in groups)
+        if frames == 0:
+            print('%-24s %8s' % (path[-24:], 'no data'))
+            continue
+        frame_us = sum(g['frame_us'] * g['frames'] for g in groups) / frames
+        acc = sum(g['acc'] * g['frames'] for g in groups)
+        hits = sum(g['hit'] / 100.0 * g['acc'] * g['frames'] for g in groups)
+        samples = sum(g['samples'] for g in groups) or 1
+        print('%-24s %8d %10.0f %7.2f%% %12.0f %7.1f%% %7.1f%%'
+              % (path[-24:], frames, frame_us, 100.0 * hits / acc if acc else 0.0, acc / frames,
+                 100.0 * sum(g['flash'] for g in groups) / samples, 100.0 * sum(g['ram'] for g in groups) / samples))
+
+
+def main():
+    ap = argparse.ArgumentParser(description='XIP profile -> SRAM placement of hot LVGL functions')
+    sub = ap.add_subparsers(dest='cmd', required=True)
+
+    sp = sub.add_parser('sections', help='generate the objcopy section list for XIP_HOT_SECTIONS')
+    sp.add_argument('profile', nargs='+', help='stdio log(s) of an XIP_PROFILE build')
+    sp.add_argument('--elf', required=True, help='firmware ELF the profile was taken with')
+    sp.add_argument('--lib', help='liblvgl.a; only functions defined there are moved')
+    sp.add_argument('--nm', default='arm-none-eabi-nm')
+    sp.add_argument('--budget', type=int, default=8192, help='SRAM bytes for moved code (default 8192)')
+    sp.add_argument('--min-permille', type=int, default=5, help='ignore functions below this share (default 5)')
+    sp.add_argument('-o', '--output', required=True)
+    sp.set_defaults(func=cmd_sections)
+
+    rp = sub.add_parser('report', help='frame time and XIP hit rate per log')
+    rp.add_argument('logs', nargs='+')
+    rp.set_defaults(func=cmd_report)
+
+    args = ap.parse_args()
+    args.func(args)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,232 @@
+#include "ui_queue.h"
+#include <string.h>
+#include "src/osal/lv_os.h"
+
+#if defined(PICO_ON_DEVICE) && PICO_ON_DEVICE
+// 设备端: Cortex-M0+ 没有 LDREX/STREX, C11 原子CAS无法做到无锁,
+// 因此使用SDK的 queue_t (硬件自旋锁保护的短临界区, try接口不会等待渲染)
+#include "pico/util/queue.h"
+#include "hardware/sync.h"
+
+static queue_t ui_queue;
+static spin_lock_t *drop_lock;
+static volatile uint32_t dropped_count;
+
+void ui_queue_init(void) {
+    queue_init(&ui_queue, sizeof(ui_cmd_t), UI_QUEUE_LEN);
+    drop_lock = spin_lock_instance(spin_lock_claim_unused(true));
+    dropped_count = 0;
+}
+
+bool ui_queue_post(const ui_cmd_t *cmd) {
+    if (queue_try_add(&ui_queue, cmd)) return true;
+
+    uint32_t save = spin_lock_blocking(drop_lock);
+    dropped_count++;
+    spin_unlock(drop_lock, save);
+    return false;
+}
+
+bool ui_queue_pop(ui_cmd_t *cmd) {
+    return queue_try_remove(&ui_queue, cmd);
+}
+
+uint32_t ui_queue_get_dropped(void) {
+    return dropped_count;
+}
+
+#else
+// 主机端: 基于C11原子操作的有界MPSC环形队列
+// 每个槽位带序号: 生产者用CAS抢占写位置, 写完后发布序号; 消费者只有一个, 无需CAS
+#include <stdatomic.h>
+
+typedef struct {
+    atomic_uint seq;
+    ui_cmd_t cmd;
+} ui_slot_t;
+
+static ui_slot_t slots[UI_QUEUE_LEN];
+static atomic_uint head_pos;     // 下一个写位置(生产者共享)
+static unsigned int tail_pos;    // 下一个读位置(仅消费者)
+static atomic_uint dropped_count;
+
+void ui_queue_init(void) {
+    for (unsigned int i = 0; i < UI_QUEUE_LEN; i++) {
+        atomic_init(&slots[i].seq, i);
+    }
+    atomic_init(&head_pos, 0);
+    atomic_init(&dropped_count, 0);
+    tail_pos = 0;
+}
+
+bool ui_queue_post(const ui_cmd_t *cmd) {
+    unsigned int pos = atomic_load_explicit(&head_pos, memory_order_relaxed);
+    ui_slot_t *slot;
+
+    while (1) {
+        slot = &slots[pos & (UI_QUEUE_LEN - 1)];
+        unsigned int seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+        int diff = (int)(seq - pos);
+
+        if (diff == 0) {
+            // 槽位空闲, 尝试占用; 失败时pos被更新为最新值
+            if (atomic_compare_exchange_weak_explicit(&head_pos, &pos, pos + 1,
+                                                      memory_order_relaxed, memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // 消费者尚未取走一整圈之前的数据: 队列已满
+            atomic_fetch_add_explicit(&dropped_count, 1, memory_order_relaxed);
+            return false;
+        } else {
+            pos = atomic_load_explicit(&head_pos, memory_order_relaxed);
+        }
+    }
+
+    slot->cmd = *cmd;
+    atomic_store_explicit(&slot->seq, pos + 1, memory_order_release);
+    return true;
+}
+
+bool ui_queue_pop(ui_cmd_t *cmd) {
+    ui_slot_t *slot = &slots[tail_pos & (UI_QUEUE_LEN - 1)];
+    unsigned int seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+
+    if (seq != tail_pos + 1) return false;
+
+    *cmd = slot->cmd;
+    // 释放槽位给下一圈的生产者
+    atomic_store_explicit(&slot->seq, tail_pos + UI_QUEUE_LEN, memory_order_release);
+    tail_pos++;
+    return true;
+}
+
+uint32_t ui_queue_get_dropped(void) {
+    return atomic_load_explicit(&dropped_count, memory_order_relaxed);
+}
+
+#endif
+
+// 句柄表, 只在UI线程访问
+// 每次登记时表项代数加一, 控件删除后旧句柄的代数对不上, 即使新控件恰好分配在同一地址也不会误用
+#define UI_HANDLE_INDEX_BITS    4   // log2(UI_QUEUE_OBJ_MAX)
+#if (1 << UI_HANDLE_INDEX_BITS) != UI_QUEUE_OBJ_MAX
+#error "UI_HANDLE_INDEX_BITS must be log2(UI_QUEUE_OBJ_MAX)"
+#endif
+
+typedef struct {
+    lv_obj_t *obj;
+    uint32_t gen;
+} ui_obj_slot_t;
+
+static ui_obj_slot_t obj_slots[UI_QUEUE_OBJ_MAX];
+
+static void ui_obj_delete_cb(lv_event_t *e) {
+    ui_obj_slot_t *slot = lv_event_get_user_data(e);
+    slot->obj = NULL;
+}
+
+ui_handle_t ui_queue_register(lv_obj_t *obj) {
+    for (uint32_t i = 0; i < UI_QUEUE_OBJ_MAX; i++) {
+        ui_obj_slot_t *slot = &obj_slots[i];
+        if (slot->obj) continue;
+
+        // 代数回绕时跳过0, 保证句柄不等于 UI_HANDLE_NONE
+        slot->gen = (slot->gen + 1) & (UINT32_MAX >> UI_HANDLE_INDEX_BITS);
+        if (slot->gen == 0) slot->gen = 1;
+        slot->obj = obj;
+        lv_obj_add_event_cb(obj, ui_obj_delete_cb, LV_EVENT_DELETE, slot);
+        return (slot->gen << UI_HANDLE_INDEX_BITS) | i;
+    }
+    return UI_HANDLE_NONE;
+}
+
+lv_obj_t *ui_queue_get_obj(ui_handle_t handle) {
+    ui_obj_slot_t *slot = &obj_slots[handle & (UI_QUEUE_OBJ_MAX - 1)];
+    if (handle == UI_HANDLE_NONE || slot->gen != (handle >> UI_HANDLE_INDEX_BITS)) return NULL;
+    return slot->obj;
+}
+
+bool ui_queue_post_value(ui_handle_t handle, int32_t value) {
+    ui_cmd_t cmd = {
+        .type = UI_CMD_SET_VALUE,
+        .handle = handle,
+        .value = value
+    };
+    return ui_queue_post(&cmd);
+}
+
+bool ui_queue_post_text(ui_handle_t handle, const char *text) {
+    ui_cmd_t cmd = {
+        .type = UI_CMD_SET_TEXT,
+        .handle = handle
+    };
+    strncpy(cmd.text, text, UI_QUEUE_TEXT_MAX - 1);
+    cmd.text[UI_QUEUE_TEXT_MAX - 1] = '\0';
+    return ui_queue_post(&cmd);
+}
+
+bool ui_queue_post_invalidate(ui_handle_t handle) {
+    ui_cmd_t cmd = {
+        .type = UI_CMD_INVALIDATE,
+        .handle = handle
+    };
+    return ui_queue_post(&cmd);
+}
+
+// 在UI线程执行一条命令
+// 控件已删除(句柄失效)时丢弃命令
+static void ui_cmd_apply(const ui_cmd_t *cmd) {
+    lv_obj_t *obj = ui_queue_get_obj(cmd->handle);
+    if (obj == NULL) return;
+
+    switch (cmd->type) {
+        case UI_CMD_SET_VALUE:
+#if LV_USE_ARC
+            if (lv_obj_check_type(obj, &lv_arc_class)) {
+                lv_arc_set_value(obj, cmd->value);
+                break;
+            }
+#endif
+#if LV_USE_SLIDER
+            if (lv_obj_check_type(obj, &lv_slider_class)) {
+                lv_slider_set_value(obj, cmd->value, LV_ANIM_OFF);
+                break;
+            }
+#endif
+#if LV_USE_BAR
+            if (lv_obj_check_type(obj, &lv_bar_class)) {
+                lv_bar_set_value(obj, cmd->value, LV_ANIM_OFF);
+                break;
+            }
+#endif
+            break;
+
+        case UI_CMD_SET_TEXT:
+#if LV_USE_LABEL
+            if (lv_obj_check_type(obj, &lv_label_class)) {
+                lv_label_set_text(obj, cmd->text);
+            }
+#endif
+            break;
+
+        case UI_CMD_INVALIDATE:
+            lv_obj_invalidate(obj);
+            break;
+    }
+}
+
+uint32_t ui_queue_drain(void) {
+    ui_cmd_t cmd;
+    uint32_t count = 0;
+
+    // 每轮最多执行一整队列的命令, 防止生产者持续投递导致UI线程迟迟无法进入渲染
+    lv_lock();
+    while (count < UI_QUEUE_LEN && ui_queue_pop(&cmd)) {
+        ui_cmd_apply(&cmd);
+        count++;
+    }
+    lv_unlock();
+
+    return count;
+}
@@ -0,0 +1,76 @@
+#ifndef UI_QUEUE_H
+#define UI_QUEUE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "lvgl.h"
+
+// 跨线程UI更新队列
+// 传感器/BLE线程(主机端)或core1(设备端)不直接操作控件, 而是投递命令,
+// 由UI线程在每次 lv_timer_handler() 之前统一取出并执行。
+// 投递端永不阻塞: 队列满时直接返回false并计入丢弃计数。
+// 投递端不持有控件指针, 只持有UI线程登记控件时得到的句柄: 控件删除后句柄失效,
+// 已在队列中的命令取出时查不到控件就直接丢弃, 不会访问已释放的内存。
+
+// 队列容量, 必须是2的幂
+#define UI_QUEUE_LEN        32
+
+// 文本命令内联存储的最大长度(含结尾'\0'), 避免跨线程分配内存
+#define UI_QUEUE_TEXT_MAX   24
+
+// 可同时登记的控件数, 必须是2的幂
+#define UI_QUEUE_OBJ_MAX    16
+
+// 控件句柄: 低位是句柄表下标, 高位是该表项的登记代数; 0表示无效句柄
+typedef uint32_t ui_handle_t;
+#define UI_HANDLE_NONE      0
+
+// 命令类型
+typedef enum {
+    UI_CMD_SET_VALUE,   // 设置数值(bar/slider/arc)
+    UI_CMD_SET_TEXT,    // 设置label文本
+    UI_CMD_INVALIDATE,  // 重绘对象
+} ui_cmd_type_t;
+
+// 命令
+typedef struct {
+    ui_cmd_type_t type;
+    ui_handle_t handle;
+    union {
+        int32_t value;
+        char text[UI_QUEUE_TEXT_MAX];
+    };
+} ui_cmd_t;
+
+// 初始化队列(在任何投递之前, 由UI线程调用一次)
+void ui_queue_init(void);
+
+// 登记控件, 返回供投递端使用的句柄(仅UI线程); 句柄表满时返回 UI_HANDLE_NONE
+// 控件删除时自动注销, 之后用旧句柄投递的命令都会被丢弃
+ui_handle_t ui_queue_register(lv_obj_t *obj);
+
+// 查找句柄对应的控件(仅UI线程), 控件已删除或句柄无效时返回NULL
+lv_obj_t *ui_queue_get_obj(ui_handle_t handle);
+
+// 投递命令(任意线程/核心)
+bool ui_queue_post(const ui_cmd_t *cmd);
+
+// 投递数值更新
+bool ui_queue_post_value(ui_handle_t handle, int32_t value);
+
+// 投递文本更新, 超长文本会被截断
+bool ui_queue_post_text(ui_handle_t handle, const char *text);
+
+// 投递重绘请求
+bool ui_queue_post_invalidate(ui_handle_t handle);
+
+// 取出一条命令(仅UI线程), 队列为空时返回false
+bool ui_queue_pop(ui_cmd_t *cmd);
+
+// 执行所有待处理命令(仅UI线程, 在 lv_timer_handler() 之前调用), 返回执行的命令数
+uint32_t ui_queue_drain(void);
+
+// 因队列满而被丢弃的命令数
+uint32_t ui_queue_get_dropped(void);
+
+#endif // UI_QUEUE_H
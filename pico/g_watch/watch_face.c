@@ -0,0 +1,342 @@
+#include "watch_face.h"
+#include <stdio.h>
+#include <math.h>
+
+// 表盘尺寸(与屏幕一致)
+#define WATCH_FACE_SIZE 240
+
+static const char *const month_names[12] = {
+    "JAN", "FEB", "MAR", "APR", "MAY", "JUN",
+    "JUL", "AUG", "SEP", "OCT", "NOV", "DEC"
+};
+
+// 创建表盘样式
+static lv_style_t style_clock;
+static lv_obj_t *clock_obj;
+static lv_obj_t *date_label;
+
+// 添加指针样式
+static lv_style_t style_hour_hand;
+static lv_style_t style_min_hand;
+static lv_style_t style_sec_hand;
+static lv_obj_t *hour_hand;
+static lv_obj_t *min_hand;
+static lv_obj_t *sec_hand;
+
+// 上一次显示的值, 没有变化就不重画
+static int32_t shown_hour_angle = -1;
+static int32_t shown_min_angle = -1;
+static int32_t shown_sec_pos = -1;     // 秒针位置, 单位为一步(每分钟 60 * steps 步)
+static uint8_t shown_month;
+static uint8_t shown_day;
+static uint8_t sweep_hz;
+
+// 资源包中的背景图和品牌字体, NULL 时使用内置的波纹和字体
+static const lv_image_dsc_t *face_bg;
+static const lv_font_t *brand_font;
+
+// 创建金属质感渐变
+static void create_metallic_style(lv_style_t *style) {
+    lv_style_init(style);
+
+    // 设置背景渐变
+    lv_style_set_bg_color(style, lv_color_hex(0xf7e8e3));  // 玫瑰金色
+    lv_style_set_bg_grad_color(style, lv_color_hex(0xe8cec7));
+    lv_style_set_bg_grad_dir(style, LV_GRAD_DIR_NONE);
+
+    // 添加边框效果
+    lv_style_set_border_width(style, 2);
+    lv_style_set_border_color(style, lv_color_hex(0xd4b5ac));
+    lv_style_set_radius(style, LV_RADIUS_CIRCLE);
+
+    // 不加阴影: 表盘铺满圆形屏, 阴影全在可视区外, 却要临时分配约40KB的模糊缓冲(超过32KB的LVGL堆)
+}
+
+// 添加波纹效果
+static void draw_ripple_effect(lv_obj_t *obj, lv_layer_t *layer) {
+    lv_area_t area;
+    lv_obj_get_coords(obj, &area);
+    int32_t radius = (area.x2 - area.x1) / 2;
+
+    // 绘制4层波纹
+    for(int i = 0; i < 4; i++) {
+        float progress = i / 4.0f;
+
+        lv_draw_arc_dsc_t arc_dsc;
+        lv_draw_arc_dsc_init(&arc_dsc);
+        arc_dsc.color = lv_color_hex(0x666666);
+        arc_dsc.width = 2;
+        arc_dsc.opa = (1.0f - progress) * 50;  // 渐变透明度
+        arc_dsc.center.x = area.x1 + radius;
+        arc_dsc.center.y = area.y1 + radius;
+        arc_dsc.radius = radius * (0.45f + progress * 0.5f);
+        arc_dsc.start_angle = 0;
+        arc_dsc.end_angle = 360;
+
+        lv_draw_arc(layer, &arc_dsc);
+    }
+}
+
+// 绘制背景图(居中)
+static void draw_bg_image(lv_obj_t *obj, lv_layer_t *layer) {
+    lv_area_t area;
+    lv_obj_get_coords(obj, &area);
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = face_bg;
+
+    lv_area_t img_area;
+    img_area.x1 = area.x1 + (lv_area_get_width(&area) - (int32_t)face_bg->header.w) / 2;
+    img_area.y1 = area.y1 + (lv_area_get_height(&area) - (int32_t)face_bg->header.h) / 2;
+    img_area.x2 = img_area.x1 + face_bg->header.w - 1;
+    img_area.y2 = img_area.y1 + face_bg->header.h - 1;
+    lv_draw_image(layer, &img_dsc, &img_area);
+}
+
+// 绘制表盘: 背景图或波纹、品牌名称和刻度
+static void draw_clock_face(lv_event_t *e) {
+    lv_obj_t *obj = lv_event_get_target_obj(e);
+    lv_layer_t *layer = lv_event_get_layer(e);
+
+    // 有背景图就画背景图, 否则绘制波纹效果
+    if (face_bg) draw_bg_image(obj, layer);
+    else draw_ripple_effect(obj, layer);
+
+    // 绘制品牌名称(表盘上方1/3处水平居中)
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    label_dsc.color = lv_color_hex(0xb76e5d);
+    label_dsc.font = brand_font ? brand_font : &lv_font_montserrat_16;  // 使用合适的字体
+    label_dsc.align = LV_TEXT_ALIGN_CENTER;
+    label_dsc.text = "YongqiGou";
+
+    lv_area_t area;
+    lv_obj_get_coords(obj, &area);
+
+    lv_area_t label_area = area;
+    label_area.y1 = area.y1 + (area.y2 - area.y1) / 3;
+    label_area.y2 = label_area.y1 + lv_font_get_line_height(label_dsc.font) - 1;
+    lv_draw_label(layer, &label_dsc, &label_area);
+
+    // 绘制主刻度
+    int32_t cx = area.x1 + (area.x2 - area.x1) / 2;
+    int32_t cy = area.y1 + (area.y2 - area.y1) / 2;
+
+    for(int i = 0; i < 12; i++) {
+        float angle = i * 30 * M_PI / 180;
+
+        lv_draw_line_dsc_t line_dsc;
+        lv_draw_line_dsc_init(&line_dsc);
+        line_dsc.color = lv_color_hex(0x666666);
+        line_dsc.width = 3;
+        line_dsc.p1.x = cx + sinf(angle) * 100;
+        line_dsc.p1.y = cy - cosf(angle) * 100;
+        line_dsc.p2.x = cx + sinf(angle) * 110;
+        line_dsc.p2.y = cy - cosf(angle) * 110;
+        lv_draw_line(layer, &line_dsc);
+    }
+}
+
+// 创建指针样式
+static void create_hand_styles(void) {
+    // 时针样式
+    lv_style_init(&style_hour_hand);
+    lv_style_set_line_width(&style_hour_hand, 4);
+    lv_style_set_line_color(&style_hour_hand, lv_color_hex(0x666666));
+    lv_style_set_line_rounded(&style_hour_hand, true);
+
+    // 分针样式
+    lv_style_init(&style_min_hand);
+    lv_style_set_line_width(&style_min_hand, 3);
+    lv_style_set_line_color(&style_min_hand, lv_color_hex(0x888888));
+    lv_style_set_line_rounded(&style_min_hand, true);
+
+    // 秒针样式
+    lv_style_init(&style_sec_hand);
+    lv_style_set_line_width(&style_sec_hand, 2);
+    lv_style_set_line_color(&style_sec_hand, lv_color_hex(0xb76e5d));
+    lv_style_set_line_rounded(&style_sec_hand, true);
+}
+
+// 创建一根指针: 竖直线段, 底端放在表盘中心并作为旋转中心
+// 控件本身只有线宽x长度大小, 旋转时的变换图层也就很小
+static lv_obj_t *create_hand(lv_style_t *style, const lv_point_precise_t *points) {
+    int32_t len = points[1].y;
+    lv_obj_t *hand = lv_line_create(clock_obj);
+    lv_obj_add_style(hand, style, 0);
+    lv_line_set_points(hand, points, 2);
+    lv_obj_set_pos(hand, WATCH_FACE_SIZE / 2, WATCH_FACE_SIZE / 2 - len);
+    lv_obj_set_style_transform_pivot_x(hand, 0, 0);
+    lv_obj_set_style_transform_pivot_y(hand, len, 0);
+    return hand;
+}
+
+// 秒针的步数和角度: 跳秒每分钟60步, 扫秒每分钟 60 * hz 步
+static uint32_t sec_steps_per_min(void) {
+    return 60u * (sweep_hz ? sweep_hz : 1);
+}
+
+// 秒针方向(单位向量, y向下), pos为步数
+static void sec_dir(int32_t pos, float *dx, float *dy) {
+    float angle = (float)pos * 2.0f * (float)M_PI / (float)sec_steps_per_min();
+    *dx = sinf(angle);
+    *dy = -cosf(angle);
+}
+
+// 绘制秒针: 直接画线段, 不经过旋转变换的图层
+static void draw_sec_hand(lv_event_t *e) {
+    lv_obj_t *obj = lv_event_get_target_obj(e);
+    lv_layer_t *layer = lv_event_get_layer(e);
+    if (shown_sec_pos < 0) return;
+
+    lv_area_t area;
+    lv_obj_get_coords(obj, &area);
+    float dx, dy;
+    sec_dir(shown_sec_pos, &dx, &dy);
+
+    lv_draw_line_dsc_t line_dsc;
+    lv_draw_line_dsc_init(&line_dsc);
+    lv_obj_init_draw_line_dsc(obj, LV_PART_MAIN, &line_dsc);
+    line_dsc.p1.x = area.x1 + WATCH_FACE_SIZE / 2;
+    line_dsc.p1.y = area.y1 + WATCH_FACE_SIZE / 2;
+    line_dsc.p2.x = line_dsc.p1.x + (lv_value_precise_t)lroundf(dx * WATCH_FACE_SEC_LEN);
+    line_dsc.p2.y = line_dsc.p1.y + (lv_value_precise_t)lroundf(dy * WATCH_FACE_SEC_LEN);
+    lv_draw_line(layer, &line_dsc);
+}
+
+// 失效秒针在pos处的各段外接矩形
+static void invalidate_sec_hand(int32_t pos) {
+    lv_area_t obj_area;
+    lv_obj_get_coords(sec_hand, &obj_area);
+    int32_t cx = obj_area.x1 + WATCH_FACE_SIZE / 2;
+    int32_t cy = obj_area.y1 + WATCH_FACE_SIZE / 2;
+    float dx, dy;
+    sec_dir(pos, &dx, &dy);
+
+    for (int i = 0; i < WATCH_FACE_SEC_SEGMENTS; i++) {
+        float r0 = (float)WATCH_FACE_SEC_LEN * i / WATCH_FACE_SEC_SEGMENTS;
+        float r1 = (float)WATCH_FACE_SEC_LEN * (i + 1) / WATCH_FACE_SEC_SEGMENTS;
+        int32_t x0 = cx + (int32_t)lroundf(dx * r0);
+        int32_t y0 = cy + (int32_t)lroundf(dy * r0);
+        int32_t x1 = cx + (int32_t)lroundf(dx * r1);
+        int32_t y1 = cy + (int32_t)lroundf(dy * r1);
+
+        lv_area_t a;
+        a.x1 = LV_MIN(x0, x1) - WATCH_FACE_SEC_PAD;
+        a.y1 = LV_MIN(y0, y1) - WATCH_FACE_SEC_PAD;
+        a.x2 = LV_MAX(x0, x1) + WATCH_FACE_SEC_PAD;
+        a.y2 = LV_MAX(y0, y1) + WATCH_FACE_SEC_PAD;
+        lv_obj_invalidate_area(sec_hand, &a);
+    }
+}
+
+// 创建秒针: 覆盖整个表盘的透明控件, 自己绘制线段并按段失效
+static lv_obj_t *create_sec_hand(void) {
+    lv_obj_t *hand = lv_obj_create(clock_obj);
+    lv_obj_remove_style_all(hand);
+    lv_obj_add_style(hand, &style_sec_hand, 0);
+    lv_obj_set_size(hand, WATCH_FACE_SIZE, WATCH_FACE_SIZE);
+    lv_obj_set_pos(hand, 0, 0);
+    lv_obj_remove_flag(hand, LV_OBJ_FLAG_CLICKABLE | LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_add_event_cb(hand, draw_sec_hand, LV_EVENT_DRAW_MAIN, NULL);
+    return hand;
+}
+
+// 创建日期窗口
+static void create_date_window(void) {
+    date_label = lv_label_create(clock_obj);
+
+    static lv_style_t style_date;
+    lv_style_init(&style_date);
+    lv_style_set_bg_color(&style_date, lv_color_white());
+    lv_style_set_border_color(&style_date, lv_color_hex(0xd4b5ac));
+    lv_style_set_border_width(&style_date, 1);
+    lv_style_set_pad_all(&style_date, 2);
+    lv_style_set_text_color(&style_date, lv_color_hex(0xd4b5ac));
+
+    lv_obj_add_style(date_label, &style_date, 0);
+    lv_obj_align(date_label, LV_ALIGN_CENTER, 0, 40);
+}
+
+void watch_face_create(lv_obj_t *parent) {
+    // 指针端点(相对指针控件, 从12点方向的端点到中心)
+    static const lv_point_precise_t hour_points[] = {{0, 0}, {0, 50}};
+    static const lv_point_precise_t min_points[] = {{0, 0}, {0, 75}};
+
+    // 创建时钟对象
+    clock_obj = lv_obj_create(parent);
+    lv_obj_set_size(clock_obj, WATCH_FACE_SIZE, WATCH_FACE_SIZE);
+    lv_obj_center(clock_obj);
+    lv_obj_set_style_pad_all(clock_obj, 0, 0);
+    lv_obj_remove_flag(clock_obj, LV_OBJ_FLAG_SCROLLABLE);
+
+    // 应用金属质感样式
+    create_metallic_style(&style_clock);
+    lv_obj_add_style(clock_obj, &style_clock, 0);
+
+    // 添加表盘绘制事件
+    lv_obj_add_event_cb(clock_obj, draw_clock_face, LV_EVENT_DRAW_MAIN_END, NULL);
+
+    // 创建指针
+    create_hand_styles();
+    hour_hand = create_hand(&style_hour_hand, hour_points);
+    min_hand = create_hand(&style_min_hand, min_points);
+    sec_hand = create_sec_hand();
+    shown_hour_angle = -1;
+    shown_min_angle = -1;
+    shown_sec_pos = -1;
+    shown_month = 0;
+    shown_day = 0;
+
+    // 创建日期窗口
+    create_date_window();
+}
+
+void watch_face_set_time(const watch_time_t *t) {
+    // 计算指针角度
+    int32_t hour_angle = (t->hour % 12 + t->min / 60.0f) * 30;
+    int32_t min_angle = t->min * 6;
+    int32_t sec_pos = t->sec * (sweep_hz ? sweep_hz : 1);
+    if (sweep_hz) sec_pos += t->ms * sweep_hz / 1000;
+
+    // 更新指针位置
+    if (hour_angle != shown_hour_angle) {
+        lv_obj_set_style_transform_angle(hour_hand, hour_angle * 10, 0);
+        shown_hour_angle = hour_angle;
+    }
+    if (min_angle != shown_min_angle) {
+        lv_obj_set_style_transform_angle(min_hand, min_angle * 10, 0);
+        shown_min_angle = min_angle;
+    }
+    if (sec_pos != shown_sec_pos) {
+        // 只重画旧位置和新位置的各段, 相邻的小矩形由LVGL合并
+        if (shown_sec_pos >= 0) invalidate_sec_hand(shown_sec_pos);
+        invalidate_sec_hand(sec_pos);
+        shown_sec_pos = sec_pos;
+    }
+
+    // 更新日期显示
+    if (t->month != shown_month || t->day != shown_day) {
+        char date_str[32];
+        snprintf(date_str, sizeof(date_str), "%s %02d",
+                 t->month >= 1 && t->month <= 12 ? month_names[t->month - 1] : "???",
+                 t->day);
+        lv_label_set_text(date_label, date_str);
+        shown_month = t->month;
+        shown_day = t->day;
+    }
+}
+
+void watch_face_set_assets(const lv_image_dsc_t *bg, const lv_font_t *font) {
+    face_bg = bg;
+    brand_font = font;
+}
+
+void watch_face_set_sweep(uint8_t hz) {
+    if (hz == sweep_hz) return;
+    // 步数的单位变了, 下一次 watch_face_set_time() 整根重画
+    if (sec_hand && shown_sec_pos >= 0) invalidate_sec_hand(shown_sec_pos);
+    sweep_hz = hz;
+    shown_sec_pos = -1;
+}
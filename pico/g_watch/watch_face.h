@@ -0,0 +1,40 @@
+#ifndef WATCH_FACE_H
+#define WATCH_FACE_H
+
+#include <stdint.h>
+#include "lvgl.h"
+
+// 固件表盘
+// 表盘只负责界面, 时间由调用者提供: 设备端来自RTC, 主机端基准测试来自虚拟时钟
+
+// 表盘时间
+typedef struct {
+    uint8_t hour;   // 0-23
+    uint8_t min;    // 0-59
+    uint8_t sec;    // 0-59
+    uint8_t month;  // 1-12
+    uint8_t day;    // 1-31
+    uint16_t ms;    // 0-999, 只有扫秒模式使用(time_source.h)
+} watch_time_t;
+
+// 秒针: 从中心到针尖的长度; 重画时分成 WATCH_FACE_SEC_SEGMENTS 段, 每段按外接矩形失效,
+// 四周外扩 WATCH_FACE_SEC_PAD 像素(线宽的一半和抗锯齿)。斜着的秒针不会把整个外接矩形都重画,
+// 每走一步最多重画 2 * 段数 个小矩形(旧位置和新位置)
+#define WATCH_FACE_SEC_LEN          90
+#define WATCH_FACE_SEC_SEGMENTS     6
+#define WATCH_FACE_SEC_PAD          3
+
+// 在parent上创建表盘
+void watch_face_create(lv_obj_t *parent);
+
+// 更新指针和日期, 只有变化的部分才会重画
+void watch_face_set_time(const watch_time_t *t);
+
+// 可选的表盘资源(来自资源包, 见 asset_pack.h): bg 代替波纹居中画在表盘底层, font 用于品牌名称;
+// NULL 表示使用内置的。在 watch_face_create() 之前调用, 资源在表盘存在期间必须保持有效
+void watch_face_set_assets(const lv_image_dsc_t *bg, const lv_font_t *font);
+
+// 秒针走法: 0 每秒跳一格(默认), 否则每秒走 hz 步(扫秒, 如8或16), 需要 t->ms
+void watch_face_set_sweep(uint8_t hz);
+
+#endif // WATCH_FACE_H
@@ -0,0 +1,115 @@
+#include "xip_profile.h"
+#include <stdio.h>
+#include "pico/stdlib.h"
+#include "hardware/timer.h"
+#include "hardware/irq.h"
+#include "hardware/structs/xip_ctrl.h"
+
+// XIP缓存和渲染热点剖析, 见 xip_profile.h
+// 采样中断和直方图都放在SRAM中, 剖析本身不占用XIP缓存。
+
+#define BUCKET_BITS     9
+#define BUCKET_COUNT    (1u << BUCKET_BITS)
+#define BUCKET_PROBES   8
+
+typedef struct {
+    uint32_t pc;
+    uint32_t count;
+} pc_bucket_t;
+
+static pc_bucket_t buckets[BUCKET_COUNT];
+static uint32_t samples;
+static uint32_t samples_flash;
+static uint32_t samples_ram;
+static uint32_t dropped;
+
+static uint alarm_num;
+static volatile bool sampling;
+
+static uint32_t frames;
+static uint64_t frame_start_us;
+static uint64_t frame_us_sum;
+static uint64_t hit_sum;
+static uint64_t acc_sum;
+
+static void __not_in_flash_func(pc_record)(uint32_t pc) {
+    samples++;
+    if (pc >= SRAM_BASE) samples_ram++;
+    else if (pc >= XIP_BASE) samples_flash++;
+
+    // 按4字节聚合, 开放寻址; 探测 BUCKET_PROBES 次还没有位置就丢弃
+    pc &= ~3u;
+    uint32_t h = (pc >> 2) * 2654435761u >> (32 - BUCKET_BITS);
+    for (uint32_t i = 0; i < BUCKET_PROBES; i++) {
+        pc_bucket_t *b = &buckets[(h + i) & (BUCKET_COUNT - 1)];
+        if (b->count == 0) b->pc = pc;
+        if (b->pc == pc) {
+            b->count++;
+            return;
+        }
+    }
+    dropped++;
+}
+
+// 异常入口压栈 r0-r3, r12, lr, pc, xpsr, 第7个字是被中断的PC
+static void __attribute__((used)) __not_in_flash_func(pc_sample)(const uint32_t *frame) {
+    timer_hw->intr = 1u << alarm_num;
+    if (!sampling) return;
+    timer_hw->alarm[alarm_num] = timer_hw->timerawl + XIP_PROFILE_SAMPLE_US;
+    pc_record(frame[6]);
+}
+
+// 主循环和中断都使用MSP, 入口时MSP指向压栈的异常帧
+static void __attribute__((naked)) __not_in_flash_func(pc_sample_isr)(void) {
+    __asm volatile(
+        "mrs r0, msp\n"
+        "ldr r1, =pc_sample\n"
+        "bx r1\n"
+        ".ltorg\n");
+}
+
+void xip_profile_init(void) {
+    alarm_num = (uint)hardware_alarm_claim_unused(true);
+    uint irq = hardware_alarm_get_irq_num(alarm_num);
+    irq_set_exclusive_handler(irq, pc_sample_isr);
+    hw_set_bits(&timer_hw->inte, 1u << alarm_num);
+    irq_set_enabled(irq, true);
+}
+
+void xip_profile_frame_begin(void) {
+    // 写任意值清零计数器
+    xip_ctrl_hw->ctr_hit = 0;
+    xip_ctrl_hw->ctr_acc = 0;
+    frame_start_us = time_us_64();
+
+    sampling = true;
+    timer_hw->alarm[alarm_num] = timer_hw->timerawl + XIP_PROFILE_SAMPLE_US;
+}
+
+static void report(void) {
+    uint32_t hit_bp = acc_sum ? (uint32_t)(hit_sum * 10000u / acc_sum) : 0;
+    printf("xip frames %lu: frame %llu us, hit %lu.%02lu%%, acc %llu/frame, samples %lu (flash %lu, ram %lu, dropped %lu)\n",
+           (unsigned long)frames, frame_us_sum / frames, (unsigned long)(hit_bp / 100), (unsigned long)(hit_bp % 100),
+           acc_sum / frames, (unsigned long)samples, (unsigned long)samples_flash, (unsigned long)samples_ram,
+           (unsigned long)dropped);
+    for (uint32_t i = 0; i < BUCKET_COUNT; i++) {
+        if (buckets[i].count) printf("xip pc 0x%08lx %lu\n", (unsigned long)buckets[i].pc, (unsigned long)buckets[i].count);
+        buckets[i].count = 0;
+    }
+    printf("xip end\n");
+
+    samples = samples_flash = samples_ram = dropped = 0;
+    frames = 0;
+    frame_us_sum = hit_sum = acc_sum = 0;
+}
+
+void xip_profile_frame_end(void) {
+    sampling = false;
+    uint32_t hit = xip_ctrl_hw->ctr_hit;
+    uint32_t acc = xip_ctrl_hw->ctr_acc;
+
+    frame_us_sum += time_us_64() - frame_start_us;
+    hit_sum += hit;
+    acc_sum += acc;
+    if (++frames >= XIP_PROFILE_FRAMES) report();
+}
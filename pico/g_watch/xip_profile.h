@@ -0,0 +1,29 @@
+#ifndef XIP_PROFILE_H
+#define XIP_PROFILE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// XIP缓存和渲染热点剖析(CMake选项 XIP_PROFILE)
+// 代码从flash经16KB的XIP缓存执行, 混合和遮罩循环缺失时每次要等QSPI读取。这里在每次LVGL刷新期间:
+//   - 用XIP_CTRL的 CTR_HIT/CTR_ACC 计数器统计缓存命中率(只统计可缓存的flash访问, SRAM中的代码不计)
+//   - 用一个硬件定时器闹钟按固定间隔采样被中断的PC, 按4字节聚合成热点直方图
+// 每 XIP_PROFILE_FRAMES 帧通过stdio输出一次平均帧时间、命中率和直方图:
+//   xip frames 300: frame 12345 us, hit 97.12%, acc 123456/frame, samples 2400 (flash 2100, ram 300, dropped 0)
+//   xip pc 0x10012345 57
+//   xip end
+// tools/xip_hot.py 把直方图对应到函数, 生成把最热的LVGL函数放进SRAM的段列表(XIP_HOT_SECTIONS)。
+
+#define XIP_PROFILE_FRAMES      300
+#define XIP_PROFILE_SAMPLE_US   97      // 和帧率、TE周期互质, 避免总采到同一段代码
+
+// 认领一个定时器闹钟, 之后每帧调用 begin/end
+void xip_profile_init(void);
+
+// 包住一次LVGL刷新(渲染和写出): 清零XIP计数器, 开始采样PC
+void xip_profile_frame_begin(void);
+
+// 停止采样, 累计这一帧的时间和XIP计数; 攒够 XIP_PROFILE_FRAMES 帧后输出报告并清零
+void xip_profile_frame_end(void);
+
+#endif // XIP_PROFILE_H
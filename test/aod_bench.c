@@ -0,0 +1,200 @@
+// 常亮显示(AOD)功耗估算(主机端, 无SDL, 虚拟时间)
+//
+// 按固件的两种显示模式各运行1小时虚拟时间, 统计功耗的两个替代指标:
+//   CPU运行时间 - 渲染和像素转换的主机线程CPU时间(只用于两种模式对比, 不等于RP2040上的时间)
+//   SPI字节数   - 每个窗口的CASET/RASET/RAMWR命令和参数(11字节) + 像素数据
+// 以及唤醒次数、刷新次数和按40MHz折算的SPI传输时间。
+//   normal - 固件表盘(watch_face.c), RGB565, 每秒更新时间, 每2个TE周期(约33ms)刷新一次
+//   aod    - 常亮表盘(aod.c), I1渲染, 转换为12位RGB444写入部分显示窗口, 每分钟RTC闹钟唤醒一次
+//
+// 用法: aod_bench [-m normal|aod|all] [-s 秒数]
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "lvgl.h"
+#include "src/core/lv_refr_private.h"
+#include "watch_face.h"
+#include "aod.h"
+
+// 与固件一致的屏幕和缓冲区
+#define LCD_WIDTH       240
+#define LCD_HEIGHT      240
+#define DISP_BUF_SIZE   (LCD_WIDTH * 10)
+
+#define FRAME_PERIOD_MS 33
+#define SPI_HZ          40000000
+#define WINDOW_CMD_BYTES 11
+
+typedef struct {
+    const char *name;
+    uint32_t wakeups;       // 从睡眠中醒来处理的次数
+    uint32_t refreshes;     // 有像素写入的刷新次数
+    uint64_t cpu_us;
+    uint64_t spi_bytes;
+    uint64_t pixels;
+} mode_result_t;
+
+static uint32_t virtual_ms;
+static lv_color_t buf1[DISP_BUF_SIZE];
+static uint32_t aod_buf[(AOD_BUF_SIZE + 3) / 4];
+static uint8_t aod_line[AOD_LINE_SIZE];
+static mode_result_t *current;
+static uint32_t frame_flushes;
+
+static uint64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000u;
+}
+
+static uint32_t virtual_tick_cb(void) {
+    return virtual_ms;
+}
+
+// 正常模式: RGB565直接写出
+static void normal_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    (void)px_map;
+    uint32_t px = lv_area_get_size(area);
+    current->pixels += px;
+    current->spi_bytes += WINDOW_CMD_BYTES + px * 2;
+    frame_flushes++;
+    lv_display_flush_ready(disp);
+}
+
+// AOD模式: 和固件一样逐行转换为RGB444
+static void aod_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    px_map += 8;
+    uint32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_I1);
+    current->spi_bytes += WINDOW_CMD_BYTES;
+    for (int32_t y = area->y1; y <= area->y2; y++) {
+        current->spi_bytes += aod_i1_to_rgb444(px_map, (uint16_t)w, aod_line);
+        px_map += stride;
+    }
+    current->pixels += lv_area_get_size(area);
+    frame_flushes++;
+    lv_display_flush_ready(disp);
+}
+
+static void to_watch_time(uint32_t s, watch_time_t *t) {
+    t->hour = (uint8_t)(10 + s / 3600 % 24);
+    t->min = (uint8_t)(s / 60 % 60);
+    t->sec = (uint8_t)(s % 60);
+    t->month = 1;
+    t->day = 1;
+    t->ms = 0;
+}
+
+// 唤醒一次: 更新时间并刷新, 统计CPU时间
+static void wake(mode_result_t *res, void (*set_time)(const watch_time_t *), const watch_time_t *t) {
+    frame_flushes = 0;
+    uint64_t t0 = now_us();
+    if (set_time) set_time(t);
+    lv_display_refr_timer(NULL);
+    res->cpu_us += now_us() - t0;
+    res->wakeups++;
+    if (frame_flushes) res->refreshes++;
+}
+
+static void run_normal(uint32_t seconds, mode_result_t *res) {
+    lv_display_t *disp = lv_display_create(LCD_WIDTH, LCD_HEIGHT);
+    lv_display_set_buffers(disp, buf1, NULL, sizeof(buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, normal_flush_cb);
+    lv_display_delete_refr_timer(disp);
+    watch_face_create(lv_screen_active());
+
+    // 首帧(整屏)在进入统计之前画完
+    watch_time_t t;
+    to_watch_time(0, &t);
+    watch_face_set_time(&t);
+    lv_display_refr_timer(NULL);
+    memset(res, 0, sizeof(*res));
+    res->name = "normal";
+
+    uint32_t frames = seconds * 1000 / FRAME_PERIOD_MS;
+    uint32_t last_sec = 0;
+    for (uint32_t f = 0; f < frames; f++) {
+        virtual_ms += FRAME_PERIOD_MS;
+        uint32_t sec = f * FRAME_PERIOD_MS / 1000;
+        to_watch_time(sec, &t);
+        wake(res, sec != last_sec ? watch_face_set_time : NULL, &t);
+        last_sec = sec;
+    }
+}
+
+static void run_aod(uint32_t seconds, mode_result_t *res) {
+    lv_display_t *disp = lv_display_create(AOD_WIDTH, AOD_HEIGHT);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_I1);
+    lv_display_set_buffers(disp, aod_buf, NULL, sizeof(aod_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, aod_flush_cb);
+    lv_display_delete_refr_timer(disp);
+    aod_face_create(lv_screen_active());
+
+    // 进入AOD时整个窗口重画一次, 之后每分钟唤醒
+    watch_time_t t;
+    to_watch_time(0, &t);
+    aod_face_set_time(&t);
+    lv_display_refr_timer(NULL);
+    memset(res, 0, sizeof(*res));
+    res->name = "aod";
+
+    for (uint32_t s = 60; s <= seconds; s += 60) {
+        virtual_ms += 60000;
+        to_watch_time(s, &t);
+        wake(res, aod_face_set_time, &t);
+    }
+}
+
+int main(int argc, char **argv) {
+    const char *mode = "all";
+    uint32_t seconds = 3600;
+    int opt;
+    while ((opt = getopt(argc, argv, "m:s:")) != -1) {
+        switch (opt) {
+            case 'm': mode = optarg; break;
+            case 's': seconds = (uint32_t)strtoul(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "usage: %s [-m normal|aod|all] [-s seconds]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (seconds < 60) seconds = 60;
+
+    static const struct {
+        const char *name;
+        void (*run)(uint32_t seconds, mode_result_t *res);
+    } modes[] = {
+        { "normal", run_normal },
+        { "aod", run_aod },
+    };
+
+    printf("%-8s %10s %10s %12s %14s %12s %12s\n", "mode", "wakeups/h", "refr/h", "cpu_ms/h",
+           "spi_bytes/h", "spi_ms/h", "pixels/h");
+    uint32_t count = 0;
+    for (size_t i = 0; i < sizeof(modes) / sizeof(modes[0]); i++) {
+        if (strcmp(mode, "all") && strcmp(mode, modes[i].name)) continue;
+        mode_result_t res;
+        current = &res;
+        virtual_ms = 0;
+        lv_init();
+        lv_tick_set_cb(virtual_tick_cb);
+        modes[i].run(seconds, &res);
+        lv_deinit();
+        count++;
+
+        // 折算为每小时
+        double k = 3600.0 / seconds;
+        printf("%-8s %10.0f %10.0f %12.1f %14.0f %12.1f %12.0f\n", res.name, res.wakeups * k,
+               res.refreshes * k, res.cpu_us * k / 1000.0, res.spi_bytes * k,
+               res.spi_bytes * 8 * k * 1000.0 / SPI_HZ, res.pixels * k);
+    }
+    if (count == 0) {
+        fprintf(stderr, "unknown mode: %s\n", mode);
+        return 2;
+    }
+    return 0;
+}
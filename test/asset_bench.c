@@ -0,0 +1,252 @@
+// 资源包加载基准测试(主机端, mmap)
+//
+// 对资源包中的每一项测量"从拿到资源到可以绘制"的时间和占用的LVGL堆:
+//   图片 pack - 经 asset_pack_get_image() 交给bin解码器, 未压缩图片直接使用包内像素(调色板图片同样不展开)
+//        copy - 先把同样的字节读到堆上再解码(相当于从文件系统把.bin整个读进RAM)
+//   字体 pack - asset_pack_font_create(), 字形数据留在包内
+//        bin  - 原始.bin字体经 lv_binfont_loader 加载(包内的 font_bin 项)
+// 包内同时有 NAME 和 NAME_bin 两个字体项时, 还会逐个字符比较两者的字形描述和位图, 用于校验打包工具。
+// 字体的 bin 方式需要 LV_USE_FS_MEMFS; 压缩图片需要 LV_USE_RLE/LV_USE_LZ4, 整图压缩的还需要 LV_BIN_DECODER_RAM_LOAD, 否则跳过。
+//
+// 用法: asset_bench face.pack [-n 重复次数]
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "lvgl.h"
+#include "src/font/lv_font_fmt_txt.h"
+#include "src/draw/lv_image_decoder_private.h"
+#include "asset_pack.h"
+
+#define DEFAULT_REPEAT 200
+
+typedef struct {
+    uint64_t total_us;
+    uint32_t heap_bytes;    // 资源保持打开时占用的堆
+    bool ok;
+} load_result_t;
+
+static uint64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000u;
+}
+
+static uint32_t heap_used(void) {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return (uint32_t)(mon.total_size - mon.free_size);
+}
+
+// 打开图片并取得全部像素(渲染器需要的工作), 返回时保持打开以便统计堆
+static bool image_open(lv_image_decoder_dsc_t *dsc, const lv_image_dsc_t *src) {
+    lv_image_decoder_args_t args = { 0 };
+    // 与软件渲染器画到RGB565时一样, 调色板图片不展开
+    args.use_indexed = LV_COLOR_FORMAT_IS_INDEXED(src->header.cf);
+    if (lv_image_decoder_open(dsc, src, &args) != LV_RESULT_OK) return false;
+    if (dsc->decoded) return true;
+
+    // 没有整图时按渲染器的方式逐行解码
+    lv_area_t full = { 0, 0, dsc->header.w - 1, dsc->header.h - 1 };
+    lv_area_t decoded;
+    lv_area_set(&decoded, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN, LV_COORD_MIN);
+    while (lv_image_decoder_get_area(dsc, &full, &decoded) == LV_RESULT_OK) {
+        if (decoded.y2 >= full.y2) break;
+    }
+    return true;
+}
+
+// copy为true时先把图片数据拷贝到堆上, 拷贝的时间和内存也计入
+static load_result_t bench_image(const lv_image_dsc_t *src, bool copy, uint32_t repeat) {
+    load_result_t res = { 0 };
+    lv_image_decoder_dsc_t dsc;
+    lv_image_dsc_t ram;
+
+    for (uint32_t i = 0; i < repeat; i++) {
+        uint32_t heap0 = heap_used();
+        uint64_t t0 = now_us();
+        void *buf = NULL;
+        if (copy) {
+            buf = lv_malloc(src->data_size);
+            if (buf == NULL) return res;
+            memcpy(buf, src->data, src->data_size);
+            ram = *src;
+            ram.data = buf;
+        }
+        const lv_image_dsc_t *img = copy ? &ram : src;
+        res.ok = image_open(&dsc, img);
+        res.total_us += now_us() - t0;
+        if (!res.ok) {
+            lv_free(buf);
+            return res;
+        }
+
+        res.heap_bytes = heap_used() - heap0;
+        lv_image_decoder_close(&dsc);
+        // 不让下一次命中解码缓存
+        lv_image_cache_drop(img);
+        lv_free(buf);
+    }
+    return res;
+}
+
+// 当前配置能否解码这张图片
+static bool image_supported(const lv_image_dsc_t *img) {
+    if (!(img->header.flags & LV_IMAGE_FLAGS_COMPRESSED)) return true;
+    // 压缩头第一个字: 低4位为压缩方法, 其后12位为行带高度
+    uint32_t method = *(const uint32_t *)img->data & 0xf;
+    uint32_t band_height = (*(const uint32_t *)img->data >> 4) & 0xfff;
+    // 整图压缩的图片只能整图解压到RAM
+    if (band_height == 0 && !LV_BIN_DECODER_RAM_LOAD) return false;
+    return (method == LV_IMAGE_COMPRESS_RLE && LV_USE_RLE) || (method == LV_IMAGE_COMPRESS_LZ4 && LV_USE_LZ4);
+}
+
+static load_result_t bench_font(const asset_pack_t *pack, const char *name, uint32_t repeat) {
+    load_result_t res = { 0 };
+
+    for (uint32_t i = 0; i < repeat; i++) {
+        uint32_t heap0 = heap_used();
+        uint64_t t0 = now_us();
+        lv_font_t *font = asset_pack_font_create(pack, name);
+        res.total_us += now_us() - t0;
+        res.ok = font != NULL;
+        if (!res.ok) return res;
+
+        res.heap_bytes = heap_used() - heap0;
+        asset_pack_font_destroy(font);
+    }
+    return res;
+}
+
+static void print_result(const char *name, const char *type, const char *route, load_result_t r, uint32_t repeat) {
+    if (!r.ok) {
+        printf("  %-20s %-5s %-4s failed\n", name, type, route);
+        return;
+    }
+    printf("  %-20s %-5s %-4s %9.1f us  heap=%7u B\n", name, type, route,
+           (double)r.total_us / repeat, r.heap_bytes);
+}
+
+// 逐字符比较两个字体, 返回不一致的字符数
+static uint32_t font_compare(const lv_font_t *a, const lv_font_t *b, uint32_t *checked) {
+    const lv_font_fmt_txt_dsc_t *dsc = a->dsc;
+    static uint8_t buf_a[256 * 256];
+    static uint8_t buf_b[256 * 256];
+    uint32_t mismatch = 0;
+
+    *checked = 0;
+    if (a->line_height != b->line_height || a->base_line != b->base_line) return 1;
+
+    for (uint32_t c = 0; c < dsc->cmap_num; c++) {
+        const lv_font_fmt_txt_cmap_t *cmap = &dsc->cmaps[c];
+        for (uint32_t u = cmap->range_start; u < cmap->range_start + cmap->range_length; u++) {
+            lv_font_glyph_dsc_t ga, gb;
+            bool ha = lv_font_get_glyph_dsc(a, &ga, u, 'A');
+            bool hb = lv_font_get_glyph_dsc(b, &gb, u, 'A');
+            if (ha != hb) {
+                mismatch++;
+                continue;
+            }
+            if (!ha) continue;
+
+            (*checked)++;
+            if (ga.adv_w != gb.adv_w || ga.box_w != gb.box_w || ga.box_h != gb.box_h ||
+                ga.ofs_x != gb.ofs_x || ga.ofs_y != gb.ofs_y) {
+                mismatch++;
+                continue;
+            }
+
+            uint32_t size = lv_draw_buf_width_to_stride(ga.box_w, LV_COLOR_FORMAT_A8) * ga.box_h;
+            if (size == 0 || size > sizeof(buf_a)) continue;
+
+            lv_draw_buf_t da, db;
+            lv_draw_buf_init(&da, ga.box_w, ga.box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO, buf_a, sizeof(buf_a));
+            lv_draw_buf_init(&db, gb.box_w, gb.box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO, buf_b, sizeof(buf_b));
+            const void *pa = lv_font_get_glyph_bitmap(&ga, &da);
+            const void *pb = lv_font_get_glyph_bitmap(&gb, &db);
+            if ((pa == NULL) != (pb == NULL) || (pa && memcmp(buf_a, buf_b, size) != 0)) mismatch++;
+        }
+    }
+    return mismatch;
+}
+
+int main(int argc, char **argv) {
+    uint32_t repeat = DEFAULT_REPEAT;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:")) != -1) {
+        if (opt == 'n') repeat = (uint32_t)atoi(optarg);
+        else {
+            fprintf(stderr, "usage: %s face.pack [-n repeat]\n", argv[0]);
+            return 2;
+        }
+    }
+    if (optind >= argc || repeat == 0) {
+        fprintf(stderr, "usage: %s face.pack [-n repeat]\n", argv[0]);
+        return 2;
+    }
+
+    lv_init();
+
+    asset_pack_t pack;
+    uint64_t t0 = now_us();
+    for (uint32_t i = 0; i < repeat; i++) {
+        if (i) asset_pack_close(&pack);
+        if (!asset_pack_open_file(&pack, argv[optind])) {
+            fprintf(stderr, "asset_bench: cannot open %s\n", argv[optind]);
+            return 1;
+        }
+    }
+    printf("[open] %s: %u entries, %u bytes, %.1f us (mmap + index check)\n", argv[optind],
+           pack.entry_cnt, pack.size, (double)(now_us() - t0) / repeat);
+
+    int failed = 0;
+    for (uint32_t i = 0; i < pack.entry_cnt; i++) {
+        const asset_pack_entry_t *e = &pack.entries[i];
+
+        if (e->type == ASSET_TYPE_IMAGE) {
+            const lv_image_dsc_t *img = asset_pack_get_image(&pack, e->name);
+            if (!image_supported(img)) {
+                printf("  %-20s %-5s      skipped (compressed, not enabled in lv_conf.h)\n", e->name, "image");
+                continue;
+            }
+            load_result_t r = bench_image(img, false, repeat);
+            print_result(e->name, "image", "pack", r, repeat);
+            failed |= !r.ok;
+            print_result(e->name, "image", "copy", bench_image(img, true, repeat), repeat);
+        } else if (e->type == ASSET_TYPE_FONT_BIN && !LV_USE_FS_MEMFS) {
+            printf("  %-20s %-5s      skipped (needs LV_USE_FS_MEMFS)\n", e->name, "font");
+        } else if (e->type == ASSET_TYPE_FONT || e->type == ASSET_TYPE_FONT_BIN) {
+            load_result_t r = bench_font(&pack, e->name, repeat);
+            print_result(e->name, "font", e->type == ASSET_TYPE_FONT ? "pack" : "bin", r, repeat);
+            failed |= !r.ok && e->type == ASSET_TYPE_FONT;
+        }
+    }
+
+    // 预解析字体与LVGL自己加载的同一字体逐字符对比
+    for (uint32_t i = 0; i < pack.entry_cnt; i++) {
+        const asset_pack_entry_t *e = &pack.entries[i];
+        char bin_name[ASSET_PACK_NAME_MAX + 4];
+        snprintf(bin_name, sizeof(bin_name), "%s_bin", e->name);
+        const asset_pack_entry_t *b = asset_pack_find(&pack, bin_name);
+        if (e->type != ASSET_TYPE_FONT || b == NULL || b->type != ASSET_TYPE_FONT_BIN) continue;
+
+        lv_font_t *fa = asset_pack_font_create(&pack, e->name);
+        lv_font_t *fb = asset_pack_font_create(&pack, bin_name);
+        if (fa && fb) {
+            uint32_t checked;
+            uint32_t mismatch = font_compare(fa, fb, &checked);
+            printf("[check] %s vs %s: %u glyphs, %u mismatches\n", e->name, bin_name, checked, mismatch);
+            failed |= mismatch != 0;
+        }
+        asset_pack_font_destroy(fa);
+        asset_pack_font_destroy(fb);
+    }
+
+    asset_pack_close(&pack);
+    lv_deinit();
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,245 @@
+// 帧预算调速器仿真(主机端, 虚拟时间)
+//
+// 用一个简单的模型评估 clock_gov.c 的策略, 不需要硬件:
+//   渲染: 每帧 RENDER_OVERHEAD 个周期, 加上每个刷新像素 cpp 个周期(每帧带随机波动), 时间 = 周期 / sys_khz
+//   写入: 每像素16位按工作点的写入速率发送, 每个10行窗口另加 WINDOW_OVERHEAD_US
+//   一帧的忙碌时间: 阻塞SPI是渲染+写入; PIO+DMA写入和渲染下一块重叠, 约为 max + min/窗口数
+//   切换工作点: PLL重新锁定 SWITCH_US, 升压另外等 VREG_SETTLE_US, 算在下一帧里
+//   功耗(相对单位): 忙碌时 f*V^2, 空闲(WFE/sleep, 时钟仍在运行)时 IDLE_RATIO*f*V^2
+// 负载场景按33ms的刷新节拍给出每帧刷新的像素数:
+//   tick  - 静止表盘, 每秒刷新一次时间(240x30)
+//   swipe - 每分钟一次1.5秒的整屏滑动, 其余时间同 tick
+//   anim  - 持续的中等动画(120x120每帧)
+// 对比固定在各工作点和调速器: 超出预算的帧数、切换次数、平均频率和相对125MHz的能耗。
+// 工作点和调速参数与 main.c 相同, 也可以用参数覆盖。调速器在某个场景下比固定125MHz
+// 更耗能, 或者超预算的帧比固定125MHz多出动画开始次数以上时返回1。
+// 模型的参数是估计值, 只用于比较策略, 不代表RP2040上的实测功耗。
+//
+// 用法: clock_gov_sim [-t spi|pio] [-n 每个场景的秒数] [-s 随机种子]
+//                     [-u up_pct] [-f fit_pct] [-d down_pct] [-w down_frames] [-i idle_ms]
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include "clock_gov.h"
+#include "lcd_transport.h"
+
+#define LCD_WIDTH           240
+#define BUF_ROWS            10
+#define FRAME_US            33334       // 2个TE周期
+#define RENDER_OVERHEAD     60000       // 每帧固定的LVGL开销(周期)
+#define WINDOW_OVERHEAD_US  20
+#define SWITCH_US           200
+#define VREG_SETTLE_US      1000
+#define IDLE_RATIO          0.3
+#define NOISE_PCT           15
+
+typedef struct {
+    uint32_t sys_khz;
+    uint16_t mv;
+} point_t;
+
+// 和 main.c 的 gov_points 相同
+static const point_t points[] = {
+    { 48000, 1000 },
+    { 72000, 1000 },
+    { 96000, 1050 },
+    { 125000, 1100 },
+    { 133000, 1100 },
+};
+
+#define LEVELS      (sizeof(points) / sizeof(points[0]))
+#define START_LEVEL 3
+
+typedef enum { SC_TICK, SC_SWIPE, SC_ANIM } scenario_id_t;
+
+typedef struct {
+    const char *name;
+    scenario_id_t id;
+} scenario_t;
+
+static const scenario_t scenarios[] = {
+    { "tick", SC_TICK },
+    { "swipe", SC_SWIPE },
+    { "anim", SC_ANIM },
+};
+
+typedef struct {
+    uint32_t frames;
+    uint32_t over;
+    uint32_t switches;
+    uint32_t bursts;        // 动画开始的次数
+    double mhz_us;          // 频率对时间的积分, 求平均频率
+    double energy;
+    uint64_t time_us;
+} result_t;
+
+static clock_gov_level_t levels[LEVELS];
+static bool overlap;
+static uint32_t seed = 1;
+
+static uint32_t rnd(void) {
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 8;
+}
+
+// 第 tick 个刷新节拍要刷新的像素数和每像素周期数, 没有刷新时返回0
+static uint32_t workload(scenario_id_t id, uint32_t tick, uint32_t *cpp, bool *burst) {
+    uint32_t ticks_per_s = 1000000 / FRAME_US;
+    *burst = false;
+    switch (id) {
+        case SC_SWIPE: {
+            uint32_t t = tick % (60 * ticks_per_s);
+            if (t < ticks_per_s * 3 / 2) {
+                *burst = t == 0;
+                *cpp = 15;
+                return LCD_WIDTH * LCD_WIDTH;
+            }
+        }
+        // fall through
+        case SC_TICK:
+            *cpp = 40;
+            return tick % ticks_per_s == 0 ? LCD_WIDTH * 30 : 0;
+        case SC_ANIM:
+        default:
+            *burst = tick == 0;
+            *cpp = 40;
+            return 120 * 120;
+    }
+}
+
+static double power(uint8_t l, bool busy) {
+    double v = levels[l].mv / 1000.0;
+    double p = levels[l].sys_khz / 1000.0 * v * v;
+    return busy ? p : p * IDLE_RATIO;
+}
+
+// fixed < 0 时使用调速器, 否则固定在这个工作点
+static result_t run(scenario_id_t id, uint32_t seconds, int fixed, const clock_gov_cfg_t *cfg) {
+    result_t r;
+    memset(&r, 0, sizeof(r));
+    seed = 12345;
+
+    clock_gov_cfg_t c = *cfg;
+    c.start = fixed < 0 ? START_LEVEL : (uint8_t)fixed;
+    clock_gov_init(&c, 0);
+    uint8_t level = c.start;
+    uint32_t pending_us = 0;        // 上一次切换的耗时, 推迟下一帧
+    uint32_t ticks = seconds * (1000000 / FRAME_US);
+
+    for (uint32_t tick = 0; tick < ticks; tick++) {
+        uint32_t now = tick * FRAME_US;
+        uint32_t cpp;
+        bool burst;
+        uint32_t px = workload(id, tick, &cpp, &burst);
+        uint32_t busy_us = pending_us;
+        pending_us = 0;
+        if (burst) r.bursts++;
+
+        uint8_t to = level;
+        if (px) {
+            const clock_gov_level_t *l = &levels[level];
+            int32_t noise = (int32_t)(rnd() % (2 * NOISE_PCT + 1)) - NOISE_PCT;
+            uint64_t cycles = RENDER_OVERHEAD + (uint64_t)px * cpp * (uint32_t)(100 + noise) / 100;
+            uint32_t windows = (px + LCD_WIDTH * BUF_ROWS - 1) / (LCD_WIDTH * BUF_ROWS);
+            clock_gov_frame_t f = {
+                .render_us = (uint32_t)(cycles * 1000 / l->sys_khz),
+                .write_us = (uint32_t)((uint64_t)px * 16 * 1000000 / l->write_hz) + windows * WINDOW_OVERHEAD_US,
+            };
+
+            uint32_t lo = f.render_us < f.write_us ? f.render_us : f.write_us;
+            uint32_t hi = f.render_us < f.write_us ? f.write_us : f.render_us;
+            busy_us += overlap ? hi + lo / windows : f.render_us + f.write_us;
+            r.frames++;
+            if (busy_us > FRAME_US) r.over++;
+            if (fixed < 0) to = clock_gov_frame(&f, now + busy_us);
+        } else if (fixed < 0) {
+            to = clock_gov_idle(now);
+        }
+
+        uint32_t frame_busy = busy_us < FRAME_US ? busy_us : FRAME_US;
+        r.energy += frame_busy * power(level, true) + (FRAME_US - frame_busy) * power(level, false);
+        r.mhz_us += (double)FRAME_US * levels[level].sys_khz / 1000.0;
+        r.time_us += FRAME_US;
+
+        if (to != level) {
+            pending_us = SWITCH_US + (levels[to].mv > levels[level].mv ? VREG_SETTLE_US : 0);
+            r.switches++;
+            level = to;
+        }
+    }
+    return r;
+}
+
+int main(int argc, char **argv) {
+    uint32_t seconds = 600;
+    const char *transport = "spi";
+    clock_gov_cfg_t cfg = {
+        .levels = levels,
+        .count = LEVELS,
+        .start = START_LEVEL,
+        .budget_us = FRAME_US,
+        .up_pct = 85,
+        .fit_pct = 70,
+        .down_pct = 60,
+        .down_frames = 30,
+        .idle_us = 300000,
+    };
+
+    int opt;
+    while ((opt = getopt(argc, argv, "t:n:s:u:f:d:w:i:")) != -1) {
+        switch (opt) {
+            case 't': transport = optarg; break;
+            case 'n': seconds = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 's': seed = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'u': cfg.up_pct = (uint8_t)atoi(optarg); break;
+            case 'f': cfg.fit_pct = (uint8_t)atoi(optarg); break;
+            case 'd': cfg.down_pct = (uint8_t)atoi(optarg); break;
+            case 'w': cfg.down_frames = (uint16_t)atoi(optarg); break;
+            case 'i': cfg.idle_us = (uint32_t)atoi(optarg) * 1000; break;
+            default:
+                fprintf(stderr, "usage: %s [-t spi|pio] [-n seconds] [-s seed] [-u up] [-f fit] [-d down] "
+                        "[-w down_frames] [-i idle_ms]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (seconds == 0) seconds = 1;
+
+    overlap = strcmp(transport, "pio") == 0;
+    cfg.overlap = overlap;
+    for (size_t i = 0; i < LEVELS; i++) {
+        uint32_t hz = points[i].sys_khz * 1000;
+        levels[i].sys_khz = points[i].sys_khz;
+        levels[i].write_hz = overlap ? (hz / 2 < LCD_PIO_HZ ? hz / 2 : LCD_PIO_HZ) : clock_gov_spi_hz(hz, LCD_SPI_HZ);
+        levels[i].mv = points[i].mv;
+    }
+
+    printf("transport %s, %u s per scenario\n", overlap ? "pio" : "spi", seconds);
+    for (size_t i = 0; i < LEVELS; i++) {
+        printf("  level %zu: %6u kHz, write %5.2f MHz, %u mV\n", i, levels[i].sys_khz,
+               levels[i].write_hz / 1e6, levels[i].mv);
+    }
+
+    int ret = 0;
+    printf("%-6s %-10s %8s %8s %8s %8s %8s\n", "scene", "policy", "frames", "over", "switch", "avg_mhz", "energy");
+    for (size_t s = 0; s < sizeof(scenarios) / sizeof(scenarios[0]); s++) {
+        result_t base = run(scenarios[s].id, seconds, START_LEVEL, &cfg);
+        for (int p = -1; p < (int)LEVELS; p++) {
+            result_t r = p == START_LEVEL ? base : run(scenarios[s].id, seconds, p, &cfg);
+            char name[16];
+            if (p < 0) snprintf(name, sizeof(name), "governor");
+            else snprintf(name, sizeof(name), "%u", levels[p].sys_khz / 1000);
+            printf("%-6s %-10s %8u %8u %8u %8.1f %8.3f\n", scenarios[s].name, name, r.frames, r.over,
+                   r.switches, r.mhz_us / r.time_us, r.energy / base.energy);
+
+            if (p < 0 && (r.energy > base.energy || r.over > base.over + r.bursts)) {
+                printf("FAIL: governor worse than fixed %u MHz in %s\n", levels[START_LEVEL].sys_khz / 1000,
+                       scenarios[s].name);
+                ret = 1;
+            }
+        }
+    }
+    return ret;
+}
@@ -0,0 +1,425 @@
+// 表盘基准测试(主机端, 无SDL, 虚拟时间)
+//
+// 用内存显示驱动渲染模拟器表盘(sim)和固件表盘(fw), lv_tick 由虚拟时钟驱动,
+// 按脚本把表盘时间从 00:00:00 扫到 12:00:00, 每一步运行若干帧让动画走完。
+// 统计每个表盘的:
+//   帧时间百分位(只统计实际刷新了像素的帧, 主机线程CPU时间, 仅用于前后对比)
+//   渲染像素数 / flush字节数 / flush次数
+//   每帧绘制任务数(通过一个只计数、从不接任务的绘制单元统计)
+//   LVGL堆峰值
+//   表盘构建: 构建后多占用的LVGL堆(控件+样式)和构建耗时
+// 结果以JSON输出; 指定基线文件时, 任何指标超过基线 (1 + 阈值%) 即返回1。
+// 像素/字节/任务数/堆占用是确定的, 用 -t 阈值(默认1%); 帧时间和构建耗时受主机负载影响, 用 -T 阈值(默认50%)。
+// LVGL内存分配失败时断言会死循环, 因此每个表盘设有超时, 超时返回3。
+//
+// 用法: face_bench [-f sim|fw|all] [-o report.json] [-b baseline.json] [-t 阈值%] [-T 帧时间阈值%]
+//                  [-s 步长秒] [-n 每步帧数] [-r 重复次数]
+#include <stdio.h>
+#include <stdlib.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <signal.h>
+#include "lvgl.h"
+#include "src/draw/lv_draw_private.h"
+#include "sim_face.h"
+#include "watch_face.h"
+
+// 与固件一致的屏幕和缓冲区
+#define LCD_WIDTH       240
+#define LCD_HEIGHT      240
+#define DISP_BUF_SIZE   (LCD_WIDTH * 10)
+
+// 虚拟时间每帧前进的毫秒数
+#define FRAME_PERIOD_MS 33
+
+#define SWEEP_SECONDS   (12 * 3600)
+#define FACE_TIMEOUT_S  120
+#define MAX_FRAMES      (1 << 20)
+
+typedef struct {
+    const char *name;
+    void (*create)(lv_obj_t *parent);
+    void (*set_time)(const struct tm *t);
+} face_desc_t;
+
+// 单个表盘的测量结果
+typedef struct {
+    const char *name;
+    uint32_t frames;
+    uint32_t rendered_frames;
+    uint32_t frame_p50_us;
+    uint32_t frame_p90_us;
+    uint32_t frame_p99_us;
+    uint32_t frame_max_us;
+    uint64_t pixels;
+    uint64_t flush_bytes;
+    uint32_t flushes;
+    uint64_t draw_tasks;
+    uint32_t draw_tasks_per_frame_max;
+    uint32_t heap_max_used;
+    uint32_t heap_after_create;     // face->create 前后LVGL堆占用之差
+    uint32_t create_us;
+} face_result_t;
+
+// 指标(都是越小越好)
+typedef struct {
+    const char *key;
+    size_t offset;
+    bool is_u64;
+    uint8_t kind;
+} metric_desc_t;
+
+enum {
+    METRIC_EXACT,   // 确定值, 用 -t 阈值比较
+    METRIC_TIMING,  // 主机耗时, 用 -T 阈值比较
+    METRIC_INFO,    // 只报告, 不比较(单帧最大值噪声太大)
+};
+
+#define METRIC_U32(f, kind) { #f, offsetof(face_result_t, f), false, kind }
+#define METRIC_U64(f, kind) { #f, offsetof(face_result_t, f), true, kind }
+
+static const metric_desc_t metrics[] = {
+    METRIC_U32(frame_p50_us, METRIC_TIMING),
+    METRIC_U32(frame_p90_us, METRIC_TIMING),
+    METRIC_U32(frame_p99_us, METRIC_TIMING),
+    METRIC_U32(frame_max_us, METRIC_INFO),
+    METRIC_U64(pixels, METRIC_EXACT),
+    METRIC_U64(flush_bytes, METRIC_EXACT),
+    METRIC_U32(flushes, METRIC_EXACT),
+    METRIC_U64(draw_tasks, METRIC_EXACT),
+    METRIC_U32(draw_tasks_per_frame_max, METRIC_EXACT),
+    METRIC_U32(heap_max_used, METRIC_EXACT),
+    METRIC_U32(heap_after_create, METRIC_EXACT),
+    METRIC_U32(create_us, METRIC_TIMING),
+};
+
+#define METRIC_COUNT (sizeof(metrics) / sizeof(metrics[0]))
+
+static uint32_t virtual_ms;
+static const char *volatile current_face;
+static lv_color_t buf1[DISP_BUF_SIZE];
+static uint32_t frame_us[MAX_FRAMES];
+
+// 当前帧的计数
+static uint32_t frame_pixels;
+static uint32_t frame_flush_bytes;
+static uint32_t frame_flushes;
+static uint32_t frame_draw_tasks;
+
+// 线程CPU时间: 不计入被其它进程抢占的时间, 比墙钟稳定
+static uint64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000u;
+}
+
+static void timeout_handler(int sig) {
+    (void)sig;
+    static const char msg[] = "face_bench: timeout, LVGL probably halted in LV_ASSERT_HANDLER (out of memory?) face=";
+    write(STDERR_FILENO, msg, sizeof(msg) - 1);
+    write(STDERR_FILENO, current_face, strlen(current_face));
+    write(STDERR_FILENO, "\n", 1);
+    _exit(3);
+}
+
+static uint32_t virtual_tick_cb(void) {
+    return virtual_ms;
+}
+
+// 内存显示驱动: 只计数, 立即完成
+static void bench_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    (void)px_map;
+    uint32_t px = lv_area_get_size(area);
+    frame_pixels += px;
+    frame_flush_bytes += px * lv_color_format_get_size(lv_display_get_color_format(disp));
+    frame_flushes++;
+    lv_display_flush_ready(disp);
+}
+
+// 计数绘制单元: 每个新建的绘制任务都会经过 evaluate_cb, 但它从不接任务
+static int32_t count_evaluate_cb(lv_draw_unit_t *unit, lv_draw_task_t *task) {
+    (void)unit;
+    (void)task;
+    frame_draw_tasks++;
+    return 0;
+}
+
+static int32_t count_dispatch_cb(lv_draw_unit_t *unit, lv_layer_t *layer) {
+    (void)unit;
+    (void)layer;
+    return LV_DRAW_UNIT_IDLE;
+}
+
+static void fw_face_set_time(const struct tm *t) {
+    watch_time_t wt = {
+        .hour = t->tm_hour,
+        .min = t->tm_min,
+        .sec = t->tm_sec,
+        .month = t->tm_mon + 1,
+        .day = t->tm_mday
+    };
+    watch_face_set_time(&wt);
+}
+
+static const face_desc_t faces[] = {
+    { "sim", sim_face_create, sim_face_set_time },
+    { "fw", watch_face_create, fw_face_set_time },
+};
+
+#define FACE_COUNT (sizeof(faces) / sizeof(faces[0]))
+
+static uint32_t heap_used(void) {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return (uint32_t)(mon.total_size - mon.free_size);
+}
+
+static int cmp_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static uint32_t percentile(const uint32_t *sorted, uint32_t count, uint32_t pct) {
+    if (count == 0) return 0;
+    uint32_t idx = (uint32_t)((uint64_t)count * pct / 100);
+    return sorted[idx < count ? idx : count - 1];
+}
+
+// 运行一帧: 虚拟时间前进一个刷新周期, 再执行LVGL
+static void run_frame(face_result_t *res) {
+    frame_pixels = 0;
+    frame_flush_bytes = 0;
+    frame_flushes = 0;
+    frame_draw_tasks = 0;
+
+    virtual_ms += FRAME_PERIOD_MS;
+    uint64_t t0 = now_us();
+    lv_timer_handler();
+    uint32_t elapsed = (uint32_t)(now_us() - t0);
+
+    res->frames++;
+    if (frame_flushes == 0) return;
+
+    if (res->rendered_frames < MAX_FRAMES) frame_us[res->rendered_frames] = elapsed;
+    res->rendered_frames++;
+    res->pixels += frame_pixels;
+    res->flush_bytes += frame_flush_bytes;
+    res->flushes += frame_flushes;
+    res->draw_tasks += frame_draw_tasks;
+    if (frame_draw_tasks > res->draw_tasks_per_frame_max) res->draw_tasks_per_frame_max = frame_draw_tasks;
+}
+
+static void run_face(const face_desc_t *face, uint32_t step_sec, uint32_t frames_per_step, face_result_t *res) {
+    memset(res, 0, sizeof(*res));
+    res->name = face->name;
+    virtual_ms = 0;
+    current_face = face->name;
+    alarm(FACE_TIMEOUT_S);
+
+    lv_init();
+    lv_tick_set_cb(virtual_tick_cb);
+
+    lv_display_t *disp = lv_display_create(LCD_WIDTH, LCD_HEIGHT);
+    lv_display_set_buffers(disp, buf1, NULL, sizeof(buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, bench_flush_cb);
+
+    lv_draw_unit_t *counter = lv_draw_create_unit(sizeof(lv_draw_unit_t));
+    counter->evaluate_cb = count_evaluate_cb;
+    counter->dispatch_cb = count_dispatch_cb;
+    counter->name = "BENCH_COUNT";
+
+    uint32_t heap_before = heap_used();
+    uint64_t t0 = now_us();
+    face->create(lv_screen_active());
+    res->create_us = (uint32_t)(now_us() - t0);
+    res->heap_after_create = heap_used() - heap_before;
+
+    // 固定日期, 时间从 00:00:00 开始扫描; 首帧(整屏)也计入统计
+    struct tm t = { .tm_year = 125, .tm_mon = 11, .tm_mday = 1 };
+    for (uint32_t s = 0; s <= SWEEP_SECONDS; s += step_sec) {
+        t.tm_hour = s / 3600;
+        t.tm_min = s / 60 % 60;
+        t.tm_sec = s % 60;
+        face->set_time(&t);
+        for (uint32_t f = 0; f < frames_per_step; f++) run_frame(res);
+    }
+
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    res->heap_max_used = mon.max_used;
+
+    uint32_t n = res->rendered_frames < MAX_FRAMES ? res->rendered_frames : MAX_FRAMES;
+    qsort(frame_us, n, sizeof(uint32_t), cmp_u32);
+    res->frame_p50_us = percentile(frame_us, n, 50);
+    res->frame_p90_us = percentile(frame_us, n, 90);
+    res->frame_p99_us = percentile(frame_us, n, 99);
+    res->frame_max_us = n ? frame_us[n - 1] : 0;
+
+    lv_deinit();
+    alarm(0);
+}
+
+static uint64_t metric_get(const face_result_t *res, const metric_desc_t *m) {
+    const uint8_t *p = (const uint8_t *)res + m->offset;
+    return m->is_u64 ? *(const uint64_t *)p : *(const uint32_t *)p;
+}
+
+static void write_report(FILE *fp, const face_result_t *results, uint32_t count,
+                         uint32_t step_sec, uint32_t frames_per_step, uint32_t repeats) {
+    fprintf(fp, "{\n");
+    fprintf(fp, "  \"config\": {\"width\": %d, \"height\": %d, \"buf_px\": %d, \"frame_period_ms\": %d, "
+                "\"sweep_s\": %d, \"step_s\": %u, \"frames_per_step\": %u, \"repeats\": %u},\n",
+            LCD_WIDTH, LCD_HEIGHT, DISP_BUF_SIZE, FRAME_PERIOD_MS, SWEEP_SECONDS, step_sec, frames_per_step, repeats);
+    fprintf(fp, "  \"faces\": [\n");
+    for (uint32_t i = 0; i < count; i++) {
+        const face_result_t *res = &results[i];
+        fprintf(fp, "    {\"name\": \"%s\", \"frames\": %u, \"rendered_frames\": %u", res->name,
+                res->frames, res->rendered_frames);
+        for (uint32_t m = 0; m < METRIC_COUNT; m++) {
+            fprintf(fp, ", \"%s\": %llu", metrics[m].key, (unsigned long long)metric_get(res, &metrics[m]));
+        }
+        fprintf(fp, "}%s\n", i + 1 < count ? "," : "");
+    }
+    fprintf(fp, "  ]\n}\n");
+}
+
+static char *read_file(const char *path) {
+    FILE *fp = fopen(path, "rb");
+    if (fp == NULL) return NULL;
+    fseek(fp, 0, SEEK_END);
+    long size = ftell(fp);
+    fseek(fp, 0, SEEK_SET);
+    char *buf = malloc(size + 1);
+    if (buf && fread(buf, 1, size, fp) != (size_t)size) {
+        free(buf);
+        buf = NULL;
+    }
+    if (buf) buf[size] = '\0';
+    fclose(fp);
+    return buf;
+}
+
+// 在基线报告中查找某个表盘的某个指标(只解析本程序写出的扁平格式)
+static bool baseline_find(const char *json, const char *face, const char *key, uint64_t *value) {
+    char pattern[64];
+    snprintf(pattern, sizeof(pattern), "\"name\": \"%s\"", face);
+    const char *obj = strstr(json, pattern);
+    if (obj == NULL) return false;
+    const char *obj_end = strchr(obj, '}');
+
+    snprintf(pattern, sizeof(pattern), "\"%s\": ", key);
+    const char *p = strstr(obj, pattern);
+    if (p == NULL || (obj_end && p > obj_end)) return false;
+    *value = strtoull(p + strlen(pattern), NULL, 10);
+    return true;
+}
+
+// 与基线比较, 返回超过阈值的指标数
+static uint32_t compare_baseline(const char *json, const face_result_t *results, uint32_t count,
+                                 double threshold_pct, double timing_threshold_pct) {
+    uint32_t regressions = 0;
+
+    for (uint32_t i = 0; i < count; i++) {
+        for (uint32_t m = 0; m < METRIC_COUNT; m++) {
+            uint64_t base;
+            if (metrics[m].kind == METRIC_INFO) continue;
+            if (!baseline_find(json, results[i].name, metrics[m].key, &base)) continue;
+
+            uint64_t cur = metric_get(&results[i], &metrics[m]);
+            double pct = metrics[m].kind == METRIC_TIMING ? timing_threshold_pct : threshold_pct;
+            double limit = base * (1.0 + pct / 100.0);
+            bool bad = cur > limit;
+            if (bad) regressions++;
+            fprintf(stderr, "%-4s %-26s base=%-10llu cur=%-10llu %+7.1f%% %s\n", results[i].name,
+                    metrics[m].key, (unsigned long long)base, (unsigned long long)cur,
+                    base ? (cur - (double)base) * 100.0 / base : 0.0, bad ? "REGRESSION" : "ok");
+        }
+    }
+
+    return regressions;
+}
+
+int main(int argc, char **argv) {
+    const char *face_name = "all";
+    const char *out_path = NULL;
+    const char *baseline_path = NULL;
+    double threshold_pct = 1.0;
+    double timing_threshold_pct = 50.0;
+    uint32_t step_sec = 61;     // 与60互质, 秒针每一步都会移动
+    uint32_t frames_per_step = 15;
+    uint32_t repeats = 3;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "f:o:b:t:T:s:n:r:")) != -1) {
+        switch (opt) {
+            case 'f': face_name = optarg; break;
+            case 'o': out_path = optarg; break;
+            case 'b': baseline_path = optarg; break;
+            case 't': threshold_pct = atof(optarg); break;
+            case 'T': timing_threshold_pct = atof(optarg); break;
+            case 's': step_sec = (uint32_t)atoi(optarg); break;
+            case 'n': frames_per_step = (uint32_t)atoi(optarg); break;
+            case 'r': repeats = (uint32_t)atoi(optarg); break;
+            default:
+                fprintf(stderr, "usage: %s [-f sim|fw|all] [-o report.json] [-b baseline.json] "
+                                "[-t threshold%%] [-T timing_threshold%%] [-s step_s] [-n frames_per_step] [-r repeats]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (step_sec == 0) step_sec = 1;
+    if (repeats == 0) repeats = 1;
+    signal(SIGALRM, timeout_handler);
+
+    face_result_t results[FACE_COUNT];
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < FACE_COUNT; i++) {
+        if (strcmp(face_name, "all") && strcmp(face_name, faces[i].name)) continue;
+        face_result_t *res = &results[count++];
+        run_face(&faces[i], step_sec, frames_per_step, res);
+
+        // 重复扫描, 帧时间取各次中的最小值以抑制主机噪声; 其它指标每次都相同
+        for (uint32_t r = 1; r < repeats; r++) {
+            face_result_t again;
+            run_face(&faces[i], step_sec, frames_per_step, &again);
+            for (uint32_t m = 0; m < METRIC_COUNT; m++) {
+                if (metrics[m].kind != METRIC_TIMING) continue;
+                uint32_t *dst = (uint32_t *)((uint8_t *)res + metrics[m].offset);
+                uint32_t v = (uint32_t)metric_get(&again, &metrics[m]);
+                if (v < *dst) *dst = v;
+            }
+        }
+    }
+    if (count == 0) {
+        fprintf(stderr, "unknown face: %s\n", face_name);
+        return 2;
+    }
+
+    FILE *fp = out_path ? fopen(out_path, "w") : stdout;
+    if (fp == NULL) {
+        fprintf(stderr, "cannot open %s\n", out_path);
+        return 2;
+    }
+    write_report(fp, results, count, step_sec, frames_per_step, repeats);
+    if (fp != stdout) fclose(fp);
+
+    if (baseline_path) {
+        char *json = read_file(baseline_path);
+        if (json == NULL) {
+            fprintf(stderr, "cannot read baseline %s\n", baseline_path);
+            return 2;
+        }
+        uint32_t regressions = compare_baseline(json, results, count, threshold_pct, timing_threshold_pct);
+        free(json);
+        if (regressions) {
+            fprintf(stderr, "%u metric(s) regressed\n", regressions);
+            return 1;
+        }
+    }
+
+    return 0;
+}
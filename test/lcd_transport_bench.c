@@ -0,0 +1,140 @@
+// LCD传输后端基准(主机端, 无SDL)
+//
+// 用记录器后端(lcd_transport_rec.c)推送整屏: 和固件一样10行一个窗口, 每个窗口 CASET/RASET/RAMWR + 像素。
+// 每个后端按各自的总线参数计时, 推送后检查面板模型的显存和源像素一致:
+//   spi - 硬件SPI: spi_init(40MHz)在125MHz外设时钟下实际为31.25MHz, 每次写入都阻塞
+//   pio - PIO+DMA: 62.5MHz, 数据按PIO程序的FIFO字格式编码, 再按程序的行为解码(检查编码);
+//         命令由CPU写入FIFO, 像素由DMA发送, CPU只付出启动开销
+//   rec - 记录器本身: 不计总线时间, 只看主机上推送一帧的耗时
+// 每次传输的固定开销(片选/DC切换、函数调用、DMA启动)是估计值, 设备上的实测用固件的
+// LCD_TRANSPORT_BENCH 选项。最后用12位像素写一行, 检查常亮显示的写入路径。
+//
+// 每个窗口之前CPU先渲染 -r 微秒(LVGL渲染10行), 异步后端的像素传输和下一块的渲染重叠。
+//
+// 用法: lcd_transport_bench [-n 帧数] [-r 每个窗口的渲染微秒数]
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "lcd_transport.h"
+
+#define LCD_WIDTH       240
+#define LCD_HEIGHT      240
+#define BUF_ROWS        10
+
+#define CMD_CASET       0x2A
+#define CMD_RASET       0x2B
+#define CMD_RAMWR       0x2C
+#define CMD_COLMOD      0x3A
+
+typedef struct {
+    const char *name;
+    lcd_rec_cfg_t cfg;
+} backend_t;
+
+static const backend_t backends[] = {
+    { "spi", { .bit_hz = 31250000, .xfer_ns = 1500, .async_pixels = false, .pio_stream = false } },
+    { "pio", { .bit_hz = 62500000, .xfer_ns = 400, .async_pixels = true, .pio_stream = true } },
+    { "rec", { .bit_hz = 0, .xfer_ns = 0, .async_pixels = false, .pio_stream = false } },
+};
+
+static uint16_t frame[LCD_WIDTH * LCD_HEIGHT];
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+static void set_window(const lcd_transport_t *t, uint16_t x1, uint16_t y1, uint16_t x2, uint16_t y2) {
+    uint8_t col[4] = { x1 >> 8, x1 & 0xFF, x2 >> 8, x2 & 0xFF };
+    uint8_t row[4] = { y1 >> 8, y1 & 0xFF, y2 >> 8, y2 & 0xFF };
+    t->cmd(CMD_CASET, col, 4);
+    t->cmd(CMD_RASET, row, 4);
+    t->cmd(CMD_RAMWR, NULL, 0);
+}
+
+static void push_frame(const lcd_transport_t *t, uint32_t render_us) {
+    for (uint16_t y = 0; y < LCD_HEIGHT; y += BUF_ROWS) {
+        lcd_rec_advance(render_us * 1000);
+        set_window(t, 0, y, LCD_WIDTH - 1, y + BUF_ROWS - 1);
+        t->pixels(&frame[y * LCD_WIDTH], LCD_WIDTH * BUF_ROWS, NULL, NULL);
+    }
+}
+
+// 12位像素: 一行交替写入白/黑两个像素, 检查面板模型扩展出的RGB565
+static bool check_12bit(const lcd_transport_t *t) {
+    uint8_t colmod = 0x03;
+    uint8_t line[LCD_WIDTH * 3 / 2];
+    for (size_t i = 0; i < sizeof(line); i += 3) {
+        line[i] = 0xFF;
+        line[i + 1] = 0xF0;
+        line[i + 2] = 0x00;
+    }
+    t->cmd(CMD_COLMOD, &colmod, 1);
+    set_window(t, 0, 100, LCD_WIDTH - 1, 100);
+    t->data(line, sizeof(line));
+    t->wait_idle();
+
+    const uint16_t *gram = lcd_rec_get_gram();
+    for (int x = 0; x < LCD_WIDTH; x++) {
+        if (gram[100 * LCD_WIDTH + x] != ((x & 1) ? 0x0000 : 0xFFFF)) return false;
+    }
+    return lcd_rec_get_param(CMD_COLMOD, 0) == colmod;
+}
+
+int main(int argc, char **argv) {
+    uint32_t frames = 20;
+    uint32_t render_us = 0;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:r:")) != -1) {
+        switch (opt) {
+            case 'n': frames = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 'r': render_us = (uint32_t)strtoul(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "usage: %s [-n frames] [-r render_us]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (frames == 0) frames = 1;
+
+    int ret = 0;
+    printf("%-6s %10s %10s %10s %10s %12s %10s %6s\n", "tr", "frame_us", "cpu_us", "bytes", "xfers", "fifo_words",
+           "host_us", "check");
+    for (size_t b = 0; b < sizeof(backends) / sizeof(backends[0]); b++) {
+        const lcd_transport_t *t = &lcd_transport_rec;
+        lcd_rec_reset(&backends[b].cfg);
+        t->init();
+
+        uint64_t host = 0;
+        bool ok = true;
+        for (uint32_t f = 0; f < frames; f++) {
+            // 每帧的内容都不同, 显存里留着上一帧时也能发现丢失的窗口
+            for (int i = 0; i < LCD_WIDTH * LCD_HEIGHT; i++) frame[i] = (uint16_t)(i * 2654435761u >> 16) ^ f;
+
+            uint64_t h0 = now_ns();
+            push_frame(t, render_us);
+            t->wait_idle();
+            host += now_ns() - h0;
+
+            if (memcmp(lcd_rec_get_gram(), frame, sizeof(frame))) ok = false;
+        }
+
+        lcd_rec_stats_t st;
+        lcd_rec_get_stats(&st);
+        if (st.errors) ok = false;
+        if (!check_12bit(t)) ok = false;
+
+        printf("%-6s %10.1f %10.1f %10llu %10llu %12llu %10.1f %6s\n", backends[b].name,
+               st.elapsed_ns / 1000.0 / frames, st.cpu_ns / 1000.0 / frames,
+               (unsigned long long)(st.bytes / frames), (unsigned long long)(st.xfers / frames),
+               (unsigned long long)(st.fifo_words / frames), host / 1000.0 / frames, ok ? "ok" : "FAIL");
+        if (!ok) ret = 1;
+    }
+
+    if (ret) printf("FAIL: panel model does not match the pushed frame\n");
+    return ret;
+}
@@ -0,0 +1,269 @@
+// 扫秒基准(主机端, 无SDL, 虚拟时间)
+//
+// 1. 亚秒时间源(time_source.c): 模拟的RTC的秒边沿相对微秒计数器有一个随机相位,
+//    主循环以随机间隔(1..35ms)读取RTC。检查:
+//      - 输出的时间(含毫秒)单调不减
+//      - 30秒之后毫秒误差不超过 TS_MAX_ERR_MS
+//      - 停止读取一分钟多(常亮显示)之后误差仍然不超过 TS_MAX_ERR_MS
+//      - RTC被重新设置(相位跳变)之后重新收敛
+// 2. 固件表盘的秒针: 跳秒和 8/16Hz 扫秒各走一段虚拟时间, 每33ms一帧, 统计每一步(有刷新的帧)
+//    重画的像素数和渲染时间(主机线程CPU时间, 只用于前后对比)。分针和日期变化的帧不计入。
+//    每一步的像素数不能超过 2 * 段数 个小矩形的上界(watch_face.h), 步数要等于 hz * 秒数。
+// 任何一项检查失败时返回1。
+//
+// 用法: sec_sweep_bench [-n 每种走法的秒数] [-s 随机种子]
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "lvgl.h"
+#include "src/core/lv_refr_private.h"
+#include "watch_face.h"
+#include "time_source.h"
+
+#define LCD_WIDTH       240
+#define LCD_HEIGHT      240
+#define DISP_BUF_SIZE   (LCD_WIDTH * 10)
+#define FRAME_PERIOD_MS 33
+#define MAX_STEPS       4096
+
+#define TS_MAX_ERR_MS   2
+#define TS_SETTLE_S     30
+
+static lv_color_t buf1[DISP_BUF_SIZE];
+static uint32_t virtual_ms;
+static uint32_t frame_pixels;
+static uint32_t step_px[MAX_STEPS];
+static uint32_t step_us[MAX_STEPS];
+static uint32_t seed = 1;
+
+static uint32_t rnd(void) {
+    seed = seed * 1103515245u + 12345u;
+    return seed >> 8;
+}
+
+static uint64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000u;
+}
+
+static uint32_t virtual_tick_cb(void) {
+    return virtual_ms;
+}
+
+static void bench_flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
+    (void)px_map;
+    frame_pixels += lv_area_get_size(area);
+    lv_display_flush_ready(disp);
+}
+
+static int cmp_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void to_watch_time(uint64_t s, watch_time_t *t) {
+    t->hour = (uint8_t)(s / 3600 % 24);
+    t->min = (uint8_t)(s / 60 % 60);
+    t->sec = (uint8_t)(s % 60);
+    t->month = 1;
+    t->day = 1;
+    t->ms = 0;
+}
+
+static int64_t time_key_ms(const watch_time_t *t) {
+    return ((int64_t)t->hour * 3600 + t->min * 60 + t->sec) * 1000 + t->ms;
+}
+
+// 模拟的RTC: phase_us 时刻为第 base_s 秒的开始
+typedef struct {
+    uint64_t phase_us;
+    uint64_t base_s;
+} rtc_model_t;
+
+static int64_t rtc_true_ms(const rtc_model_t *rtc, uint64_t t) {
+    return (int64_t)(rtc->base_s * 1000) + ((int64_t)t - (int64_t)rtc->phase_us) / 1000;
+}
+
+static void rtc_read(const rtc_model_t *rtc, uint64_t t, watch_time_t *out) {
+    to_watch_time(rtc->base_s + (t - rtc->phase_us) / 1000000, out);
+}
+
+// 以随机间隔读取 seconds 秒, 返回最后 check_after 秒内的最大误差; 单调性被破坏时 *mono 置false
+static int64_t ts_run(const rtc_model_t *rtc, uint64_t *t, uint32_t seconds, uint32_t check_after, bool *mono,
+                      int64_t *last_key) {
+    uint64_t end = *t + (uint64_t)seconds * 1000000;
+    uint64_t check_from = *t + (uint64_t)check_after * 1000000;
+    int64_t max_err = 0;
+    while (*t < end) {
+        *t += 1000 + rnd() % 34000;
+        watch_time_t r, out;
+        rtc_read(rtc, *t, &r);
+        time_source_update(&r, *t);
+        time_source_get(*t, &out);
+
+        int64_t key = time_key_ms(&out);
+        if (key < *last_key) *mono = false;
+        *last_key = key;
+
+        int64_t err = key - rtc_true_ms(rtc, *t);
+        if (err < 0) err = -err;
+        if (*t >= check_from && err > max_err) max_err = err;
+    }
+    return max_err;
+}
+
+static bool check_time_source(void) {
+    rtc_model_t rtc = { .phase_us = 1000000 + rnd() % 1000000, .base_s = 10 * 3600 + 8 * 60 };
+    uint64_t t = rtc.phase_us + 1234;
+    bool mono = true;
+    int64_t last_key = -1;
+    bool ok = true;
+
+    // 收敛
+    int64_t err = ts_run(&rtc, &t, 40, TS_SETTLE_S, &mono, &last_key);
+    printf("time source: settle   err %2lld ms, uncertainty %5u us\n", (long long)err,
+           time_source_get_uncertainty_us());
+    if (err > TS_MAX_ERR_MS) ok = false;
+
+    // 一分钟多没有读取(常亮显示), 相位保持
+    t += 61300000;
+    err = ts_run(&rtc, &t, 5, 0, &mono, &last_key);
+    printf("time source: gap      err %2lld ms, uncertainty %5u us\n", (long long)err,
+           time_source_get_uncertainty_us());
+    if (err > TS_MAX_ERR_MS) ok = false;
+    if (!mono) {
+        printf("time source: output went backwards\n");
+        ok = false;
+    }
+
+    // 重新设置RTC: 时间往后拨一小时, 秒边沿的相位也跳变, 跳变处不检查单调
+    rtc.base_s += (t - rtc.phase_us) / 1000000 + 3600;
+    rtc.phase_us = t - 630000;
+    last_key = -1;
+    mono = true;
+    err = ts_run(&rtc, &t, 40, TS_SETTLE_S, &mono, &last_key);
+    printf("time source: reset    err %2lld ms, uncertainty %5u us\n", (long long)err,
+           time_source_get_uncertainty_us());
+    if (err > TS_MAX_ERR_MS) ok = false;
+    if (!mono) {
+        printf("time source: output went backwards after reset\n");
+        ok = false;
+    }
+    return ok;
+}
+
+// 秒针每一步重画像素数的上界: 旧位置和新位置各 WATCH_FACE_SEC_SEGMENTS 个小矩形
+static uint32_t step_bound_px(void) {
+    uint32_t side = (WATCH_FACE_SEC_LEN + WATCH_FACE_SEC_SEGMENTS - 1) / WATCH_FACE_SEC_SEGMENTS
+                    + 2 * WATCH_FACE_SEC_PAD + 2;
+    return 2 * WATCH_FACE_SEC_SEGMENTS * side * side;
+}
+
+static bool run_sweep(uint8_t hz, uint32_t seconds) {
+    lv_init();
+    lv_tick_set_cb(virtual_tick_cb);
+    virtual_ms = 0;
+
+    lv_display_t *disp = lv_display_create(LCD_WIDTH, LCD_HEIGHT);
+    lv_display_set_buffers(disp, buf1, NULL, sizeof(buf1), LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, bench_flush_cb);
+    lv_display_delete_refr_timer(disp);
+    watch_face_create(lv_screen_active());
+    watch_face_set_sweep(hz);
+
+    // 从 10:08:00 开始, 首帧(整屏)不计入
+    const uint64_t start_ms = (10 * 3600 + 8 * 60) * 1000ull;
+    watch_time_t t;
+    to_watch_time(start_ms / 1000, &t);
+    watch_face_set_time(&t);
+    lv_display_refr_timer(NULL);
+
+    uint32_t steps = 0;
+    uint32_t frames = seconds * 1000 / FRAME_PERIOD_MS;
+    uint8_t last_min = t.min;
+    for (uint32_t f = 1; f <= frames; f++) {
+        virtual_ms += FRAME_PERIOD_MS;
+        uint64_t ms = start_ms + virtual_ms;
+        to_watch_time(ms / 1000, &t);
+        t.ms = (uint16_t)(ms % 1000);
+
+        frame_pixels = 0;
+        uint64_t t0 = now_us();
+        watch_face_set_time(&t);
+        lv_display_refr_timer(NULL);
+        uint32_t elapsed = (uint32_t)(now_us() - t0);
+
+        bool min_changed = t.min != last_min;
+        last_min = t.min;
+        if (frame_pixels == 0 || min_changed) continue;
+        if (steps < MAX_STEPS) {
+            step_px[steps] = frame_pixels;
+            step_us[steps] = elapsed;
+        }
+        steps++;
+    }
+    lv_deinit();
+
+    uint32_t n = steps < MAX_STEPS ? steps : MAX_STEPS;
+    uint32_t px_max = 0;
+    uint64_t px_sum = 0;
+    for (uint32_t i = 0; i < n; i++) {
+        px_sum += step_px[i];
+        if (step_px[i] > px_max) px_max = step_px[i];
+    }
+    qsort(step_us, n, sizeof(uint32_t), cmp_u32);
+    uint32_t us_p50 = n ? step_us[n / 2] : 0;
+    uint32_t us_p99 = n ? step_us[n * 99 / 100] : 0;
+    uint32_t us_max = n ? step_us[n - 1] : 0;
+
+    // 分针变化的帧不计入, 每分钟最多少一步
+    uint32_t per_s = hz ? hz : 1;
+    uint32_t expect = seconds * per_s;
+    uint32_t minutes = (uint32_t)((start_ms + seconds * 1000ull) / 60000 - start_ms / 60000);
+    bool steps_ok = steps + minutes + 1 >= expect && steps <= expect + 1;
+    bool px_ok = px_max <= step_bound_px();
+
+    char name[16];
+    if (hz) snprintf(name, sizeof(name), "sweep %u", hz);
+    else snprintf(name, sizeof(name), "tick");
+    printf("%-9s %6u %8u %8u %8u %8u %8u %8u  %s\n", name, steps, n ? (uint32_t)(px_sum / n) : 0, px_max,
+           step_bound_px(), us_p50, us_p99, us_max, steps_ok && px_ok ? "ok" : "FAIL");
+    if (!steps_ok) printf("  expected %u steps\n", expect);
+    return steps_ok && px_ok;
+}
+
+int main(int argc, char **argv) {
+    uint32_t seconds = 50;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+        switch (opt) {
+            case 'n': seconds = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 's': seed = (uint32_t)strtoul(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "usage: %s [-n seconds] [-s seed]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (seconds == 0) seconds = 1;
+
+    int ret = 0;
+    if (!check_time_source()) {
+        printf("FAIL: time source\n");
+        ret = 1;
+    }
+
+    printf("%-9s %6s %8s %8s %8s %8s %8s %8s\n", "mode", "steps", "px_avg", "px_max", "px_bound", "us_p50",
+           "us_p99", "us_max");
+    static const uint8_t modes[] = { 0, 8, 16 };
+    for (size_t i = 0; i < sizeof(modes); i++) {
+        if (!run_sweep(modes[i], seconds)) ret = 1;
+    }
+    if (ret) printf("FAIL\n");
+    return ret;
+}
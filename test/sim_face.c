@@ -0,0 +1,90 @@
+#include "sim_face.h"
+#include <stdio.h>
+#include "sim_face_gen.h"
+
+// 全局变量
+static lv_obj_t *g_hour_hand;
+static lv_obj_t *g_min_hand;
+static lv_obj_t *g_sec_hand;
+static lv_obj_t *g_date_label;
+static int32_t g_last_sec_angle = 0;
+static int32_t g_last_min_angle = 0;
+static int32_t g_last_hour_angle = 0;
+
+// 动画回调函数
+static void hand_animation_cb(void * var, int32_t value)
+{
+    lv_obj_t * hand = (lv_obj_t *)var;
+    lv_obj_set_style_transform_angle(hand, value, 0);
+}
+
+void sim_face_set_time(const struct tm *t) {
+    // 计算角度
+    int32_t hour_angle = (t->tm_hour % 12 + t->tm_min / 60.0) * 30 * 10;  // 30度每小时，需要乘以10
+    int32_t min_angle = t->tm_min * 6 * 10;  // 6度每分钟，需要乘以10
+    int32_t sec_angle = t->tm_sec * 6 * 10;  // 6度每秒，需要乘以10
+
+    // 创建动画
+    if (sec_angle != g_last_sec_angle) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, g_sec_hand);
+        lv_anim_set_exec_cb(&a, hand_animation_cb);
+        lv_anim_set_values(&a, g_last_sec_angle, sec_angle);
+        lv_anim_set_time(&a, 200);  // 200ms
+        lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+        lv_anim_start(&a);
+        g_last_sec_angle = sec_angle;
+    }
+
+    if (min_angle != g_last_min_angle) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, g_min_hand);
+        lv_anim_set_exec_cb(&a, hand_animation_cb);
+        lv_anim_set_values(&a, g_last_min_angle, min_angle);
+        lv_anim_set_time(&a, 300);  // 300ms
+        lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+        lv_anim_start(&a);
+        g_last_min_angle = min_angle;
+    }
+
+    if (hour_angle != g_last_hour_angle) {
+        lv_anim_t a;
+        lv_anim_init(&a);
+        lv_anim_set_var(&a, g_hour_hand);
+        lv_anim_set_exec_cb(&a, hand_animation_cb);
+        lv_anim_set_values(&a, g_last_hour_angle, hour_angle);
+        lv_anim_set_time(&a, 400);  // 400ms
+        lv_anim_set_path_cb(&a, lv_anim_path_ease_out);
+        lv_anim_start(&a);
+        g_last_hour_angle = hour_angle;
+    }
+    
+    // 更新日期
+    char date_str[32];
+    snprintf(date_str, sizeof(date_str), "%s %02d", 
+             t->tm_mon == 0 ? "JAN" : t->tm_mon == 1 ? "FEB" : t->tm_mon == 2 ? "MAR" :
+             t->tm_mon == 3 ? "APR" : t->tm_mon == 4 ? "MAY" : t->tm_mon == 5 ? "JUN" :
+             t->tm_mon == 6 ? "JUL" : t->tm_mon == 7 ? "AUG" : t->tm_mon == 8 ? "SEP" :
+             t->tm_mon == 9 ? "OCT" : t->tm_mon == 10 ? "NOV" : "DEC", 
+             t->tm_mday);
+    lv_label_set_text(g_date_label, date_str);
+}
+
+void sim_face_create(lv_obj_t *parent) {
+    // 控件和样式来自 sim_face.json(tools/face_gen.py 生成的常量表), 运行时不初始化样式
+    static lv_obj_t *objs[SIM_FACE_OBJ_COUNT];
+    face_table_build(sim_face_table, SIM_FACE_OBJ_COUNT, parent, objs);
+
+    // 保存指针和日期对象到全局变量
+    g_hour_hand = objs[SIM_FACE_HOUR_HAND];
+    g_min_hand = objs[SIM_FACE_MIN_HAND];
+    g_sec_hand = objs[SIM_FACE_SEC_HAND];
+    g_date_label = objs[SIM_FACE_DATE_LABEL];
+
+    // 新建的指针都指向12点
+    g_last_sec_angle = 0;
+    g_last_min_angle = 0;
+    g_last_hour_angle = 0;
+}
@@ -0,0 +1,17 @@
+#ifndef SIM_FACE_H
+#define SIM_FACE_H
+
+#include <time.h>
+#include "lvgl.h"
+
+// 模拟器表盘(玫瑰金渐变+指针动画)
+// 控件和样式描述在 sim_face.json, 修改后运行 pico/g_watch/tools/face_gen.py 重新生成 sim_face_gen.c/.h
+// 时间由调用者提供: simulator.c 使用系统时间, face_bench.c 使用虚拟时钟
+
+// 在parent上创建表盘
+void sim_face_create(lv_obj_t *parent);
+
+// 更新指针(带动画)和日期
+void sim_face_set_time(const struct tm *t);
+
+#endif // SIM_FACE_H
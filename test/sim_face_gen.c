@@ -0,0 +1,339 @@
+// 由 tools/face_gen.py 根据 sim_face.json 生成, 不要手工修改
+#include "sim_face_gen.h"
+
+static const lv_style_const_prop_t sim_face_clock_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xf7, 0xe8, 0xe3)),
+    LV_STYLE_CONST_BG_GRAD_COLOR(LV_COLOR_MAKE(0xe8, 0xce, 0xc7)),
+    LV_STYLE_CONST_BG_GRAD_DIR(LV_GRAD_DIR_VER),
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_SHADOW_WIDTH(20),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0x33, 0x33, 0x33)),
+    LV_STYLE_CONST_SHADOW_OPA(LV_OPA_30),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_clock, sim_face_clock_props);
+
+static const lv_style_const_prop_t sim_face_inner_props[] = {
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xff, 0xff, 0xff)),
+    LV_STYLE_CONST_BG_GRAD_COLOR(LV_COLOR_MAKE(0xf7, 0xe8, 0xe3)),
+    LV_STYLE_CONST_BG_GRAD_DIR(LV_GRAD_DIR_VER),
+    LV_STYLE_CONST_BG_OPA(LV_OPA_50),
+    LV_STYLE_CONST_BORDER_WIDTH(0),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_inner, sim_face_inner_props);
+
+static const lv_style_const_prop_t sim_face_tick_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x33, 0x33, 0x33)),
+    LV_STYLE_CONST_BG_GRAD_COLOR(LV_COLOR_MAKE(0x66, 0x66, 0x66)),
+    LV_STYLE_CONST_BG_GRAD_DIR(LV_GRAD_DIR_VER),
+    LV_STYLE_CONST_SHADOW_WIDTH(3),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_SHADOW_OPA(LV_OPA_30),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_tick, sim_face_tick_props);
+
+static const lv_style_const_prop_t sim_face_brand_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0xb7, 0x6e, 0x5d)),
+    LV_STYLE_CONST_TEXT_FONT(LV_FONT_DEFAULT),
+    LV_STYLE_CONST_TEXT_OPA(LV_OPA_80),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_brand, sim_face_brand_props);
+
+static const lv_style_const_prop_t sim_face_date_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0xff, 0xff, 0xff)),
+    LV_STYLE_CONST_BG_GRAD_COLOR(LV_COLOR_MAKE(0xf8, 0xf8, 0xf8)),
+    LV_STYLE_CONST_BG_GRAD_DIR(LV_GRAD_DIR_VER),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0xcc, 0xcc, 0xcc)),
+    LV_STYLE_CONST_BORDER_WIDTH(1),
+    LV_STYLE_CONST_SHADOW_WIDTH(5),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_SHADOW_OPA(LV_OPA_20),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_date, sim_face_date_props);
+
+static const lv_style_const_prop_t sim_face_date_text_props[] = {
+    LV_STYLE_CONST_TEXT_COLOR(LV_COLOR_MAKE(0x33, 0x33, 0x33)),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_date_text, sim_face_date_text_props);
+
+static const lv_style_const_prop_t sim_face_hour_hand_props[] = {
+    LV_STYLE_CONST_LINE_WIDTH(4),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0x33, 0x33, 0x33)),
+    LV_STYLE_CONST_LINE_ROUNDED(true),
+    LV_STYLE_CONST_SHADOW_WIDTH(5),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_SHADOW_OPA(LV_OPA_30),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_hour_hand, sim_face_hour_hand_props);
+
+static const lv_style_const_prop_t sim_face_min_hand_props[] = {
+    LV_STYLE_CONST_LINE_WIDTH(3),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0x66, 0x66, 0x66)),
+    LV_STYLE_CONST_LINE_ROUNDED(true),
+    LV_STYLE_CONST_SHADOW_WIDTH(4),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_SHADOW_OPA(LV_OPA_20),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_min_hand, sim_face_min_hand_props);
+
+static const lv_style_const_prop_t sim_face_sec_hand_props[] = {
+    LV_STYLE_CONST_LINE_WIDTH(2),
+    LV_STYLE_CONST_LINE_COLOR(LV_COLOR_MAKE(0xff, 0x00, 0x00)),
+    LV_STYLE_CONST_LINE_ROUNDED(true),
+    LV_STYLE_CONST_SHADOW_WIDTH(3),
+    LV_STYLE_CONST_SHADOW_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_SHADOW_OPA(LV_OPA_20),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_sec_hand, sim_face_sec_hand_props);
+
+static const lv_style_const_prop_t sim_face_center_ring_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x33, 0x33, 0x33)),
+    LV_STYLE_CONST_BG_GRAD_COLOR(LV_COLOR_MAKE(0x66, 0x66, 0x66)),
+    LV_STYLE_CONST_BG_GRAD_DIR(LV_GRAD_DIR_VER),
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_BORDER_WIDTH(1),
+    LV_STYLE_CONST_BORDER_COLOR(LV_COLOR_MAKE(0x99, 0x99, 0x99)),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_center_ring, sim_face_center_ring_props);
+
+static const lv_style_const_prop_t sim_face_center_dot_props[] = {
+    LV_STYLE_CONST_BG_COLOR(LV_COLOR_MAKE(0x00, 0x00, 0x00)),
+    LV_STYLE_CONST_RADIUS(LV_RADIUS_CIRCLE),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_center_dot, sim_face_center_dot_props);
+
+static const lv_style_const_prop_t sim_face_layout_0_props[] = {
+    LV_STYLE_CONST_WIDTH(240),
+    LV_STYLE_CONST_HEIGHT(240),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_0, sim_face_layout_0_props);
+
+static const lv_style_const_prop_t sim_face_layout_1_props[] = {
+    LV_STYLE_CONST_WIDTH(200),
+    LV_STYLE_CONST_HEIGHT(200),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_1, sim_face_layout_1_props);
+
+static const lv_style_const_prop_t sim_face_layout_2_props[] = {
+    LV_STYLE_CONST_WIDTH(4),
+    LV_STYLE_CONST_HEIGHT(15),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(118),
+    LV_STYLE_CONST_Y(13),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_2, sim_face_layout_2_props);
+
+static const lv_style_const_prop_t sim_face_layout_3_props[] = {
+    LV_STYLE_CONST_WIDTH(4),
+    LV_STYLE_CONST_HEIGHT(15),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(167),
+    LV_STYLE_CONST_Y(27),
+    LV_STYLE_CONST_TRANSFORM_ROTATION(300),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_3, sim_face_layout_3_props);
+
+static const lv_style_const_prop_t sim_face_layout_4_props[] = {
+    LV_STYLE_CONST_WIDTH(4),
+    LV_STYLE_CONST_HEIGHT(15),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(204),
+    LV_STYLE_CONST_Y(63),
+    LV_STYLE_CONST_TRANSFORM_ROTATION(600),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_4, sim_face_layout_4_props);
+
+static const lv_style_const_prop_t sim_face_layout_5_props[] = {
+    LV_STYLE_CONST_WIDTH(4),
+    LV_STYLE_CONST_HEIGHT(15),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(218),
+    LV_STYLE_CONST_Y(113),
+    LV_STYLE_CONST_TRANSFORM_ROTATION(900),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_5, sim_face_layout_5_props);
+
+static const lv_style_const_prop_t sim_face_layout_6_props[] = {
+    LV_STYLE_CONST_WIDTH(4),
+    LV_STYLE_CONST_HEIGHT(15),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(204),
+    LV_STYLE_CONST_Y(162),
+    LV_STYLE_CONST_TRANSFORM_ROTATION(1200),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_6, sim_face_layout_6_props);
+
+static const lv_style_const_prop_t sim_face_layout_7_props[] = {
+    LV_STYLE_CONST_WIDTH(4),
+    LV_STYLE_CONST_HEIGHT(15),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(168),
+    LV_STYLE_CONST_Y(199),
+    LV_STYLE_CONST_TRANSFORM_ROTATION(1500),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_7, sim_face_layout_7_props);
+
+static const lv_style_const_prop_t sim_face_layout_8_props[] = {
+    LV_STYLE_CONST_WIDTH(4),
+    LV_STYLE_CONST_HEIGHT(15),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(118),
+    LV_STYLE_CONST_Y(213),
+    LV_STYLE_CONST_TRANSFORM_ROTATION(1800),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_8, sim_face_layout_8_props);
+
+static const lv_style_const_prop_t sim_face_layout_9_props[] = {
+    LV_STYLE_CONST_WIDTH(4),
+    LV_STYLE_CONST_HEIGHT(15),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(69),
+    LV_STYLE_CONST_Y(199),
+    LV_STYLE_CONST_TRANSFORM_ROTATION(2100),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_9, sim_face_layout_9_props);
+
+static const lv_style_const_prop_t sim_face_layout_10_props[] = {
+    LV_STYLE_CONST_WIDTH(4),
+    LV_STYLE_CONST_HEIGHT(15),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(32),
+    LV_STYLE_CONST_Y(163),
+    LV_STYLE_CONST_TRANSFORM_ROTATION(2400),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_10, sim_face_layout_10_props);
+
+static const lv_style_const_prop_t sim_face_layout_11_props[] = {
+    LV_STYLE_CONST_WIDTH(4),
+    LV_STYLE_CONST_HEIGHT(15),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(18),
+    LV_STYLE_CONST_Y(113),
+    LV_STYLE_CONST_TRANSFORM_ROTATION(2700),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_11, sim_face_layout_11_props);
+
+static const lv_style_const_prop_t sim_face_layout_12_props[] = {
+    LV_STYLE_CONST_WIDTH(4),
+    LV_STYLE_CONST_HEIGHT(15),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(32),
+    LV_STYLE_CONST_Y(64),
+    LV_STYLE_CONST_TRANSFORM_ROTATION(3000),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_12, sim_face_layout_12_props);
+
+static const lv_style_const_prop_t sim_face_layout_13_props[] = {
+    LV_STYLE_CONST_WIDTH(4),
+    LV_STYLE_CONST_HEIGHT(15),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(68),
+    LV_STYLE_CONST_Y(27),
+    LV_STYLE_CONST_TRANSFORM_ROTATION(3300),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_13, sim_face_layout_13_props);
+
+static const lv_style_const_prop_t sim_face_layout_14_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(-30),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_14, sim_face_layout_14_props);
+
+static const lv_style_const_prop_t sim_face_layout_15_props[] = {
+    LV_STYLE_CONST_WIDTH(60),
+    LV_STYLE_CONST_HEIGHT(20),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_X(0),
+    LV_STYLE_CONST_Y(40),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_15, sim_face_layout_15_props);
+
+static const lv_style_const_prop_t sim_face_layout_16_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_16, sim_face_layout_16_props);
+
+static const lv_style_const_prop_t sim_face_layout_17_props[] = {
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_TRANSFORM_PIVOT_X(120),
+    LV_STYLE_CONST_TRANSFORM_PIVOT_Y(120),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_17, sim_face_layout_17_props);
+
+static const lv_style_const_prop_t sim_face_layout_18_props[] = {
+    LV_STYLE_CONST_WIDTH(12),
+    LV_STYLE_CONST_HEIGHT(12),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_18, sim_face_layout_18_props);
+
+static const lv_style_const_prop_t sim_face_layout_19_props[] = {
+    LV_STYLE_CONST_WIDTH(6),
+    LV_STYLE_CONST_HEIGHT(6),
+    LV_STYLE_CONST_ALIGN(LV_ALIGN_CENTER),
+    LV_STYLE_CONST_PROPS_END
+};
+static LV_STYLE_CONST_INIT(sim_face_layout_19, sim_face_layout_19_props);
+
+static const lv_point_precise_t sim_face_hour_hand_points[] = {{0, 8}, {4, 0}, {0, -40}, {-4, 0}};
+static const lv_point_precise_t sim_face_min_hand_points[] = {{0, 8}, {3, 0}, {0, -70}, {-3, 0}};
+static const lv_point_precise_t sim_face_sec_hand_points[] = {{0, 10}, {2, 0}, {0, -80}, {-2, 0}};
+
+const face_table_obj_t sim_face_table[SIM_FACE_OBJ_COUNT] = {
+    /*  0 clock       */ { FACE_TABLE_OBJ, FACE_TABLE_ROOT, 0, &sim_face_clock, &sim_face_layout_0, NULL, NULL },
+    /*  1 inner       */ { FACE_TABLE_OBJ, SIM_FACE_CLOCK, 0, &sim_face_inner, &sim_face_layout_1, NULL, NULL },
+    /*  2 tick        */ { FACE_TABLE_OBJ, SIM_FACE_CLOCK, 0, &sim_face_tick, &sim_face_layout_2, NULL, NULL },
+    /*  3 tick        */ { FACE_TABLE_OBJ, SIM_FACE_CLOCK, 0, &sim_face_tick, &sim_face_layout_3, NULL, NULL },
+    /*  4 tick        */ { FACE_TABLE_OBJ, SIM_FACE_CLOCK, 0, &sim_face_tick, &sim_face_layout_4, NULL, NULL },
+    /*  5 tick        */ { FACE_TABLE_OBJ, SIM_FACE_CLOCK, 0, &sim_face_tick, &sim_face_layout_5, NULL, NULL },
+    /*  6 tick        */ { FACE_TABLE_OBJ, SIM_FACE_CLOCK, 0, &sim_face_tick, &sim_face_layout_6, NULL, NULL },
+    /*  7 tick        */ { FACE_TABLE_OBJ, SIM_FACE_CLOCK, 0, &sim_face_tick, &sim_face_layout_7, NULL, NULL },
+    /*  8 tick        */ { FACE_TABLE_OBJ, SIM_FACE_CLOCK, 0, &sim_face_tick, &sim_face_layout_8, NULL, NULL },
+    /*  9 tick        */ { FACE_TABLE_OBJ, SIM_FACE_CLOCK, 0, &sim_face_tick, &sim_face_layout_9, NULL, NULL },
+    /* 10 tick        */ { FACE_TABLE_OBJ, SIM_FACE_CLOCK, 0, &sim_face_tick, &sim_face_layout_10, NULL, NULL },
+    /* 11 tick        */ { FACE_TABLE_OBJ, SIM_FACE_CLOCK, 0, &sim_face_tick, &sim_face_layout_11, NULL, NULL },
+    /* 12 tick        */ { FACE_TABLE_OBJ, SIM_FACE_CLOCK, 0, &sim_face_tick, &sim_face_layout_12, NULL, NULL },
+    /* 13 tick        */ { FACE_TABLE_OBJ, SIM_FACE_CLOCK, 0, &sim_face_tick, &sim_face_layout_13, NULL, NULL },
+    /* 14 brand       */ { FACE_TABLE_LABEL, SIM_FACE_CLOCK, 0, &sim_face_brand, &sim_face_layout_14, "YongqiGou", NULL },
+    /* 15 date_box    */ { FACE_TABLE_OBJ, SIM_FACE_CLOCK, 0, &sim_face_date, &sim_face_layout_15, NULL, NULL },
+    /* 16 date_label  */ { FACE_TABLE_LABEL, SIM_FACE_DATE_BOX, 0, &sim_face_date_text, &sim_face_layout_16, "DEC 01", NULL },
+    /* 17 hour_hand   */ { FACE_TABLE_LINE, SIM_FACE_CLOCK, 4, &sim_face_hour_hand, &sim_face_layout_17, NULL, sim_face_hour_hand_points },
+    /* 18 min_hand    */ { FACE_TABLE_LINE, SIM_FACE_CLOCK, 4, &sim_face_min_hand, &sim_face_layout_17, NULL, sim_face_min_hand_points },
+    /* 19 sec_hand    */ { FACE_TABLE_LINE, SIM_FACE_CLOCK, 4, &sim_face_sec_hand, &sim_face_layout_17, NULL, sim_face_sec_hand_points },
+    /* 20 center_ring */ { FACE_TABLE_OBJ, SIM_FACE_CLOCK, 0, &sim_face_center_ring, &sim_face_layout_18, NULL, NULL },
+    /* 21 center_dot  */ { FACE_TABLE_OBJ, SIM_FACE_CLOCK, 0, &sim_face_center_dot, &sim_face_layout_19, NULL, NULL },
+};
@@ -0,0 +1,20 @@
+// 由 tools/face_gen.py 根据 sim_face.json 生成, 不要手工修改
+#ifndef SIM_FACE_GEN_H
+#define SIM_FACE_GEN_H
+
+#include "face_table.h"
+
+// 控件在 sim_face_table 中的下标
+enum {
+    SIM_FACE_CLOCK = 0,
+    SIM_FACE_DATE_BOX = 15,
+    SIM_FACE_DATE_LABEL = 16,
+    SIM_FACE_HOUR_HAND = 17,
+    SIM_FACE_MIN_HAND = 18,
+    SIM_FACE_SEC_HAND = 19,
+    SIM_FACE_OBJ_COUNT = 22
+};
+
+extern const face_table_obj_t sim_face_table[SIM_FACE_OBJ_COUNT];
+
+#endif // SIM_FACE_GEN_H
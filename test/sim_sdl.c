@@ -0,0 +1,235 @@
+#include "sim_sdl.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "libs/SDL2/include/SDL.h"
+#include "src/display/lv_display_private.h"
+
+// 模拟器的SDL显示后端, 见 sim_sdl.h
+
+#define BYTES_PER_PX    2       // RGB565
+#define PARTIAL_ROWS    20
+
+static SDL_Window *window;
+static SDL_Renderer *renderer;
+static SDL_Texture *texture;
+static lv_display_t *disp;
+static int32_t hor_res;
+static int32_t ver_res;
+static int32_t zoom = 1;
+
+static bool zero_copy;
+static uint8_t *tex_base;           // 零复制时纹理像素内存的起点(0,0)
+static int tex_pitch;
+static uint8_t *shadow;             // DIRECT模式退回时的整屏缓冲区
+static uint32_t shadow_stride;
+static uint8_t *partial_buf;
+
+// 零复制: 这一帧要渲染的区域, 和 lv_refr.c 的渲染顺序相同
+static lv_area_t areas[LV_INV_BUF_SIZE];
+static uint32_t area_count;
+static uint32_t area_next;
+
+static sim_sdl_stats_t stats;
+static bool report = true;
+static uint32_t frame_bytes;
+static uint64_t segment_start;      // 这一段渲染的开始(RENDER_START或上一次上传结束)
+
+static uint64_t now_us(void) {
+    return (uint64_t)((double)SDL_GetPerformanceCounter() * 1000000.0 / (double)SDL_GetPerformanceFrequency());
+}
+
+static SDL_Rect to_rect(const lv_area_t *a) {
+    SDL_Rect r = { a->x1, a->y1, lv_area_get_width(a), lv_area_get_height(a) };
+    return r;
+}
+
+// 锁定纹理的一个矩形作为LVGL的渲染目标, 解锁时SDL只上传这个矩形
+static void lock_area(const lv_area_t *a) {
+    SDL_Rect r = to_rect(a);
+    void *pixels;
+    int pitch;
+    SDL_LockTexture(texture, &r, &pixels, &pitch);
+    LV_ASSERT_MSG((uint8_t *)pixels == tex_base + r.y * tex_pitch + r.x * BYTES_PER_PX,
+                  "texture memory moved");
+}
+
+// 锁定返回的必须是纹理常驻的像素内存: 整个纹理和其中一个矩形的地址要对得上, 两次锁定的地址不变
+static bool probe_zero_copy(void) {
+    void *p0;
+    void *p1;
+    void *p2;
+    int pitch0;
+    int pitch1;
+    SDL_Rect r = { hor_res / 2, ver_res / 2, 1, 1 };
+
+    if (SDL_LockTexture(texture, NULL, &p0, &pitch0) != 0) return false;
+    SDL_UnlockTexture(texture);
+    if (SDL_LockTexture(texture, &r, &p1, &pitch1) != 0) return false;
+    SDL_UnlockTexture(texture);
+    if (SDL_LockTexture(texture, NULL, &p2, &pitch1) != 0) return false;
+    SDL_UnlockTexture(texture);
+
+    if (p2 != p0 || (uint8_t *)p1 != (uint8_t *)p0 + r.y * pitch0 + r.x * BYTES_PER_PX) return false;
+    if (lv_draw_buf_align(p0, LV_COLOR_FORMAT_RGB565) != p0) return false;
+    tex_base = p0;
+    tex_pitch = pitch0;
+    return true;
+}
+
+static void present(void) {
+    uint64_t t0 = now_us();
+    SDL_RenderClear(renderer);
+    SDL_RenderCopy(renderer, texture, NULL, NULL);
+    SDL_RenderPresent(renderer);
+    stats.present_us += now_us() - t0;
+}
+
+static void print_report(void) {
+    const char *mode = disp->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL ? "partial"
+                       : zero_copy ? "direct zero-copy" : "direct copy";
+    uint32_t n = stats.frames ? stats.frames : 1;
+    printf("sdl frames %u: render %.2f ms, upload %.2f ms, present %.2f ms, %llu B/frame (max %u), "
+           "%.1f rects/frame, %s\n",
+           stats.frames, stats.render_us / 1000.0 / n, stats.upload_us / 1000.0 / n, stats.present_us / 1000.0 / n,
+           (unsigned long long)(stats.upload_bytes / n), stats.upload_max, (double)stats.rects / n, mode);
+}
+
+static void render_start_cb(lv_event_t *e) {
+    LV_UNUSED(e);
+    frame_bytes = 0;
+    segment_start = now_us();
+    if (!zero_copy) return;
+
+    area_count = 0;
+    area_next = 0;
+    for (uint32_t i = 0; i < disp->inv_p; i++) {
+        if (!disp->inv_area_joined[i]) areas[area_count++] = disp->inv_areas[i];
+    }
+    if (area_count) lock_area(&areas[0]);
+}
+
+static void flush_cb(lv_display_t *d, const lv_area_t *area, uint8_t *px_map) {
+    uint64_t t0 = now_us();
+    stats.render_us += t0 - segment_start;
+
+    SDL_Rect r = to_rect(area);
+    if (zero_copy) {
+        SDL_UnlockTexture(texture);
+        if (++area_next < area_count) lock_area(&areas[area_next]);
+    } else if (d->render_mode == LV_DISPLAY_RENDER_MODE_DIRECT) {
+        SDL_UpdateTexture(texture, &r, shadow + r.y * shadow_stride + r.x * BYTES_PER_PX, (int)shadow_stride);
+    } else {
+        SDL_UpdateTexture(texture, &r, px_map, (int)lv_draw_buf_width_to_stride(r.w, LV_COLOR_FORMAT_RGB565));
+    }
+    frame_bytes += (uint32_t)(r.w * r.h * BYTES_PER_PX);
+    stats.rects++;
+
+    segment_start = now_us();
+    stats.upload_us += segment_start - t0;
+
+    if (lv_display_flush_is_last(d)) {
+        present();
+        stats.frames++;
+        stats.upload_bytes += frame_bytes;
+        if (frame_bytes > stats.upload_max) stats.upload_max = frame_bytes;
+        if (report && stats.frames >= SIM_SDL_REPORT_FRAMES) {
+            print_report();
+            memset(&stats, 0, sizeof(stats));
+        }
+    }
+    lv_display_flush_ready(d);
+}
+
+lv_display_t * sim_sdl_create(int32_t w, int32_t h, int32_t z, lv_display_render_mode_t mode, bool vsync) {
+    hor_res = w;
+    ver_res = h;
+    zoom = z < 1 ? 1 : z;
+
+    window = SDL_CreateWindow("SmallWatch", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
+                              w * zoom, h * zoom, 0);
+    if (window == NULL) {
+        printf("SDL_CreateWindow: %s\n", SDL_GetError());
+        return NULL;
+    }
+    renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED | (vsync ? SDL_RENDERER_PRESENTVSYNC : 0));
+    if (renderer == NULL) renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_SOFTWARE);
+    if (renderer == NULL) {
+        printf("SDL_CreateRenderer: %s\n", SDL_GetError());
+        sim_sdl_destroy();
+        return NULL;
+    }
+
+    // 渲染器按整数倍放大, 最近邻采样
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "nearest");
+    SDL_RenderSetLogicalSize(renderer, w, h);
+    SDL_RenderSetIntegerScale(renderer, SDL_TRUE);
+
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGB565, SDL_TEXTUREACCESS_STREAMING, w, h);
+    if (texture == NULL) {
+        printf("SDL_CreateTexture: %s\n", SDL_GetError());
+        sim_sdl_destroy();
+        return NULL;
+    }
+
+    disp = lv_display_create(w, h);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    if (mode == LV_DISPLAY_RENDER_MODE_DIRECT) {
+        zero_copy = probe_zero_copy();
+        if (zero_copy) {
+            lv_display_set_buffers_with_stride(disp, tex_base, NULL, (uint32_t)(tex_pitch * h), (uint32_t)tex_pitch,
+                                               LV_DISPLAY_RENDER_MODE_DIRECT);
+        } else {
+            SDL_RendererInfo info;
+            SDL_GetRendererInfo(renderer, &info);
+            printf("sdl: %s renderer has no persistent texture memory, DIRECT mode falls back to a copy\n", info.name);
+            shadow_stride = lv_draw_buf_width_to_stride((uint32_t)w, LV_COLOR_FORMAT_RGB565);
+            shadow = malloc(shadow_stride * h);
+            lv_display_set_buffers_with_stride(disp, shadow, NULL, shadow_stride * h, shadow_stride,
+                                               LV_DISPLAY_RENDER_MODE_DIRECT);
+        }
+    } else {
+        uint32_t size = lv_draw_buf_width_to_stride((uint32_t)w, LV_COLOR_FORMAT_RGB565) * PARTIAL_ROWS;
+        partial_buf = malloc(size);
+        lv_display_set_buffers(disp, partial_buf, NULL, size, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    }
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_add_event_cb(disp, render_start_cb, LV_EVENT_RENDER_START, NULL);
+    return disp;
+}
+
+bool sim_sdl_is_zero_copy(void) {
+    return zero_copy;
+}
+
+int32_t sim_sdl_get_zoom(void) {
+    return zoom;
+}
+
+void sim_sdl_redraw(void) {
+    if (renderer && texture) present();
+}
+
+void sim_sdl_get_stats(sim_sdl_stats_t *s) {
+    *s = stats;
+}
+
+void sim_sdl_set_report(bool enable) {
+    report = enable;
+}
+
+void sim_sdl_destroy(void) {
+    if (disp) lv_display_delete(disp);
+    if (texture) SDL_DestroyTexture(texture);
+    if (renderer) SDL_DestroyRenderer(renderer);
+    if (window) SDL_DestroyWindow(window);
+    free(shadow);
+    free(partial_buf);
+    disp = NULL;
+    texture = NULL;
+    renderer = NULL;
+    window = NULL;
+    shadow = NULL;
+    partial_buf = NULL;
+    zero_copy = false;
+}
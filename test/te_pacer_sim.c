@@ -0,0 +1,226 @@
+// TE帧节拍器仿真(主机端, 虚拟时间)
+//
+// 模拟GC9A01面板的扫描和TE信号, 以及固件的刷新流程(PARTIAL模式, 10行缓冲区, 阻塞SPI写入):
+//   面板: 每 PANEL_PERIOD_US 微秒(带抖动)发出一个TE沿并从第0行开始扫描, TE中断有随机延迟
+//   固件: 每个10行的块先渲染 render_us, 再以 SPI 速率写入
+// 记录每一行的新内容第一次被扫描出来的那次扫描, 分三级统计:
+//   win   - 一次 disp_flush() 写入的行分属不同的扫描: 扫描线在写入时穿过了窗口
+//   torn  - 同一个刷新区域的行分属不同的扫描: 区域被切开, 能看到撕裂
+//   split - 各区域完整, 但同一帧的区域分属不同的扫描, 部分区域晚一帧出现
+// 一帧要写的行太多, 或者区域的顺序不利(先写下面再写上面)时, 一帧无法放进一次扫描,
+// 节拍器只能把剩下的窗口顺延到下一次扫描, 区域可能在窗口边界被切开。
+// 对比两种方式:
+//   free  - 和现在一样: 33ms定时刷新, 写入不等待
+//   paced - frame_pacer: TE沿触发刷新, 每个窗口按 frame_pacer_get_delay() 等待
+// 节拍器保证窗口不会被扫描线穿过, 出现 win 撕裂时返回1。
+//
+// 用法: te_pacer_sim [-n 每个场景的帧数] [-s 随机种子]
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <unistd.h>
+#include "frame_pacer.h"
+
+#define LCD_WIDTH           240
+#define LCD_HEIGHT          240
+#define BUF_ROWS            10
+
+// 面板实际参数(节拍器只知道名义值, 需要自己测量)
+#define PANEL_PERIOD_US     16200
+#define PANEL_JITTER_US     40
+#define TE_IRQ_LATENCY_US   30
+
+// 40MHz SPI, RGB565
+#define LINE_WRITE_US       ((LCD_WIDTH * 16) / 40)
+#define WINDOW_OVERHEAD_US  20
+
+#define FREE_REFR_US        33000
+#define MAX_EDGES           (1 << 16)
+
+typedef struct {
+    const char *name;
+    uint16_t max_areas;     // 每帧的刷新区域数
+    uint16_t min_h;         // 区域高度范围
+    uint16_t max_h;
+    uint32_t render_us;     // 每个10行块的渲染时间
+} scenario_t;
+
+typedef struct {
+    uint32_t frames;
+    uint32_t win_torn;      // 被扫描线穿过的窗口数
+    uint32_t torn;          // 有区域被扫描线切过的帧数
+    uint32_t split;         // 各区域完整, 但分属不同扫描的帧数
+    uint64_t wait_us;
+    uint64_t total_us;
+} result_t;
+
+// 模拟的TE信号源: 真实的扫描起点, 以及送到节拍器的时间(加中断延迟)
+static uint32_t edge_time[MAX_EDGES];
+static uint32_t edge_next;      // 下一个还没送给节拍器的沿
+static uint32_t scan_cursor;    // 查找扫描时的起点, 时间只会向前走
+
+static const scenario_t scenarios[] = {
+    // 指针走动: 两块小区域
+    { "hands",  2, 12,  60,  200 },
+    // 整屏更新(切换表盘, 动画)
+    { "full",   1, 240, 240, 300 },
+    // 几块中等大小的区域, 位置随机
+    { "mixed",  3, 20,  120, 250 },
+};
+
+static void te_sim_init(void) {
+    uint32_t t = 1000;
+    for (uint32_t i = 0; i < MAX_EDGES; i++) {
+        edge_time[i] = t;
+        t += PANEL_PERIOD_US + (uint32_t)(rand() % (2 * PANEL_JITTER_US + 1)) - PANEL_JITTER_US;
+    }
+    edge_next = 0;
+    scan_cursor = 0;
+}
+
+// 把 now 之前的TE沿送给节拍器
+static void te_sim_advance(uint32_t now, bool paced) {
+    while (edge_next < MAX_EDGES && edge_time[edge_next] + TE_IRQ_LATENCY_US <= now) {
+        uint32_t latency = (uint32_t)(rand() % (TE_IRQ_LATENCY_US + 1));
+        if (paced) frame_pacer_te_edge(edge_time[edge_next] + latency);
+        edge_next++;
+    }
+}
+
+// 第y行在 t 时刻写完后, 第一次被扫描出来的那次扫描
+static uint32_t te_sim_shown_in(uint16_t y, uint32_t t) {
+    while (scan_cursor + 2 < MAX_EDGES && edge_time[scan_cursor + 1] + PANEL_PERIOD_US < t) scan_cursor++;
+    uint32_t k = scan_cursor;
+    while (k + 1 < MAX_EDGES) {
+        uint32_t period = edge_time[k + 1] - edge_time[k];
+        if (edge_time[k] + (uint32_t)y * period / LCD_HEIGHT >= t) return k;
+        k++;
+    }
+    return k;
+}
+
+static void run_scenario(const scenario_t *sc, bool paced, uint32_t frames, result_t *res) {
+    frame_pacer_cfg_t cfg = {
+        .lines = LCD_HEIGHT,
+        .period_us = 16667,
+        .line_write_us = LINE_WRITE_US,
+        .margin_us = 150,
+        .refr_div = 2,
+        .fallback_us = FREE_REFR_US,
+    };
+    frame_pacer_init(&cfg);
+    te_sim_init();
+    memset(res, 0, sizeof(*res));
+
+    uint32_t now = 0;
+    uint32_t next_free_refr = 0;
+
+    // 先同步几个TE周期
+    now = edge_time[4];
+    te_sim_advance(now, paced);
+    uint32_t start = now;
+
+    while (res->frames < frames) {
+        // 等到下一次刷新
+        if (paced) {
+            while (!frame_pacer_refr_due(now)) {
+                uint32_t idle = frame_pacer_get_idle_us(now);
+                now += idle ? idle : 1;
+                te_sim_advance(now, paced);
+            }
+        } else {
+            if (now < next_free_refr) now = next_free_refr;
+            next_free_refr = now + FREE_REFR_US;
+            te_sim_advance(now, paced);
+        }
+
+        // 这一帧的刷新区域, 每个区域按10行一块渲染和写入
+        uint32_t shown_min = UINT32_MAX;
+        uint32_t shown_max = 0;
+        bool torn = false;
+        uint16_t area_cnt = (uint16_t)(1 + rand() % sc->max_areas);
+        for (uint16_t a = 0; a < area_cnt; a++) {
+            uint16_t h = (uint16_t)(sc->min_h + rand() % (sc->max_h - sc->min_h + 1));
+            uint16_t y1 = (uint16_t)(rand() % (LCD_HEIGHT - h + 1));
+            uint16_t y2 = (uint16_t)(y1 + h - 1);
+            uint32_t area_min = UINT32_MAX;
+            uint32_t area_max = 0;
+
+            for (uint16_t row = y1; row <= y2; row += BUF_ROWS) {
+                uint16_t row_end = row + BUF_ROWS - 1 < y2 ? row + BUF_ROWS - 1 : y2;
+                bool last = a == area_cnt - 1 && row_end == y2;
+
+                now += sc->render_us;
+                te_sim_advance(now, paced);
+
+                if (paced) {
+                    uint32_t delay = frame_pacer_get_delay(row, row_end, now);
+                    res->wait_us += delay;
+                    now += delay;
+                    te_sim_advance(now, paced);
+                }
+
+                uint32_t write_start = now;
+                uint32_t win_min = UINT32_MAX;
+                uint32_t win_max = 0;
+                now += WINDOW_OVERHEAD_US;
+                for (uint16_t y = row; y <= row_end; y++) {
+                    now += LINE_WRITE_US;
+                    uint32_t k = te_sim_shown_in(y, now);
+                    if (k < win_min) win_min = k;
+                    if (k > win_max) win_max = k;
+                }
+                if (win_min != win_max) res->win_torn++;
+                if (win_min < area_min) area_min = win_min;
+                if (win_max > area_max) area_max = win_max;
+                te_sim_advance(now, paced);
+                if (paced) frame_pacer_flush_done((uint16_t)(row_end - row + 1), now - write_start, last);
+            }
+            if (area_min != area_max) torn = true;
+            if (area_min < shown_min) shown_min = area_min;
+            if (area_max > shown_max) shown_max = area_max;
+        }
+
+        res->frames++;
+        if (torn) res->torn++;
+        else if (shown_min != shown_max) res->split++;
+        if (edge_next >= MAX_EDGES - 16) break;
+    }
+    res->total_us = now - start;
+}
+
+int main(int argc, char **argv) {
+    uint32_t frames = 2000;
+    unsigned int seed = 1;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:s:")) != -1) {
+        switch (opt) {
+            case 'n': frames = (uint32_t)strtoul(optarg, NULL, 10); break;
+            case 's': seed = (unsigned int)strtoul(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "usage: %s [-n frames] [-s seed]\n", argv[0]);
+                return 2;
+        }
+    }
+
+    int ret = 0;
+    printf("%-8s %-6s %8s %8s %8s %8s %10s %8s\n", "scenario", "mode", "frames", "win", "torn", "split", "wait_ms",
+           "fps");
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        const scenario_t *sc = &scenarios[i];
+        for (int paced = 0; paced <= 1; paced++) {
+            result_t res;
+            srand(seed);
+            run_scenario(sc, paced, frames, &res);
+            double fps = res.total_us ? res.frames * 1e6 / res.total_us : 0;
+            printf("%-8s %-6s %8u %8u %8u %8u %10.1f %8.1f\n", sc->name, paced ? "paced" : "free",
+                   res.frames, res.win_torn, res.torn, res.split, res.wait_us / 1000.0, fps);
+            if (paced && res.win_torn > 0) ret = 1;
+        }
+    }
+
+    if (ret) printf("FAIL: paced windows were torn\n");
+    return ret;
+}
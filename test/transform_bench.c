@@ -0,0 +1,163 @@
+// 图片变换的插值器路径测试和基准(主机端, 无SDL)
+//
+// 固件的 lv_conf.h 把 lv_draw_sw_transform.c 的源坐标计算交给 lv_draw_sw_rp2040.h(RP2040硬件插值器),
+// 主机上由 interp_emu.c 仿真插值器。这里对RGB565、RGB565A8和A8源图, 在多组角度/缩放/抗锯齿下
+// 各变换一次软件公式路径和插值器路径, 两者的输出(颜色和alpha)必须逐字节一致。
+// 另外用随机的起点/步长单独检查逐像素的坐标序列, 覆盖负步长和大坐标。
+// 耗时是主机上仿真的时间, 只说明两条路径都在工作, 不代表RP2040上的速度。
+// 需要用固件的 lv_conf.h 编译LVGL, 否则变换不经过插值器, 测试失败。
+//
+// 用法: transform_bench [-n 每组重复次数]
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "lvgl.h"
+#include "src/draw/sw/lv_draw_sw.h"
+#include "lv_draw_sw_rp2040.h"
+
+#define SRC_W           64
+#define SRC_H           48
+#define DEST_MARGIN     40
+
+typedef struct {
+    const char *name;
+    lv_color_format_t cf;
+    uint32_t px_size;       // 颜色平面每像素字节数, RGB565A8的A8平面跟在颜色平面后面
+} src_fmt_t;
+
+static const src_fmt_t formats[] = {
+    { "rgb565", LV_COLOR_FORMAT_RGB565, 2 },
+    { "rgb565a8", LV_COLOR_FORMAT_RGB565A8, 2 },
+    { "a8", LV_COLOR_FORMAT_A8, 1 },
+};
+
+static const int32_t angles[] = { 0, 15, 450, 900, 1337, 2700, 3599 };
+static const int32_t scales[] = { 128, 256, 300, 700 };
+
+static uint8_t src_buf[SRC_W * SRC_H * 3];
+static uint8_t ref_buf[(SRC_W + 2 * DEST_MARGIN) * (SRC_H + 2 * DEST_MARGIN) * 3];
+static uint8_t out_buf[sizeof(ref_buf)];
+
+static uint64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000u + ts.tv_nsec;
+}
+
+static uint64_t run(const src_fmt_t *f, const lv_draw_image_dsc_t *dsc, const lv_area_t *area, uint8_t *dest,
+                    bool interp, uint32_t n) {
+    lv_draw_sw_rp2040_interp = interp;
+    int32_t stride = SRC_W * (int32_t)f->px_size;
+    uint64_t t0 = now_ns();
+    for (uint32_t i = 0; i < n; i++) {
+        lv_draw_sw_transform(NULL, area, src_buf, SRC_W, SRC_H, stride, dsc, NULL, f->cf, dest);
+    }
+    return now_ns() - t0;
+}
+
+// 逐像素的坐标序列: 插值器和软件公式对同样的起点/步长给出同样的结果
+static bool check_walk(uint32_t cases) {
+    uint32_t seed = 12345;
+    for (uint32_t c = 0; c < cases; c++) {
+        seed = seed * 1103515245u + 12345u;
+        int32_t xs_start = (int32_t)(seed >> 8 & 0x1fffff) - 0x100000;
+        seed = seed * 1103515245u + 12345u;
+        int32_t ys_start = (int32_t)(seed >> 8 & 0x1fffff) - 0x100000;
+        seed = seed * 1103515245u + 12345u;
+        int32_t xs_step = (int32_t)(seed >> 8 & 0x1ffff) - 0x10000;
+        seed = seed * 1103515245u + 12345u;
+        int32_t ys_step = (int32_t)(seed >> 8 & 0x1ffff) - 0x10000;
+
+        lv_draw_sw_rp2040_interp = true;
+        lv_draw_sw_rp2040_walk_start(xs_start, ys_start, xs_step, ys_step);
+        for (int32_t x = 0; x < 480; x++) {
+            int32_t xs = (int32_t)interp_pop_lane_result(interp0, 1);
+            int32_t ys = (int32_t)interp_pop_lane_result(interp1, 1);
+            if (xs != xs_start + ((xs_step * x) >> 8) || ys != ys_start + ((ys_step * x) >> 8)) {
+                printf("walk mismatch: start %d,%d step %d,%d x %d\n", xs_start, ys_start, xs_step, ys_step, x);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, char **argv) {
+    uint32_t n = 20;
+    int opt;
+    while ((opt = getopt(argc, argv, "n:")) != -1) {
+        switch (opt) {
+            case 'n': n = (uint32_t)strtoul(optarg, NULL, 10); break;
+            default:
+                fprintf(stderr, "usage: %s [-n repeat]\n", argv[0]);
+                return 2;
+        }
+    }
+    if (n == 0) n = 1;
+
+    lv_init();
+
+    // 有渐变也有硬边的源图, 抗锯齿的混合分支都会走到
+    for (size_t i = 0; i < sizeof(src_buf); i++) src_buf[i] = (uint8_t)((i * 2654435761u >> 13) ^ (i / 7));
+
+    // 目标区域比源图大一圈, 覆盖完全在图外和部分在图外的像素
+    lv_area_t area = { -DEST_MARGIN, -DEST_MARGIN, SRC_W + DEST_MARGIN - 1, SRC_H + DEST_MARGIN - 1 };
+
+    int ret = 0;
+    uint32_t rows0 = lv_draw_sw_rp2040_rows;
+    printf("%-9s %10s %10s %10s %6s\n", "format", "cases", "sw_us", "interp_us", "check");
+    for (size_t fi = 0; fi < sizeof(formats) / sizeof(formats[0]); fi++) {
+        const src_fmt_t *f = &formats[fi];
+        uint64_t sw_ns = 0, interp_ns = 0;
+        uint32_t cases = 0;
+        bool ok = true;
+
+        for (size_t ai = 0; ai < sizeof(angles) / sizeof(angles[0]); ai++) {
+            for (size_t si = 0; si < sizeof(scales) / sizeof(scales[0]); si++) {
+                for (int aa = 0; aa < 2; aa++) {
+                    lv_draw_image_dsc_t dsc;
+                    lv_draw_image_dsc_init(&dsc);
+                    dsc.rotation = angles[ai];
+                    dsc.scale_x = scales[si];
+                    dsc.scale_y = scales[(si + 1) % (sizeof(scales) / sizeof(scales[0]))];
+                    dsc.pivot.x = SRC_W / 2;
+                    dsc.pivot.y = SRC_H / 3;
+                    dsc.antialias = aa;
+
+                    memset(ref_buf, 0x5a, sizeof(ref_buf));
+                    memset(out_buf, 0x5a, sizeof(out_buf));
+                    sw_ns += run(f, &dsc, &area, ref_buf, false, n);
+                    interp_ns += run(f, &dsc, &area, out_buf, true, n);
+                    cases++;
+
+                    if (memcmp(ref_buf, out_buf, sizeof(ref_buf))) {
+                        printf("mismatch: %s angle %d scale %d/%d aa %d\n", f->name, (int)dsc.rotation,
+                               (int)dsc.scale_x, (int)dsc.scale_y, aa);
+                        ok = false;
+                    }
+                }
+            }
+        }
+
+        printf("%-9s %10u %10.1f %10.1f %6s\n", f->name, cases, sw_ns / 1000.0 / cases / n,
+               interp_ns / 1000.0 / cases / n, ok ? "ok" : "FAIL");
+        if (!ok) ret = 1;
+    }
+
+    if (lv_draw_sw_rp2040_rows == rows0) {
+        printf("FAIL: transforms did not go through lv_draw_sw_rp2040.h (LVGL built without the firmware lv_conf.h?)\n");
+        ret = 1;
+    }
+
+    bool walk_ok = check_walk(10000);
+    printf("walk      %10u %10s %10s %6s\n", 10000u, "-", "-", walk_ok ? "ok" : "FAIL");
+    if (!walk_ok) ret = 1;
+
+    lv_deinit();
+    if (ret) printf("FAIL: interpolator path differs from the software path\n");
+    return ret;
+}
@@ -0,0 +1,172 @@
+// ui_queue 延迟与竞争基准测试(主机端, pthread)
+//
+// 场景1 帧阻塞: UI线程每帧持有渲染锁 FRAME_MS 毫秒, 生产者每 PRODUCER_PERIOD_US 微秒更新一次。
+//   lock  - 生产者像现在一样先拿 lv_lock() 再改控件, 会被整帧渲染阻塞
+//   queue - 生产者投递到 ui_queue, UI线程在下一帧开始前取出
+// 场景2 吞吐: 生产者全速投递(满则重试), UI线程全速取出, 统计吞吐与满队列重试次数。
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <sched.h>
+#include <time.h>
+#include "ui_queue.h"
+
+#define FRAME_MS            33
+#define FRAME_COUNT         60
+#define PRODUCER_PERIOD_US  2000
+#define FLOOD_COUNT         200000
+#define MAX_SAMPLES         (1 << 16)
+
+typedef struct {
+    uint32_t samples[MAX_SAMPLES];
+    uint32_t count;
+} sample_set_t;
+
+static pthread_mutex_t render_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_mutex_t sample_lock = PTHREAD_MUTEX_INITIALIZER;
+static atomic_bool running;
+static bool use_queue;
+static sample_set_t post_cost;   // 生产者一次更新花费的时间
+static sample_set_t latency;     // 从生产者发起到UI线程执行的时间
+static uint64_t bench_start_us;
+
+static uint64_t now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + ts.tv_nsec / 1000u;
+}
+
+static void sleep_us(uint32_t us) {
+    struct timespec ts = { .tv_sec = us / 1000000u, .tv_nsec = (us % 1000000u) * 1000u };
+    nanosleep(&ts, NULL);
+}
+
+static void sample_add(sample_set_t *set, uint32_t value) {
+    pthread_mutex_lock(&sample_lock);
+    if (set->count < MAX_SAMPLES) set->samples[set->count++] = value;
+    pthread_mutex_unlock(&sample_lock);
+}
+
+static int cmp_u32(const void *a, const void *b) {
+    uint32_t x = *(const uint32_t *)a;
+    uint32_t y = *(const uint32_t *)b;
+    return (x > y) - (x < y);
+}
+
+static void sample_print(const char *name, sample_set_t *set) {
+    if (set->count == 0) {
+        printf("  %-10s n=0\n", name);
+        return;
+    }
+    qsort(set->samples, set->count, sizeof(uint32_t), cmp_u32);
+    printf("  %-10s n=%-6u p50=%6u us  p99=%6u us  max=%6u us\n", name, set->count,
+           set->samples[set->count / 2],
+           set->samples[(uint32_t)(set->count * 0.99)],
+           set->samples[set->count - 1]);
+}
+
+// 模拟传感器线程
+static void *producer_thread(void *arg) {
+    (void)arg;
+    while (atomic_load(&running)) {
+        uint64_t t0 = now_us();
+        if (use_queue) {
+            ui_queue_post_value(UI_HANDLE_NONE, (int32_t)(t0 - bench_start_us));
+        } else {
+            pthread_mutex_lock(&render_lock);
+            sample_add(&latency, (uint32_t)(now_us() - t0));
+            pthread_mutex_unlock(&render_lock);
+        }
+        sample_add(&post_cost, (uint32_t)(now_us() - t0));
+        sleep_us(PRODUCER_PERIOD_US);
+    }
+    return NULL;
+}
+
+// 模拟UI线程: 取出命令后整帧持锁渲染
+static void *ui_thread(void *arg) {
+    (void)arg;
+    for (int frame = 0; frame < FRAME_COUNT; frame++) {
+        pthread_mutex_lock(&render_lock);
+        ui_cmd_t cmd;
+        while (use_queue && ui_queue_pop(&cmd)) {
+            uint32_t posted = (uint32_t)cmd.value;
+            sample_add(&latency, (uint32_t)(now_us() - bench_start_us) - posted);
+        }
+        sleep_us(FRAME_MS * 1000);
+        pthread_mutex_unlock(&render_lock);
+        sleep_us(1000);
+    }
+    atomic_store(&running, false);
+    return NULL;
+}
+
+static void run_frame_bench(bool queue, int producers) {
+    pthread_t ui;
+    pthread_t prod[8];
+
+    use_queue = queue;
+    post_cost.count = 0;
+    latency.count = 0;
+    ui_queue_init();
+    atomic_store(&running, true);
+    bench_start_us = now_us();
+
+    pthread_create(&ui, NULL, ui_thread, NULL);
+    for (int i = 0; i < producers; i++) pthread_create(&prod[i], NULL, producer_thread, NULL);
+    pthread_join(ui, NULL);
+    for (int i = 0; i < producers; i++) pthread_join(prod[i], NULL);
+
+    printf("[frame] mode=%-5s producers=%d dropped=%u\n", queue ? "queue" : "lock", producers,
+           ui_queue_get_dropped());
+    sample_print("post", &post_cost);
+    sample_print("latency", &latency);
+}
+
+// 每个生产者投递固定数量的命令, 队列满时让出CPU后重试
+static void *flood_thread(void *arg) {
+    (void)arg;
+    for (uint32_t i = 0; i < FLOOD_COUNT; i++) {
+        while (!ui_queue_post_invalidate(UI_HANDLE_NONE)) sched_yield();
+    }
+    return NULL;
+}
+
+static void run_throughput_bench(int producers) {
+    pthread_t prod[8];
+    uint64_t popped = 0;
+    uint64_t total = (uint64_t)FLOOD_COUNT * producers;
+    ui_cmd_t cmd;
+
+    ui_queue_init();
+    uint64_t t0 = now_us();
+    for (int i = 0; i < producers; i++) pthread_create(&prod[i], NULL, flood_thread, NULL);
+    while (popped < total) {
+        if (ui_queue_pop(&cmd)) popped++;
+        else sched_yield();
+    }
+    uint64_t elapsed = now_us() - t0;
+    for (int i = 0; i < producers; i++) pthread_join(prod[i], NULL);
+
+    printf("[flood] producers=%d cmds=%llu full_retries=%u %.2f Mcmd/s\n",
+           producers, (unsigned long long)popped, ui_queue_get_dropped(),
+           popped / (double)(elapsed ? elapsed : 1));
+}
+
+int main(void) {
+    const int producer_counts[] = {1, 2, 4};
+
+    for (unsigned int i = 0; i < sizeof(producer_counts) / sizeof(producer_counts[0]); i++) {
+        run_frame_bench(false, producer_counts[i]);
+        run_frame_bench(true, producer_counts[i]);
+    }
+
+    for (unsigned int i = 0; i < sizeof(producer_counts) / sizeof(producer_counts[0]); i++) {
+        run_throughput_bench(producer_counts[i]);
+    }
+
+    return 0;
+}